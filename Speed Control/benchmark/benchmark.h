@@ -0,0 +1,96 @@
+/**
+ *  \file	benchmark.h
+ *  \brief	This file includes the common helpers of the benchmarks.
+ *  \author Ahmed Wageh.
+ *  \details Every module benchmark is a function that is called
+ *  		 from the benchmark runner in "benchmark_main.c" and
+ *  		 prints its results to the console window. Every result
+ *  		 is reported by \ref Benchmark_Report too, so all results
+ *  		 can be written as JSON to track them between releases.
+ */
+#ifndef BENCHMARK_H_
+#define BENCHMARK_H_
+
+/* Macros */
+/** The maximum number of reported results */
+#define BENCHMARK_MAX_RESULTS	128u
+/** The maximum size of the name of a result with its null */
+#define BENCHMARK_MAX_NAME_SIZE	48u
+
+/* Functions prototypes */
+/**
+ *  \brief Gets a monotonic time stamp in seconds.
+ *
+ *  \return The time stamp in seconds.
+ */
+double Benchmark_GetTimeSec(void);
+
+/**
+ *  \brief Reports one result of a benchmark.
+ *
+ *  \param [in] Name The stable name of the result, like "parse.record.scalar".
+ *  \param [in] Value The measured value.
+ *  \param [in] Unit The unit of \p Value, like "lines/s".
+ *  \param [in] Valid 0 if the result doesn't match the reference result.
+ *  \return None.
+ *
+ *  \details The name is copied, the unit must be a string literal. The
+ *  		 results after #BENCHMARK_MAX_RESULTS results are dropped.
+ */
+void Benchmark_Report(const char * Name, double Value, const char * Unit, int Valid);
+
+/**
+ *  \brief Benchmarks reading and writing the text files.
+ *
+ *  \details It compares ticks per second of opening, appending
+ *  		 and closing the file per line against the buffered
+ *  		 \ref FileIf_Writer_t and lines per second of fscanf
+ *  		 per character against the block \ref FileIf_Reader_t.
+ */
+void FileIf_Benchmark(void);
+
+/**
+ *  \brief Benchmarks the Motor module.
+ *
+ *  \details It prints updates per second of \ref Motor_ContextUpdateSpeed
+ *  		 writing text lines and run-length runs.
+ */
+void Motor_Benchmark(void);
+
+/**
+ *  \brief Benchmarks the Parse module.
+ *
+ *  \details It compares the switch state text classifiers, the
+ *  		 scanning levels of \ref ParseRecord and the duration decoders.
+ */
+void Parse_Benchmark(void);
+
+/**
+ *  \brief Benchmarks replaying a whole input file end to end.
+ *
+ *  \param [in] Lines The number of lines of the generated input file.
+ *  \return None.
+ *
+ *  \details It generates the same input file for the same \p Lines on
+ *  		 every platform by \ref Generate_File, then it prints lines per
+ *  		 second of replaying it line by line and by fast-forwarding runs.
+ */
+void Replay_Benchmark(unsigned long long Lines);
+
+/**
+ *  \brief Benchmarks the Speed Control module.
+ *
+ *  \details It compares devices per second of \ref SpeedControl_CalcSpeed
+ *  		 per device with \ref SpeedControl_CalcSpeedBatch.
+ */
+void SpeedControl_Benchmark(void);
+
+/**
+ *  \brief Benchmarks the Trace module.
+ *
+ *  \details It compares the size and lines per second of the text lines
+ *  		 parsed by \ref ParseRecord with the binary trace records
+ *  		 decoded by \ref Trace_DecodeRecord.
+ */
+void Trace_Benchmark(void);
+#endif // !BENCHMARK_H_
@@ -0,0 +1,222 @@
+/**
+ *  \file	benchmark_main.c
+ *  \brief	This is the main code of the benchmarks.
+ *  \author Ahmed Wageh.
+ *  \details	Usage: speedcontrol_benchmark [--json <results file>] [--lines <count>]...
+ *  			Every "--lines" runs the replay benchmark over a generated
+ *  			input file of this number of lines, without it the input
+ *  			files are #BENCHMARK_MAIN_DEFAULT_LINES lines.
+ */
+/* Inclusion */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "benchmark.h"
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+/* Macros */
+/** The maximum number of replayed input files */
+#define BENCHMARK_MAIN_MAX_REPLAYS		8
+/** The numbers of lines of the replayed input files without "--lines" */
+#define BENCHMARK_MAIN_DEFAULT_LINES	{1000000ull, 10000000ull, 100000000ull}
+
+/* User-defined data types */
+/**
+ *  This struct holds one reported result.
+ */
+struct Benchmark_Result_t
+{
+	/** The stable name of the result */
+	char Name[BENCHMARK_MAX_NAME_SIZE];
+	/** The measured value */
+	double Value;
+	/** The unit of the value */
+	const char * Unit;
+	/** 0 if the result doesn't match the reference result */
+	int Valid;
+};
+typedef struct Benchmark_Result_t Benchmark_Result_t;
+
+/* Private variables */
+/** The reported results */
+static Benchmark_Result_t Benchmark_Results[BENCHMARK_MAX_RESULTS];
+/** The number of reported results */
+static unsigned int Benchmark_Results_Count = 0;
+
+/* Private functions prototype */
+/**
+ *  \brief Writes all reported results as JSON.
+ *
+ *  \param [in] Path The path of the results file.
+ *  \param [in] Lines The numbers of lines of the replayed input files.
+ *  \param [in] Replays The number of replayed input files.
+ *  \return 0 if the file is written, otherwise 1.
+ */
+static int Benchmark_WriteJson(const char * Path, const unsigned long long * Lines, int Replays);
+
+/* Functions definition */
+/* Private functions */
+/**
+ *  \brief Writes all reported results as JSON.
+ *
+ *  \param [in] Path The path of the results file.
+ *  \param [in] Lines The numbers of lines of the replayed input files.
+ *  \param [in] Replays The number of replayed input files.
+ *  \return 0 if the file is written, otherwise 1.
+ *
+ *  \details The names and units are plain identifiers, so they are
+ *  		 written without escaping.
+ */
+static int Benchmark_WriteJson(const char * Path, const unsigned long long * Lines, int Replays)
+{
+	/* Needed variables */
+	FILE * handler = fopen(Path, "w");
+	unsigned int index;
+	int retCode = 1;
+
+	/* Function logic */
+	if (handler != NULL)
+	{
+		fprintf(handler, "{\n  \"suite\": \"speedcontrol_benchmark\",\n  \"version\": 1,\n  \"replay_lines\": [");
+		for (index = 0; index < (unsigned int)Replays; index++)
+		{
+			fprintf(handler, "%s%llu", (index != 0u) ? ", " : "", Lines[index]);
+		}
+		fprintf(handler, "],\n  \"results\": [\n");
+		for (index = 0; index < Benchmark_Results_Count; index++)
+		{
+			fprintf(handler, "    {\"name\": \"%s\", \"value\": %.10g, \"unit\": \"%s\", \"valid\": %s}%s\n",
+				Benchmark_Results[index].Name, Benchmark_Results[index].Value, Benchmark_Results[index].Unit,
+				Benchmark_Results[index].Valid ? "true" : "false",
+				(index + 1u < Benchmark_Results_Count) ? "," : "");
+		}
+		fprintf(handler, "  ]\n}\n");
+		retCode = (fclose(handler) != 0);
+	}
+
+	return retCode;
+}
+
+/* Public functions */
+/**
+ *  \brief Gets a monotonic time stamp in seconds.
+ *
+ *  \return The time stamp in seconds.
+ */
+double Benchmark_GetTimeSec(void)
+{
+#ifdef _WIN32
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+
+	QueryPerformanceCounter(&counter);
+	QueryPerformanceFrequency(&frequency);
+	return (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+#endif
+}
+
+/**
+ *  \brief Reports one result of a benchmark.
+ *
+ *  \param [in] Name The stable name of the result, like "parse.record.scalar".
+ *  \param [in] Value The measured value.
+ *  \param [in] Unit The unit of \p Value, like "lines/s".
+ *  \param [in] Valid 0 if the result doesn't match the reference result.
+ *  \return None.
+ */
+void Benchmark_Report(const char * Name, double Value, const char * Unit, int Valid)
+{
+	if (Benchmark_Results_Count < BENCHMARK_MAX_RESULTS)
+	{
+		snprintf(Benchmark_Results[Benchmark_Results_Count].Name, BENCHMARK_MAX_NAME_SIZE, "%s", Name);
+		Benchmark_Results[Benchmark_Results_Count].Value = Value;
+		Benchmark_Results[Benchmark_Results_Count].Unit = Unit;
+		Benchmark_Results[Benchmark_Results_Count].Valid = Valid;
+		Benchmark_Results_Count++;
+	}
+}
+
+/**
+ *  \brief Benchmarks main body
+ *
+ *  \details It runs the benchmark of every module, then it replays the
+ *  		 generated input files. It returns 0 only if all results are
+ *  		 valid and the JSON file is written.
+ */
+int main(int argc, char * argv[])
+{
+	/* Needed variables */
+	static const unsigned long long defaultLines[] = BENCHMARK_MAIN_DEFAULT_LINES;
+	unsigned long long lines[BENCHMARK_MAIN_MAX_REPLAYS];
+	const char * jsonPath = NULL;
+	char * end;
+	unsigned int index;
+	int replays = 0;
+	int retCode = 0;
+
+	/* Program arguments */
+	for (index = 1; index < (unsigned int)argc; index++)
+	{
+		if (strcmp(argv[index], "--json") == 0 && index + 1u < (unsigned int)argc)
+		{
+			jsonPath = argv[++index];
+		}
+		else if (strcmp(argv[index], "--lines") == 0 && index + 1u < (unsigned int)argc &&
+			replays < BENCHMARK_MAIN_MAX_REPLAYS)
+		{
+			lines[replays] = strtoull(argv[++index], &end, 10);
+			retCode |= (*end != '\0' || lines[replays] == 0u);
+			replays++;
+		}
+		else
+		{
+			retCode = 1;
+		}
+	}
+	if (retCode != 0)
+	{
+		fprintf(stderr, "Usage: %s [--json <results file>] [--lines <count>]...\n", argv[0]);
+		return 2;
+	}
+	if (replays == 0)
+	{
+		for (replays = 0; replays < (int)(sizeof(defaultLines) / sizeof(defaultLines[0])); replays++)
+		{
+			lines[replays] = defaultLines[replays];
+		}
+	}
+
+	/* Program logic */
+	printf("======================= Benchmarks =======================\n\n");
+	FileIf_Benchmark();
+	Parse_Benchmark();
+	SpeedControl_Benchmark();
+	Motor_Benchmark();
+	Trace_Benchmark();
+	for (index = 0; index < (unsigned int)replays; index++)
+	{
+		Replay_Benchmark(lines[index]);
+	}
+	printf("\n==================== Benchmarks Done ====================\n");
+
+	for (index = 0; index < Benchmark_Results_Count; index++)
+	{
+		retCode |= !Benchmark_Results[index].Valid;
+	}
+	if (jsonPath != NULL && Benchmark_WriteJson(jsonPath, lines, replays) != 0)
+	{
+		fprintf(stderr, "Can't write %s\n", jsonPath);
+		retCode = 1;
+	}
+
+	return retCode;
+}
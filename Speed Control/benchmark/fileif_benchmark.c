@@ -0,0 +1,145 @@
+/**
+ *  \file	fileif_benchmark.c
+ *  \brief	This file includes the benchmark of File If module.
+ *  \author Ahmed Wageh.
+ */
+/* Inclusion */
+#include <stdio.h>
+#include <stdlib.h>
+#include "benchmark.h"
+#include "../source/File If/FileIf.h"
+
+/* Macros */
+/** The output file used by the benchmark */
+#define FILE_IF_BENCHMARK_PATH			"benchmark_motor.txt"
+/** Number of ticks when opening the file for every line */
+#define FILE_IF_BENCHMARK_REOPEN_TICKS	20000
+/** Number of ticks when using the buffered writer */
+#define FILE_IF_BENCHMARK_BUFFERED_TICKS	10000000
+/** The input file used by the benchmark */
+#define FILE_IF_BENCHMARK_INPUT_PATH	"benchmark_switches.txt"
+/** Number of lines in the benchmark input file */
+#define FILE_IF_BENCHMARK_INPUT_LINES	500000
+
+/* Private functions prototype */
+/**
+ *  \brief Benchmarks reading lines from the input file.
+ *
+ *  \details It compares lines per second of reading the file
+ *  		 character by character using fscanf against the block
+ *  		 \ref FileIf_Reader_t.
+ */
+static void FileIf_ReadBenchmark(void);
+
+/* Functions definition */
+/**
+ *  \brief Benchmarks reading lines from the input file.
+ *
+ *  \details It compares lines per second of reading the file
+ *  		 character by character using fscanf against the block
+ *  		 \ref FileIf_Reader_t.
+ */
+static void FileIf_ReadBenchmark(void)
+{
+	/* Needed variables */
+	static char buffer[FILE_IF_INPUT_BUFFER_SIZE + 1u];
+	FileIf_Reader_t reader;
+	FILE * handler;
+	const char * line;
+	unsigned int length;
+	double start;
+	double fscanfRate;
+	double blockRate;
+	char tempdata;
+	int lines = 0;
+
+	/* Create the input file */
+	handler = fopen(FILE_IF_BENCHMARK_INPUT_PATH, "w");
+	fprintf(handler, "\"+ve\" switch state\t\"-ve\" switch state\t\"p\" switch state\t\"p\" switch press time in ms\n");
+	for (lines = 0; lines < FILE_IF_BENCHMARK_INPUT_LINES; lines++)
+	{
+		fprintf(handler, "released\t\t\tpre_pressed\t\t\tpressed\t\t\t\t%d\n", lines);
+	}
+	fclose(handler);
+
+	/* Character by character */
+	lines = 0;
+	start = Benchmark_GetTimeSec();
+	handler = fopen(FILE_IF_BENCHMARK_INPUT_PATH, "r");
+	while (fscanf(handler, "%c", &tempdata) != EOF)
+	{
+		lines += (tempdata == '\n');
+	}
+	fclose(handler);
+	fscanfRate = lines / (Benchmark_GetTimeSec() - start);
+
+	/* Block reader */
+	lines = 0;
+	start = Benchmark_GetTimeSec();
+	File_ReaderOpen(&reader, FILE_IF_BENCHMARK_INPUT_PATH, buffer, FILE_IF_INPUT_BUFFER_SIZE);
+	while (File_ReaderNextLine(&reader, &line, &length) == FILE_IF_ERROR_OK)
+	{
+		lines++;
+	}
+	blockRate = lines / (Benchmark_GetTimeSec() - start);
+
+	remove(FILE_IF_BENCHMARK_INPUT_PATH);
+
+	Benchmark_Report("file_if.read_line.fscanf", fscanfRate, "lines/s", 1);
+	Benchmark_Report("file_if.read_line.block", blockRate, "lines/s", 1);
+	printf("File_ReadLine fscanf per char   : %12.0f lines/s\n", fscanfRate);
+	printf("File_ReadLine block reader      : %12.0f lines/s (x%.1f)\n",
+		blockRate, blockRate / fscanfRate);
+}
+
+/**
+ *  \brief Benchmarks reading and writing the text files.
+ *
+ *  \details It compares ticks per second of opening, appending
+ *  		 and closing the file per line against the buffered
+ *  		 \ref FileIf_Writer_t and lines per second of fscanf
+ *  		 per character against the block \ref FileIf_Reader_t.
+ */
+void FileIf_Benchmark(void)
+{
+	/* Needed variables */
+	static char buffer[FILE_IF_OUTPUT_BUFFER_SIZE];
+	FileIf_Writer_t writer;
+	FILE * handler;
+	double start;
+	double reopenRate;
+	double bufferedRate;
+	int tick;
+
+	/* Open, append and close per tick */
+	handler = fopen(FILE_IF_BENCHMARK_PATH, "w");
+	fclose(handler);
+	start = Benchmark_GetTimeSec();
+	for (tick = 0; tick < FILE_IF_BENCHMARK_REOPEN_TICKS; tick++)
+	{
+		handler = fopen(FILE_IF_BENCHMARK_PATH, "a");
+		fprintf(handler, "%d\n", 10 + tick % 131);
+		fclose(handler);
+	}
+	reopenRate = FILE_IF_BENCHMARK_REOPEN_TICKS / (Benchmark_GetTimeSec() - start);
+
+	/* Buffered writer */
+	start = Benchmark_GetTimeSec();
+	File_WriterOpen(&writer, FILE_IF_BENCHMARK_PATH, buffer, sizeof(buffer));
+	for (tick = 0; tick < FILE_IF_BENCHMARK_BUFFERED_TICKS; tick++)
+	{
+		File_WriterWriteLine(&writer, 10 + tick % 131);
+	}
+	File_WriterClose(&writer);
+	bufferedRate = FILE_IF_BENCHMARK_BUFFERED_TICKS / (Benchmark_GetTimeSec() - start);
+
+	remove(FILE_IF_BENCHMARK_PATH);
+
+	Benchmark_Report("file_if.write_line.reopen", reopenRate, "ticks/s", 1);
+	Benchmark_Report("file_if.write_line.buffered", bufferedRate, "ticks/s", 1);
+	printf("File_WriteLine open/append/close: %12.0f ticks/s\n", reopenRate);
+	printf("File_WriteLine buffered writer  : %12.0f ticks/s (x%.1f)\n",
+		bufferedRate, bufferedRate / reopenRate);
+
+	FileIf_ReadBenchmark();
+}
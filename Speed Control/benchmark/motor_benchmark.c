@@ -0,0 +1,89 @@
+/**
+ *  \file	motor_benchmark.c
+ *  \brief	This file includes the benchmark of Motor module.
+ *  \author Ahmed Wageh.
+ */
+/* Inclusion */
+#include <stdio.h>
+#include <stdlib.h>
+#include "benchmark.h"
+#include "../source/File If/FileIf.h"
+#include "../source/Motor/Motor.h"
+
+/* Macros */
+/** The output file used by the benchmark */
+#define MOTOR_BENCHMARK_PATH	"benchmark_motor_updates.txt"
+/** Number of motor updates */
+#define MOTOR_BENCHMARK_UPDATES	10000000
+/** Number of updates before the new speed changes */
+#define MOTOR_BENCHMARK_RUN		8
+
+/* Private functions prototype */
+/**
+ *  \brief Updates the motor of one device many times.
+ *
+ *  \param [in] Format The \ref FileIf_OutputFormat_t of the output file.
+ *  \param [out] Speed The last speed of the motor.
+ *  \return Updates per second.
+ */
+static double Motor_BenchmarkUpdates(FileIf_OutputFormat_t Format, int * Speed);
+
+/* Functions definition */
+/**
+ *  \brief Updates the motor of one device many times.
+ *
+ *  \param [in] Format The \ref FileIf_OutputFormat_t of the output file.
+ *  \param [out] Speed The last speed of the motor.
+ *  \return Updates per second.
+ *
+ *  \details The new speeds go up and down out of the motor speed
+ *  		 limitations and change every #MOTOR_BENCHMARK_RUN updates.
+ */
+static double Motor_BenchmarkUpdates(FileIf_OutputFormat_t Format, int * Speed)
+{
+	/* Needed variables */
+	static char buffer[FILE_IF_OUTPUT_BUFFER_SIZE];
+	FileIf_Writer_t writer;
+	Motor_Context_t motor;
+	double start;
+	int update;
+
+	/* Function logic */
+	start = Benchmark_GetTimeSec();
+	File_WriterOpenFormat(&writer, MOTOR_BENCHMARK_PATH, buffer, sizeof(buffer), Format);
+	Motor_ContextInit(&motor, &writer);
+	for (update = 0; update < MOTOR_BENCHMARK_UPDATES; update++)
+	{
+		Motor_ContextUpdateSpeed(&motor, (update / MOTOR_BENCHMARK_RUN) % (2 * MOTOR_MAXIMUM_SPEED));
+	}
+	File_WriterClose(&writer);
+	*Speed = Motor_ContextGetSpeed(&motor);
+
+	return MOTOR_BENCHMARK_UPDATES / (Benchmark_GetTimeSec() - start);
+}
+
+/**
+ *  \brief Benchmarks the Motor module.
+ *
+ *  \details It prints updates per second of \ref Motor_ContextUpdateSpeed
+ *  		 writing text lines and run-length runs, both motors must
+ *  		 end at the same speed.
+ */
+void Motor_Benchmark(void)
+{
+	/* Needed variables */
+	double textRate;
+	double runLengthRate;
+	int textSpeed;
+	int runLengthSpeed;
+
+	textRate = Motor_BenchmarkUpdates(FILE_IF_OUTPUT_FORMAT_TEXT, &textSpeed);
+	runLengthRate = Motor_BenchmarkUpdates(FILE_IF_OUTPUT_FORMAT_RUN_LENGTH, &runLengthSpeed);
+	remove(MOTOR_BENCHMARK_PATH);
+
+	Benchmark_Report("motor.update_speed.text", textRate, "updates/s", 1);
+	Benchmark_Report("motor.update_speed.run_length", runLengthRate, "updates/s", textSpeed == runLengthSpeed);
+	printf("Motor_UpdateSpeed text lines    : %12.0f updates/s\n", textRate);
+	printf("Motor_UpdateSpeed run-length    : %12.0f updates/s (x%.1f)%s\n",
+		runLengthRate, runLengthRate / textRate, (textSpeed == runLengthSpeed) ? "" : " MISMATCH");
+}
@@ -0,0 +1,285 @@
+/**
+ *  \file	parse_benchmark.c
+ *  \brief	This file includes the benchmark of Parse module.
+ *  \author Ahmed Wageh.
+ */
+/* Inclusion */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "benchmark.h"
+#include "../source/Parse/Parse.h"
+#include "../source/Parse/ParseScan.h"
+
+/* Macros */
+/** Number of classified tokens */
+#define PARSE_BENCHMARK_TOKENS	4000000
+/** Number of parsed lines */
+#define PARSE_BENCHMARK_LINES	1000000
+/** Maximum number of tabs between two columns */
+#define PARSE_BENCHMARK_MAX_TABS	24
+
+/* Private functions prototype */
+/**
+ *  \brief The strcmp chain that was used to classify a switch state text.
+ *
+ *  \param [in] text Null terminated switch state text.
+ *  \return \ref Switches_States_t type data.
+ */
+static Switches_States_t Parse_StrcmpCheckText(const char * text);
+
+/**
+ *  \brief Compares the strcmp chain with \ref ParseSwitchState.
+ */
+static void Parse_BenchmarkCheckText(void);
+
+/**
+ *  \brief Parses tab padded lines with every \ref ParseScan_Level_t.
+ */
+static void Parse_BenchmarkScan(void);
+
+/**
+ *  \brief Compares atoi with \ref ParseDuration.
+ */
+static void Parse_BenchmarkDuration(void);
+
+/* Functions definition */
+/**
+ *  \brief The strcmp chain that was used to classify a switch state text.
+ *
+ *  \param [in] text Null terminated switch state text.
+ *  \return \ref Switches_States_t type data.
+ */
+static Switches_States_t Parse_StrcmpCheckText(const char * text)
+{
+	Switches_States_t retState = SWITCH_ERROR;
+
+	if (strcmp(text, PRE_PRESSED_TEXT) == 0)
+	{
+		retState = SWITCH_PRE_PRESSED;
+	}
+	else if (strcmp(text, PRESSED_TEXT) == 0)
+	{
+		retState = SWITCH_PRESSED;
+	}
+	else if (strcmp(text, RELEASED_TEXT) == 0)
+	{
+		retState = SWITCH_RELEASED;
+	}
+	else if (strcmp(text, PRE_RELEASED_TEXT) == 0)
+	{
+		retState = SWITCH_PRE_RELEASED;
+	}
+
+	return retState;
+}
+
+/**
+ *  \brief Compares the strcmp chain with \ref ParseSwitchState.
+ *
+ *  \details It classifies the same random tokens with the old strcmp
+ *  		 chain and with \ref ParseSwitchState and prints tokens per
+ *  		 second of both.
+ */
+static void Parse_BenchmarkCheckText(void)
+{
+	/* Needed variables */
+	static const char * tokens[] =
+	{
+		PRE_PRESSED_TEXT, PRESSED_TEXT, RELEASED_TEXT, PRE_RELEASED_TEXT,
+		RELEASED_TEXT, RELEASED_TEXT, "pressedx", "pre_release"
+	};
+	unsigned int lengths[sizeof(tokens) / sizeof(tokens[0])];
+	unsigned char * order;
+	unsigned long strcmpSum = 0;
+	unsigned long classifierSum = 0;
+	double start;
+	double strcmpRate;
+	double classifierRate;
+	int index;
+
+	/* Random order of tokens, the same for both classifiers */
+	order = malloc(PARSE_BENCHMARK_TOKENS);
+	srand(1);
+	for (index = 0; index < PARSE_BENCHMARK_TOKENS; index++)
+	{
+		order[index] = (unsigned char)(rand() % (int)(sizeof(tokens) / sizeof(tokens[0])));
+	}
+	for (index = 0; index < (int)(sizeof(tokens) / sizeof(tokens[0])); index++)
+	{
+		lengths[index] = (unsigned int)strlen(tokens[index]);
+	}
+
+	start = Benchmark_GetTimeSec();
+	for (index = 0; index < PARSE_BENCHMARK_TOKENS; index++)
+	{
+		strcmpSum += Parse_StrcmpCheckText(tokens[order[index]]);
+	}
+	strcmpRate = PARSE_BENCHMARK_TOKENS / (Benchmark_GetTimeSec() - start);
+
+	start = Benchmark_GetTimeSec();
+	for (index = 0; index < PARSE_BENCHMARK_TOKENS; index++)
+	{
+		classifierSum += ParseSwitchState(tokens[order[index]], lengths[order[index]]);
+	}
+	classifierRate = PARSE_BENCHMARK_TOKENS / (Benchmark_GetTimeSec() - start);
+
+	free(order);
+
+	Benchmark_Report("parse.check_text.strcmp", strcmpRate, "tokens/s", 1);
+	Benchmark_Report("parse.check_text.length", classifierRate, "tokens/s", strcmpSum == classifierSum);
+	printf("Parse_CheckText strcmp chain    : %12.0f tokens/s\n", strcmpRate);
+	printf("Parse_CheckText length dispatch : %12.0f tokens/s (x%.1f)%s\n",
+		classifierRate, classifierRate / strcmpRate,
+		(strcmpSum == classifierSum) ? "" : " MISMATCH");
+}
+
+/**
+ *  \brief Parses tab padded lines with every \ref ParseScan_Level_t.
+ *
+ *  \details The lines look like the lines of switches.txt with 1 to
+ *  		 #PARSE_BENCHMARK_MAX_TABS tabs between columns. Every line is
+ *  		 parsed by \ref ParseRecord and MB/s of every level is printed.
+ */
+static void Parse_BenchmarkScan(void)
+{
+	/* Needed variables */
+	static const char * names[] = {"scalar", "SSE2", "AVX2"};
+	char name[BENCHMARK_MAX_NAME_SIZE];
+	static const char * states[] = {PRE_PRESSED_TEXT, PRESSED_TEXT, RELEASED_TEXT, PRE_RELEASED_TEXT};
+	char * text;
+	unsigned int * lineStart;
+	unsigned int size = 0;
+	unsigned long checkSum;
+	unsigned long firstCheckSum = 0;
+	Parse_Record_t record;
+	ParseScan_Level_t level;
+	double start;
+	double rate;
+	double scalarRate = 0;
+	int line;
+	int column;
+	int tabs;
+
+	/* Generate the lines */
+	text = malloc((size_t)PARSE_BENCHMARK_LINES * (4u * (PARSE_BENCHMARK_MAX_TABS + 13u) + 1u));
+	lineStart = malloc(((size_t)PARSE_BENCHMARK_LINES + 1u) * sizeof(unsigned int));
+	srand(2);
+	for (line = 0; line < PARSE_BENCHMARK_LINES; line++)
+	{
+		lineStart[line] = size;
+		for (column = 0; column < 4; column++)
+		{
+			if (column < 3)
+			{
+				size += (unsigned int)sprintf(text + size, "%s", states[rand() % 4]);
+			}
+			else
+			{
+				size += (unsigned int)sprintf(text + size, "%d", rand() % 200000);
+			}
+			for (tabs = (column < 3) ? 1 + rand() % PARSE_BENCHMARK_MAX_TABS : 0; tabs > 0; tabs--)
+			{
+				text[size++] = '\t';
+			}
+		}
+		text[size++] = '\n';
+	}
+	lineStart[PARSE_BENCHMARK_LINES] = size;
+
+	for (level = PARSE_SCAN_LEVEL_SCALAR; level <= ParseScan_GetBestLevel(); level++)
+	{
+		ParseScan_SelectLevel(level);
+		checkSum = 0;
+		start = Benchmark_GetTimeSec();
+		for (line = 0; line < PARSE_BENCHMARK_LINES; line++)
+		{
+			ParseRecord(text + lineStart[line], lineStart[line + 1] - lineStart[line] - 1u, &record);
+			checkSum += (unsigned long)record.P_Switch + (unsigned long)record.P_Duration;
+		}
+		rate = size / (Benchmark_GetTimeSec() - start) / (1024.0 * 1024.0);
+		if (level == PARSE_SCAN_LEVEL_SCALAR)
+		{
+			scalarRate = rate;
+			firstCheckSum = checkSum;
+		}
+		snprintf(name, sizeof(name), "parse.record.%s", names[level]);
+		Benchmark_Report(name, rate, "MB/s", checkSum == firstCheckSum);
+		printf("ParseRecord %-6s scanning     : %12.1f MB/s (x%.1f)%s\n", names[level], rate,
+			rate / scalarRate, (checkSum == firstCheckSum) ? "" : " MISMATCH");
+	}
+	ParseScan_SelectLevel(ParseScan_GetBestLevel());
+
+	free(lineStart);
+	free(text);
+}
+
+/**
+ *  \brief Compares atoi with \ref ParseDuration.
+ *
+ *  \details It decodes the same random durations of 1 to 9 digits
+ *  		 with atoi and with \ref ParseDuration and prints values per
+ *  		 second of both.
+ */
+static void Parse_BenchmarkDuration(void)
+{
+	/* Needed variables */
+	char * text;
+	unsigned int * valueStart;
+	unsigned int size = 0;
+	long atoiSum = 0;
+	long decoderSum = 0;
+	double start;
+	double atoiRate;
+	double decoderRate;
+	int duration;
+	int index;
+
+	/* Generate the durations, every one ends with a new line */
+	text = malloc((size_t)PARSE_BENCHMARK_TOKENS * 11u);
+	valueStart = malloc(((size_t)PARSE_BENCHMARK_TOKENS + 1u) * sizeof(unsigned int));
+	srand(3);
+	for (index = 0; index < PARSE_BENCHMARK_TOKENS; index++)
+	{
+		valueStart[index] = size;
+		size += (unsigned int)sprintf(text + size, "%d\n", rand() % (1 + 300000 * (index % 3000)));
+	}
+	valueStart[PARSE_BENCHMARK_TOKENS] = size;
+
+	start = Benchmark_GetTimeSec();
+	for (index = 0; index < PARSE_BENCHMARK_TOKENS; index++)
+	{
+		atoiSum += atoi(text + valueStart[index]);
+	}
+	atoiRate = PARSE_BENCHMARK_TOKENS / (Benchmark_GetTimeSec() - start);
+
+	start = Benchmark_GetTimeSec();
+	for (index = 0; index < PARSE_BENCHMARK_TOKENS; index++)
+	{
+		ParseDuration(text + valueStart[index], valueStart[index + 1] - valueStart[index], &duration);
+		decoderSum += duration;
+	}
+	decoderRate = PARSE_BENCHMARK_TOKENS / (Benchmark_GetTimeSec() - start);
+
+	free(valueStart);
+	free(text);
+
+	Benchmark_Report("parse.duration.atoi", atoiRate, "values/s", 1);
+	Benchmark_Report("parse.duration.swar", decoderRate, "values/s", atoiSum == decoderSum);
+	printf("ParsePDuaration atoi            : %12.0f values/s\n", atoiRate);
+	printf("ParsePDuaration SWAR decoder    : %12.0f values/s (x%.1f)%s\n",
+		decoderRate, decoderRate / atoiRate, (atoiSum == decoderSum) ? "" : " MISMATCH");
+}
+
+/**
+ *  \brief Benchmarks the Parse module.
+ *
+ *  \details It compares the switch state text classifiers, the
+ *  		 scanning levels of \ref ParseRecord and the duration decoders.
+ */
+void Parse_Benchmark(void)
+{
+	Parse_BenchmarkCheckText();
+	Parse_BenchmarkScan();
+	Parse_BenchmarkDuration();
+}
@@ -0,0 +1,257 @@
+/**
+ *  \file	replay_benchmark.c
+ *  \brief	This file includes the end to end replay benchmark.
+ *  \author Ahmed Wageh.
+ */
+/* Inclusion */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "benchmark.h"
+#include "../source/Chunk/Chunk.h"
+#include "../source/Device/Device.h"
+#include "../source/Generate/Generate.h"
+#include "../source/Speed Control/SpeedControl.h"
+
+/* Macros */
+/** The input file used by the benchmark */
+#define REPLAY_BENCHMARK_INPUT_PATH		"benchmark_replay_switches.txt"
+/** The output file used by the benchmark */
+#define REPLAY_BENCHMARK_OUTPUT_PATH	"benchmark_replay_motor.txt"
+/** The output file of replaying by chunks */
+#define REPLAY_BENCHMARK_CHUNK_OUTPUT_PATH	"benchmark_replay_chunk_motor.txt"
+/** The number of threads generating the input file */
+#define REPLAY_BENCHMARK_WORKERS		4u
+/** The numbers of workers parsing the chunks of the input file */
+#define REPLAY_BENCHMARK_CHUNK_WORKERS	{1u, 2u, 4u}
+/** The size of the blocks compared by \ref Replay_BenchmarkSameFiles */
+#define REPLAY_BENCHMARK_COMPARE_SIZE	(64u * 1024u)
+
+/* Private functions prototype */
+/**
+ *  \brief Replays the input file.
+ *
+ *  \param [in] FastForward 0 to replay line by line, otherwise runs of
+ *  			lines are replayed by \ref SpeedControl_ContextReplay.
+ *  \param [out] Lines The number of replayed lines.
+ *  \param [out] Speed The last speed of the motor.
+ *  \return The replay time in seconds.
+ */
+static double Replay_BenchmarkRun(int FastForward, unsigned long long * Lines, int * Speed);
+
+/**
+ *  \brief Replays the input file by \ref Chunk_Run.
+ *
+ *  \param [in] Workers The number of workers parsing the chunks.
+ *  \param [out] Speed The last speed of the motor.
+ *  \return The replay time in seconds.
+ */
+static double Replay_BenchmarkRunChunks(unsigned int Workers, int * Speed);
+
+/**
+ *  \brief Compares two files.
+ *
+ *  \param [in] First The path of the first file.
+ *  \param [in] Second The path of the second file.
+ *  \return Not 0 if both files are read and they are the same.
+ */
+static int Replay_BenchmarkSameFiles(const char * First, const char * Second);
+
+/* Functions definition */
+/**
+ *  \brief Replays the input file.
+ *
+ *  \param [in] FastForward 0 to replay line by line, otherwise runs of
+ *  			lines are replayed by \ref SpeedControl_ContextReplay.
+ *  \param [out] Lines The number of replayed lines.
+ *  \param [out] Speed The last speed of the motor.
+ *  \return The replay time in seconds.
+ *
+ *  \details The time includes opening and closing the files.
+ */
+static double Replay_BenchmarkRun(int FastForward, unsigned long long * Lines, int * Speed)
+{
+	/* Needed variables */
+	static Device_t device;
+	char * readBuffer = malloc(FILE_IF_INPUT_BUFFER_SIZE + 1u);
+	char * writeBuffer = malloc(FILE_IF_OUTPUT_BUFFER_SIZE);
+	unsigned long long skipped;
+	double retTime;
+
+	/* Function logic */
+	*Lines = 0;
+	*Speed = 0;
+	retTime = Benchmark_GetTimeSec();
+	if (readBuffer != NULL && writeBuffer != NULL &&
+		Device_Open(&device, REPLAY_BENCHMARK_INPUT_PATH, REPLAY_BENCHMARK_OUTPUT_PATH, readBuffer,
+			FILE_IF_INPUT_BUFFER_SIZE, writeBuffer, FILE_IF_OUTPUT_BUFFER_SIZE) == FILE_IF_ERROR_OK)
+	{
+		if (FastForward)
+		{
+			*Lines = SpeedControl_ContextReplay(&device.Switches, &device.Motor, &skipped);
+		}
+		else
+		{
+			while (Device_Step(&device) == SWITCH_UPDATE_OK)
+			{
+				(*Lines)++;
+			}
+		}
+		*Speed = Motor_ContextGetSpeed(&device.Motor);
+		Device_Close(&device);
+	}
+	retTime = Benchmark_GetTimeSec() - retTime;
+	free(readBuffer);
+	free(writeBuffer);
+
+	return retTime;
+}
+
+/**
+ *  \brief Replays the input file by \ref Chunk_Run.
+ *
+ *  \param [in] Workers The number of workers parsing the chunks.
+ *  \param [out] Speed The last speed of the motor.
+ *  \return The replay time in seconds.
+ *
+ *  \details The time includes opening and closing the files. The motor
+ *  		 angles are written to #REPLAY_BENCHMARK_CHUNK_OUTPUT_PATH.
+ */
+static double Replay_BenchmarkRunChunks(unsigned int Workers, int * Speed)
+{
+	/* Needed variables */
+	static Device_t device;
+	char * readBuffer = malloc(FILE_IF_INPUT_BUFFER_SIZE + 1u);
+	char * writeBuffer = malloc(FILE_IF_OUTPUT_BUFFER_SIZE);
+	double retTime;
+
+	/* Function logic */
+	*Speed = 0;
+	retTime = Benchmark_GetTimeSec();
+	if (readBuffer != NULL && writeBuffer != NULL &&
+		Device_Open(&device, REPLAY_BENCHMARK_INPUT_PATH, REPLAY_BENCHMARK_CHUNK_OUTPUT_PATH, readBuffer,
+			FILE_IF_INPUT_BUFFER_SIZE, writeBuffer, FILE_IF_OUTPUT_BUFFER_SIZE) == FILE_IF_ERROR_OK)
+	{
+		if (Chunk_Run(&device.Switches, &device.Motor, Workers, 0u) != CHUNK_ERROR_OK)
+		{
+			*Speed = -1;
+		}
+		else
+		{
+			*Speed = Motor_ContextGetSpeed(&device.Motor);
+		}
+		Device_Close(&device);
+	}
+	retTime = Benchmark_GetTimeSec() - retTime;
+	free(readBuffer);
+	free(writeBuffer);
+
+	return retTime;
+}
+
+/**
+ *  \brief Compares two files.
+ *
+ *  \param [in] First The path of the first file.
+ *  \param [in] Second The path of the second file.
+ *  \return Not 0 if both files are read and they are the same.
+ */
+static int Replay_BenchmarkSameFiles(const char * First, const char * Second)
+{
+	/* Needed variables */
+	static char firstBlock[REPLAY_BENCHMARK_COMPARE_SIZE];
+	static char secondBlock[REPLAY_BENCHMARK_COMPARE_SIZE];
+	FILE * first = fopen(First, "rb");
+	FILE * second = fopen(Second, "rb");
+	size_t firstCount = 1;
+	size_t secondCount = 1;
+	int retSame = (first != NULL && second != NULL);
+
+	/* Function logic */
+	while (retSame && firstCount != 0u)
+	{
+		firstCount = fread(firstBlock, 1, sizeof(firstBlock), first);
+		secondCount = fread(secondBlock, 1, sizeof(secondBlock), second);
+		retSame = (firstCount == secondCount && memcmp(firstBlock, secondBlock, firstCount) == 0);
+	}
+	if (first != NULL)
+	{
+		fclose(first);
+	}
+	if (second != NULL)
+	{
+		fclose(second);
+	}
+
+	return retSame;
+}
+
+/**
+ *  \brief Benchmarks replaying a whole input file end to end.
+ *
+ *  \param [in] Lines The number of lines of the generated input file.
+ *  \return None.
+ *
+ *  \details It generates the input file by \ref Generate_File with the
+ *  		 default model, then it prints lines per
+ *  		 second and MB/s of replaying it line by line by \ref Device_Step
+ *  		 and by fast-forwarding runs by \ref SpeedControl_ContextReplay.
+ *  		 Both must replay all lines and end at the same speed. Then it
+ *  		 prints the speedup of parsing chunks of the file on 1, 2 and 4
+ *  		 workers by \ref Chunk_Run, they must write the same motor file.
+ */
+void Replay_Benchmark(unsigned long long Lines)
+{
+	/* Needed variables */
+	static const unsigned int chunkWorkers[] = REPLAY_BENCHMARK_CHUNK_WORKERS;
+	char name[BENCHMARK_MAX_NAME_SIZE];
+	Generate_Config_t config;
+	unsigned long long size = 0;
+	unsigned long long serialLines;
+	unsigned long long fastLines;
+	double serialTime;
+	double fastTime;
+	double chunkTime;
+	int serialSpeed;
+	int fastSpeed;
+	int chunkSpeed;
+	int valid;
+	int chunkValid;
+	unsigned int index;
+
+	Generate_DefaultConfig(&config);
+	if (Generate_File(REPLAY_BENCHMARK_INPUT_PATH, Lines, &config, REPLAY_BENCHMARK_WORKERS, &size) !=
+		GENERATE_ERROR_OK)
+	{
+		size = 0;
+	}
+	serialTime = Replay_BenchmarkRun(0, &serialLines, &serialSpeed);
+	fastTime = Replay_BenchmarkRun(1, &fastLines, &fastSpeed);
+	valid = (size != 0u && serialLines == Lines && fastLines == Lines && serialSpeed == fastSpeed);
+
+	snprintf(name, sizeof(name), "replay.%llu.serial", Lines);
+	Benchmark_Report(name, (double)Lines / serialTime, "lines/s", valid);
+	snprintf(name, sizeof(name), "replay.%llu.serial_throughput", Lines);
+	Benchmark_Report(name, (double)size / serialTime / (1024.0 * 1024.0), "MB/s", valid);
+	snprintf(name, sizeof(name), "replay.%llu.fast_forward", Lines);
+	Benchmark_Report(name, (double)Lines / fastTime, "lines/s", valid);
+	printf("Replay %11llu lines line by line : %12.0f lines/s (%.1f MB/s)%s\n", Lines,
+		(double)Lines / serialTime, (double)size / serialTime / (1024.0 * 1024.0), valid ? "" : " MISMATCH");
+	printf("Replay %11llu lines fast-forward : %12.0f lines/s (x%.1f)%s\n", Lines,
+		(double)Lines / fastTime, serialTime / fastTime, valid ? "" : " MISMATCH");
+
+	/* The output of fast-forwarding is the same as replaying line by line */
+	for (index = 0; index < sizeof(chunkWorkers) / sizeof(chunkWorkers[0]); index++)
+	{
+		chunkTime = Replay_BenchmarkRunChunks(chunkWorkers[index], &chunkSpeed);
+		chunkValid = (valid && chunkSpeed == serialSpeed &&
+			Replay_BenchmarkSameFiles(REPLAY_BENCHMARK_OUTPUT_PATH, REPLAY_BENCHMARK_CHUNK_OUTPUT_PATH));
+		snprintf(name, sizeof(name), "replay.%llu.parallel_parse.%u", Lines, chunkWorkers[index]);
+		Benchmark_Report(name, (double)Lines / chunkTime, "lines/s", chunkValid);
+		printf("Replay %11llu lines %u parse workers: %12.0f lines/s (x%.2f)%s\n", Lines, chunkWorkers[index],
+			(double)Lines / chunkTime, serialTime / chunkTime, chunkValid ? "" : " MISMATCH");
+	}
+	remove(REPLAY_BENCHMARK_INPUT_PATH);
+	remove(REPLAY_BENCHMARK_OUTPUT_PATH);
+	remove(REPLAY_BENCHMARK_CHUNK_OUTPUT_PATH);
+}
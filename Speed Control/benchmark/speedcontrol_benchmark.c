@@ -0,0 +1,130 @@
+/**
+ *  \file	speedcontrol_benchmark.c
+ *  \brief	This file includes the benchmark of Speed Control module.
+ *  \author Ahmed Wageh.
+ */
+/* Inclusion */
+#include <stdio.h>
+#include <stdlib.h>
+#include "benchmark.h"
+#include "../source/Speed Control/SpeedControl.h"
+
+/* Macros */
+/** Number of devices in every tick */
+#define SPEED_CONTROL_BENCHMARK_DEVICES	100000
+/** Number of ticks, it must be even */
+#define SPEED_CONTROL_BENCHMARK_TICKS	200
+
+/* Functions definition */
+/**
+ *  \brief Benchmarks the Speed Control module.
+ *
+ *  \details It steps #SPEED_CONTROL_BENCHMARK_DEVICES devices for
+ *  		 #SPEED_CONTROL_BENCHMARK_TICKS ticks by calling
+ *  		 \ref SpeedControl_CalcSpeed for every device and by calling
+ *  		 \ref SpeedControl_CalcSpeedBatch once per tick and by calling
+ *  		 \ref SpeedControl_TableCalcSpeed for every device and prints
+ *  		 devices per second of all of them.
+ */
+void SpeedControl_Benchmark(void)
+{
+	/* Needed variables */
+	static const Switches_States_t states[] = {SWITCH_RELEASED, SWITCH_RELEASED, SWITCH_RELEASED,
+		SWITCH_PRE_PRESSED, SWITCH_PRESSED, SWITCH_PRE_RELEASED};
+	Switches_States_t * inc;
+	Switches_States_t * dec;
+	Switches_States_t * p;
+	int * duration;
+	int * speed;
+	int * oneSpeed;
+	int * batchSpeed;
+	int * tableSpeed;
+	double start;
+	double oneRate;
+	double batchRate;
+	double tableRate;
+	int mismatch = 0;
+	int tableMismatch = 0;
+	int tick;
+	int index;
+
+	/* Random devices, the same for both ways */
+	inc = malloc(SPEED_CONTROL_BENCHMARK_DEVICES * sizeof(Switches_States_t));
+	dec = malloc(SPEED_CONTROL_BENCHMARK_DEVICES * sizeof(Switches_States_t));
+	p = malloc(SPEED_CONTROL_BENCHMARK_DEVICES * sizeof(Switches_States_t));
+	duration = malloc(SPEED_CONTROL_BENCHMARK_DEVICES * sizeof(int));
+	speed = malloc(SPEED_CONTROL_BENCHMARK_DEVICES * sizeof(int));
+	oneSpeed = malloc(SPEED_CONTROL_BENCHMARK_DEVICES * sizeof(int));
+	batchSpeed = malloc(SPEED_CONTROL_BENCHMARK_DEVICES * sizeof(int));
+	tableSpeed = malloc(SPEED_CONTROL_BENCHMARK_DEVICES * sizeof(int));
+	srand(1);
+	for (index = 0; index < SPEED_CONTROL_BENCHMARK_DEVICES; index++)
+	{
+		inc[index] = states[rand() % (int)(sizeof(states) / sizeof(states[0]))];
+		dec[index] = states[rand() % (int)(sizeof(states) / sizeof(states[0]))];
+		p[index] = states[rand() % (int)(sizeof(states) / sizeof(states[0]))];
+		duration[index] = rand() % 200000;
+		speed[index] = MOTOR_MINIMUM_SPEED + rand() % (MOTOR_MAXIMUM_SPEED - MOTOR_MINIMUM_SPEED + 1);
+		oneSpeed[index] = speed[index];
+		batchSpeed[index] = speed[index];
+		tableSpeed[index] = speed[index];
+	}
+
+	/* One device per call, every tick starts from the speeds of the last tick */
+	start = Benchmark_GetTimeSec();
+	for (tick = 0; tick < SPEED_CONTROL_BENCHMARK_TICKS; tick++)
+	{
+		for (index = 0; index < SPEED_CONTROL_BENCHMARK_DEVICES; index++)
+		{
+			oneSpeed[index] = SpeedControl_CalcSpeed(inc[index], dec[index], p[index],
+				duration[index], oneSpeed[index]);
+		}
+	}
+	oneRate = (double)SPEED_CONTROL_BENCHMARK_DEVICES * SPEED_CONTROL_BENCHMARK_TICKS / (Benchmark_GetTimeSec() - start);
+
+	/* All devices per call, two ticks per loop to swap the speeds and the new speeds */
+	start = Benchmark_GetTimeSec();
+	for (tick = 0; tick < SPEED_CONTROL_BENCHMARK_TICKS; tick += 2)
+	{
+		SpeedControl_CalcSpeedBatch(inc, dec, p, duration, batchSpeed, speed, SPEED_CONTROL_BENCHMARK_DEVICES);
+		SpeedControl_CalcSpeedBatch(inc, dec, p, duration, speed, batchSpeed, SPEED_CONTROL_BENCHMARK_DEVICES);
+	}
+	batchRate = (double)SPEED_CONTROL_BENCHMARK_DEVICES * SPEED_CONTROL_BENCHMARK_TICKS / (Benchmark_GetTimeSec() - start);
+
+	/* One device per call by the tables, they are generated before the time starts */
+	SpeedControl_TableInit();
+	start = Benchmark_GetTimeSec();
+	for (tick = 0; tick < SPEED_CONTROL_BENCHMARK_TICKS; tick++)
+	{
+		for (index = 0; index < SPEED_CONTROL_BENCHMARK_DEVICES; index++)
+		{
+			tableSpeed[index] = SpeedControl_TableCalcSpeed(inc[index], dec[index], p[index],
+				duration[index], tableSpeed[index]);
+		}
+	}
+	tableRate = (double)SPEED_CONTROL_BENCHMARK_DEVICES * SPEED_CONTROL_BENCHMARK_TICKS / (Benchmark_GetTimeSec() - start);
+
+	for (index = 0; index < SPEED_CONTROL_BENCHMARK_DEVICES; index++)
+	{
+		mismatch |= (oneSpeed[index] != batchSpeed[index]);
+		tableMismatch |= (oneSpeed[index] != tableSpeed[index]);
+	}
+
+	free(inc);
+	free(dec);
+	free(p);
+	free(duration);
+	free(speed);
+	free(oneSpeed);
+	free(batchSpeed);
+	free(tableSpeed);
+
+	Benchmark_Report("speed_control.calc_speed", oneRate, "devices/s", 1);
+	Benchmark_Report("speed_control.calc_speed_batch", batchRate, "devices/s", !mismatch);
+	Benchmark_Report("speed_control.calc_speed_table", tableRate, "devices/s", !tableMismatch);
+	printf("SpeedControl_CalcSpeed per device : %12.0f devices/s\n", oneRate);
+	printf("SpeedControl_CalcSpeedBatch       : %12.0f devices/s (x%.1f)%s\n",
+		batchRate, batchRate / oneRate, mismatch ? " MISMATCH" : "");
+	printf("SpeedControl_TableCalcSpeed       : %12.0f devices/s (x%.1f)%s\n",
+		tableRate, tableRate / oneRate, tableMismatch ? " MISMATCH" : "");
+}
@@ -0,0 +1,88 @@
+/**
+ *  \file	trace_benchmark.c
+ *  \brief	This file includes the benchmark of Trace module.
+ *  \author Ahmed Wageh.
+ */
+/* Inclusion */
+#include <stdio.h>
+#include <stdlib.h>
+#include "benchmark.h"
+#include "../source/Parse/Parse.h"
+#include "../source/Trace/Trace.h"
+
+/* Macros */
+/** Number of lines */
+#define TRACE_BENCHMARK_LINES	1000000
+
+/* Functions definition */
+/**
+ *  \brief Benchmarks the Trace module.
+ *
+ *  \details It makes tab separated lines like the lines of switches.txt
+ *  		 and their trace records, then it prints the sizes and lines
+ *  		 per second of \ref ParseRecord and \ref Trace_DecodeRecord.
+ */
+void Trace_Benchmark(void)
+{
+	/* Needed variables */
+	static const char * states[] = {PRE_PRESSED_TEXT, PRESSED_TEXT, RELEASED_TEXT, RELEASED_TEXT,
+		RELEASED_TEXT, PRE_RELEASED_TEXT};
+	char * text;
+	unsigned char * trace;
+	unsigned int * lineStart;
+	unsigned int textSize = 0;
+	unsigned int traceSize = 0;
+	unsigned int used;
+	unsigned int length;
+	unsigned long parseSum = 0;
+	unsigned long traceSum = 0;
+	Parse_Record_t record;
+	double start;
+	double parseRate;
+	double traceRate;
+	int line;
+
+	/* Generate the lines and encode them */
+	text = malloc((size_t)TRACE_BENCHMARK_LINES * 64u);
+	trace = malloc((size_t)TRACE_BENCHMARK_LINES * TRACE_RECORD_MAX_SIZE);
+	lineStart = malloc(((size_t)TRACE_BENCHMARK_LINES + 1u) * sizeof(unsigned int));
+	srand(3);
+	for (line = 0; line < TRACE_BENCHMARK_LINES; line++)
+	{
+		lineStart[line] = textSize;
+		textSize += (unsigned int)sprintf(text + textSize, "%s\t%s\t%s\t%d\n", states[rand() % 6],
+			states[rand() % 6], states[rand() % 6], (rand() % 4 == 0) ? rand() % 200000 : 0);
+		ParseRecord(text + lineStart[line], textSize - lineStart[line] - 1u, &record);
+		traceSize += Trace_EncodeRecord(&record, trace + traceSize);
+	}
+	lineStart[TRACE_BENCHMARK_LINES] = textSize;
+
+	start = Benchmark_GetTimeSec();
+	for (line = 0; line < TRACE_BENCHMARK_LINES; line++)
+	{
+		ParseRecord(text + lineStart[line], lineStart[line + 1] - lineStart[line] - 1u, &record);
+		parseSum += (unsigned long)record.Inc_Switch + (unsigned long)record.P_Duration;
+	}
+	parseRate = TRACE_BENCHMARK_LINES / (Benchmark_GetTimeSec() - start);
+
+	start = Benchmark_GetTimeSec();
+	for (used = 0; used < traceSize; )
+	{
+		used += (Trace_DecodeRecord(trace + used, traceSize - used, &record, &length) == TRACE_ERROR_OK) ?
+			length : traceSize;
+		traceSum += (unsigned long)record.Inc_Switch + (unsigned long)record.P_Duration;
+	}
+	traceRate = TRACE_BENCHMARK_LINES / (Benchmark_GetTimeSec() - start);
+
+	free(lineStart);
+	free(trace);
+	free(text);
+
+	Benchmark_Report("trace.parse_record", parseRate, "lines/s", 1);
+	Benchmark_Report("trace.decode_record", traceRate, "lines/s", parseSum == traceSum);
+	Benchmark_Report("trace.size_ratio", (double)textSize / traceSize, "x", 1);
+	printf("Text lines  %9u bytes, ParseRecord        : %12.0f lines/s\n", textSize, parseRate);
+	printf("Trace file  %9u bytes, Trace_DecodeRecord : %12.0f lines/s (x%.1f smaller, x%.1f faster)%s\n",
+		traceSize, traceRate, (double)textSize / traceSize, traceRate / parseRate,
+		(parseSum == traceSum) ? "" : " MISMATCH");
+}
@@ -0,0 +1,454 @@
+/**
+ *  \file	Chunk.c
+ *  \brief	This file is the implementation of replaying one device
+ *  		by parsing chunks of its input file in parallel.
+ *  \author Ahmed Wageh.
+ */
+/* Inclusion */
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "Chunk.h"
+#include "../File If/FileIf.h"
+#include "../Parse/Parse.h"
+#include "../Speed Control/SpeedControl.h"
+
+/* User-defined data types */
+/**
+ *  This struct holds the state of replaying one device by chunks.
+ */
+struct Chunk_t
+{
+	/** The switches of the replayed device */
+	Switches_Context_t * Switches;
+	/** The motor of the replayed device */
+	Motor_Context_t * Motor;
+	/** The size of a chunk in bytes */
+	unsigned int Size;
+	/** Protects the members after it and the input file */
+	pthread_mutex_t Lock;
+	/** Signaled when a chunk is scanned or replayed */
+	pthread_cond_t Turn_Signal;
+	/** The index of the next read chunk */
+	unsigned long long Next_Chunk;
+	/** The number of chunks whose first speed is known */
+	unsigned long long Scanned_Chunks;
+	/** The motor speed before the first line of the next scanned chunk */
+	int Speed;
+	/** The number of replayed chunks */
+	unsigned long long Replayed_Chunks;
+	/** Not 0 if all chunks are read */
+	int End_Of_File;
+};
+typedef struct Chunk_t Chunk_t;
+
+/**
+ *  This struct is one worker thread.
+ */
+struct Chunk_Worker_t
+{
+	/** The thread of the worker */
+	pthread_t Thread;
+	/** The replayed device */
+	Chunk_t * Chunk;
+	/** The text of one chunk, it has a byte for the terminator */
+	char * Text;
+	/** The records of the lines of \p Text */
+	Parse_Record_t * Records;
+	/** The motor speed after every record of \p Records */
+	int * Speeds;
+	/** The number of records that \p Records and \p Speeds can hold */
+	unsigned int Records_Size;
+};
+typedef struct Chunk_Worker_t Chunk_Worker_t;
+
+/* Private functions prototype */
+/**
+ *  \brief Parses the next line of a chunk.
+ *
+ *  \param [in] Text The text of the chunk.
+ *  \param [in] Length The number of bytes of the chunk.
+ *  \param [in,out] Start The offset of the next line, it becomes the
+ *  			offset after the parsed line.
+ *  \param [out] Record The record of the line.
+ *  \return Not 0 if a line is parsed, 0 at the end of the chunk.
+ */
+static int Chunk_ParseLine(const char * Text, unsigned int Length, unsigned int * Start, Parse_Record_t * Record);
+
+/**
+ *  \brief Parses the lines of the chunk of a worker.
+ *
+ *  \param [in] Worker The \ref Chunk_Worker_t.
+ *  \param [in] Length The number of bytes of the chunk.
+ *  \param [out] Parsed The number of bytes whose lines are parsed.
+ *  \return The number of records.
+ */
+static unsigned int Chunk_Parse(Chunk_Worker_t * Worker, unsigned int Length, unsigned int * Parsed);
+
+/**
+ *  \brief Sets the switches of the device to a record.
+ *
+ *  \param [in] Chunk The \ref Chunk_t.
+ *  \param [in] Record The record of the line.
+ */
+static void Chunk_SetSwitches(Chunk_t * Chunk, const Parse_Record_t * Record);
+
+/**
+ *  \brief Calculates the change of the motor speed over the lines of a chunk.
+ *
+ *  \param [in] Worker The \ref Chunk_Worker_t of the chunk.
+ *  \param [in] Count The number of records.
+ *  \param [in] Parsed The offset of the lines without records.
+ *  \param [in] Length The number of bytes of the chunk.
+ *  \param [out] Transfer The \ref SpeedControl_Transfer_t of all lines.
+ */
+static void Chunk_CalcTransfer(Chunk_Worker_t * Worker, unsigned int Count, unsigned int Parsed,
+			unsigned int Length, SpeedControl_Transfer_t * Transfer);
+
+/**
+ *  \brief The body of a worker thread.
+ *
+ *  \param [in] Worker The \ref Chunk_Worker_t of the thread.
+ *  \return NULL.
+ */
+static void * Chunk_WorkerMain(void * Worker);
+
+/* Functions definition */
+/* Private functions */
+/**
+ *  \brief Parses the next line of a chunk.
+ *
+ *  \param [in] Text The text of the chunk.
+ *  \param [in] Length The number of bytes of the chunk.
+ *  \param [in,out] Start The offset of the next line, it becomes the
+ *  			offset after the parsed line.
+ *  \param [out] Record The record of the line.
+ *  \return Not 0 if a line is parsed, 0 at the end of the chunk.
+ *
+ *  \details Empty lines are skipped like \ref File_ReaderNextLine does.
+ */
+static int Chunk_ParseLine(const char * Text, unsigned int Length, unsigned int * Start, Parse_Record_t * Record)
+{
+	/* Needed variables */
+	const char * newLine;
+	unsigned int end;
+	int retFound = 0;
+
+	/* Function Logic */
+	while (!retFound && *Start < Length)
+	{
+		newLine = memchr(Text + *Start, '\n', Length - *Start);
+		end = (newLine == NULL) ? Length : (unsigned int)(newLine - Text);
+		if (end != *Start)
+		{
+			ParseRecord(Text + *Start, end - *Start, Record);
+			retFound = 1;
+		}
+		*Start = (end < Length) ? end + 1u : Length;
+	}
+
+	return retFound;
+}
+
+/**
+ *  \brief Parses the lines of the chunk of a worker.
+ *
+ *  \param [in] Worker The \ref Chunk_Worker_t.
+ *  \param [in] Length The number of bytes of the chunk.
+ *  \param [out] Parsed The number of bytes whose lines are parsed.
+ *  \return The number of records.
+ *
+ *  \details The records grow with the lines of the chunk. If they can't
+ *  		 grow the rest of the lines are left to be parsed again while
+ *  		 they are replayed, so \p Parsed is less than \p Length.
+ */
+static unsigned int Chunk_Parse(Chunk_Worker_t * Worker, unsigned int Length, unsigned int * Parsed)
+{
+	/* Needed variables */
+	Parse_Record_t record;
+	Parse_Record_t * records;
+	int * speeds;
+	unsigned int retCount = 0;
+	unsigned int next = 0;
+	int full = 0;
+
+	/* Function Logic */
+	*Parsed = 0;
+	while (!full && Chunk_ParseLine(Worker->Text, Length, &next, &record))
+	{
+		if (retCount == Worker->Records_Size)	/* Full records */
+		{
+			records = realloc(Worker->Records, 2u * (size_t)Worker->Records_Size * sizeof(Parse_Record_t));
+			Worker->Records = (records == NULL) ? Worker->Records : records;
+			speeds = realloc(Worker->Speeds, 2u * (size_t)Worker->Records_Size * sizeof(int));
+			Worker->Speeds = (speeds == NULL) ? Worker->Speeds : speeds;
+			full = (records == NULL || speeds == NULL);
+			Worker->Records_Size *= full ? 1u : 2u;
+		}
+		if (!full)
+		{
+			Worker->Records[retCount] = record;
+			retCount++;
+			*Parsed = next;
+		}
+	}
+	if (!full)
+	{
+		*Parsed = Length;
+	}
+
+	return retCount;
+}
+
+/**
+ *  \brief Sets the switches of the device to a record.
+ *
+ *  \param [in] Chunk The \ref Chunk_t.
+ *  \param [in] Record The record of the line.
+ */
+static void Chunk_SetSwitches(Chunk_t * Chunk, const Parse_Record_t * Record)
+{
+	Chunk->Switches->Snapshot.Inc_Switch = Record->Inc_Switch;
+	Chunk->Switches->Snapshot.Dec_Switch = Record->Dec_Switch;
+	Chunk->Switches->Snapshot.P_Switch = Record->P_Switch;
+	Chunk->Switches->Snapshot.P_Duration = Record->P_Duration;
+}
+
+/**
+ *  \brief Calculates the change of the motor speed over the lines of a chunk.
+ *
+ *  \param [in] Worker The \ref Chunk_Worker_t of the chunk.
+ *  \param [in] Count The number of records.
+ *  \param [in] Parsed The offset of the lines without records.
+ *  \param [in] Length The number of bytes of the chunk.
+ *  \param [out] Transfer The \ref SpeedControl_Transfer_t of all lines.
+ */
+static void Chunk_CalcTransfer(Chunk_Worker_t * Worker, unsigned int Count, unsigned int Parsed,
+			unsigned int Length, SpeedControl_Transfer_t * Transfer)
+{
+	/* Needed variables */
+	SpeedControl_Transfer_t next;
+	Parse_Record_t record;
+	unsigned int index;
+
+	/* Function Logic */
+	SpeedControl_TransferInit(Transfer);
+	for (index = 0; index < Count; index++)
+	{
+		SpeedControl_CalcTransfer(Worker->Records[index].Inc_Switch, Worker->Records[index].Dec_Switch,
+			Worker->Records[index].P_Switch, Worker->Records[index].P_Duration, &next);
+		SpeedControl_TransferAppend(Transfer, &next);
+	}
+	while (Chunk_ParseLine(Worker->Text, Length, &Parsed, &record))	/* Lines without records */
+	{
+		SpeedControl_CalcTransfer(record.Inc_Switch, record.Dec_Switch, record.P_Switch, record.P_Duration,
+			&next);
+		SpeedControl_TransferAppend(Transfer, &next);
+	}
+}
+
+/**
+ *  \brief The body of a worker thread.
+ *
+ *  \param [in] Worker The \ref Chunk_Worker_t of the thread.
+ *  \return NULL.
+ *
+ *  \details The input file is read under the lock, so the chunks are
+ *  		 numbered in the order of the file. A worker parses its chunk
+ *  		 and calculates the change of the speed over it in parallel,
+ *  		 then it waits only for the first speed of the chunk to give
+ *  		 the first speed of the next chunk. The speeds of the chunk
+ *  		 are calculated in parallel again and only writing them waits
+ *  		 for the turn of the chunk. It's always the turn of a parsed
+ *  		 chunk, so the waiting workers always get their turns.
+ */
+static void * Chunk_WorkerMain(void * Worker)
+{
+	/* Needed variables */
+	Chunk_Worker_t * worker = (Chunk_Worker_t *)Worker;
+	Chunk_t * chunk = worker->Chunk;
+	SpeedControl_Transfer_t transfer;
+	Parse_Record_t record;
+	FileIf_Error_t readError;
+	unsigned long long index;
+	unsigned int length;
+	unsigned int parsed;
+	unsigned int count;
+	unsigned int line;
+	int speed;
+
+	/* Function Logic */
+	pthread_mutex_lock(&chunk->Lock);
+	while (!chunk->End_Of_File)
+	{
+		if (chunk->Switches->Reader == NULL)
+		{
+			readError = File_ReadChunk(worker->Text, chunk->Size, &length);
+		}
+		else
+		{
+			readError = File_ReaderReadChunk(chunk->Switches->Reader, worker->Text, chunk->Size, &length);
+		}
+		if (readError != FILE_IF_ERROR_OK)	/* A read error ends the file like the other modes */
+		{
+			chunk->End_Of_File = 1;
+		}
+		else
+		{
+			index = chunk->Next_Chunk++;
+			pthread_mutex_unlock(&chunk->Lock);
+
+			worker->Text[length] = 0;
+			count = Chunk_Parse(worker, length, &parsed);
+			Chunk_CalcTransfer(worker, count, parsed, length, &transfer);
+
+			/* The scan, the first speed of the next chunk is known */
+			pthread_mutex_lock(&chunk->Lock);
+			while (chunk->Scanned_Chunks != index)
+			{
+				pthread_cond_wait(&chunk->Turn_Signal, &chunk->Lock);
+			}
+			speed = chunk->Speed;
+			chunk->Speed = SpeedControl_TransferApply(&transfer, speed);
+			chunk->Scanned_Chunks++;
+			pthread_cond_broadcast(&chunk->Turn_Signal);
+			pthread_mutex_unlock(&chunk->Lock);
+
+			for (line = 0; line < count; line++)
+			{
+				SpeedControl_CalcTransfer(worker->Records[line].Inc_Switch, worker->Records[line].Dec_Switch,
+					worker->Records[line].P_Switch, worker->Records[line].P_Duration, &transfer);
+				speed = SpeedControl_TransferApply(&transfer, speed);
+				worker->Speeds[line] = speed;
+			}
+
+			pthread_mutex_lock(&chunk->Lock);
+			while (chunk->Replayed_Chunks != index)
+			{
+				pthread_cond_wait(&chunk->Turn_Signal, &chunk->Lock);
+			}
+			pthread_mutex_unlock(&chunk->Lock);
+
+			/* Only this worker writes until the chunk is counted */
+			for (line = 0; line < count; line++)
+			{
+				Motor_ContextUpdateSpeed(chunk->Motor, worker->Speeds[line]);
+			}
+			if (count != 0u)
+			{
+				Chunk_SetSwitches(chunk, &worker->Records[count - 1u]);
+			}
+			while (Chunk_ParseLine(worker->Text, length, &parsed, &record))	/* Lines without records */
+			{
+				Chunk_SetSwitches(chunk, &record);
+				Motor_ContextUpdateSpeed(chunk->Motor, SpeedControl_ContextCalcNewSpeed(chunk->Switches,
+					chunk->Motor));
+			}
+
+			pthread_mutex_lock(&chunk->Lock);
+			chunk->Replayed_Chunks++;
+			pthread_cond_broadcast(&chunk->Turn_Signal);
+		}
+	}
+	pthread_mutex_unlock(&chunk->Lock);
+
+	return NULL;
+}
+
+/* Public functions */
+/**
+ *  \brief This function replays all lines of one device by parsing
+ *  		chunks of them on worker threads.
+ *
+ *  \param [in] Switches The \ref Switches_Context_t of the device, it
+ *  			has the last read states at the end.
+ *  \param [in] Motor The \ref Motor_Context_t of the device, it has the
+ *  			last speed at the end.
+ *  \param [in] Workers The number of worker threads, the calling thread
+ *  			is one of them.
+ *  \param [in] Size The size of a chunk in bytes, 0 for #CHUNK_DEFAULT_SIZE.
+ *  \return \ref Chunk_Error_t type data
+ */
+Chunk_Error_t Chunk_Run(Switches_Context_t * Switches, Motor_Context_t * Motor, unsigned int Workers,
+			unsigned int Size)
+{
+	/* Needed variables */
+	Chunk_Error_t retError = CHUNK_ERROR_OK;
+	Chunk_Worker_t * workers = NULL;
+	FileIf_InputFormat_t format;
+	Chunk_t chunk;
+	unsigned int prepared = 0;
+	unsigned int started = 1;
+	unsigned int index;
+
+	/* Function Logic */
+	memset(&chunk, 0, sizeof(chunk));
+	chunk.Switches = Switches;
+	chunk.Motor = Motor;
+	chunk.Size = (Size == 0u) ? CHUNK_DEFAULT_SIZE : Size;
+	chunk.Speed = Motor_ContextGetSpeed(Motor);
+	if (Workers == 0u)
+	{
+		Workers = 1u;
+	}
+
+	format = (Switches->Reader == NULL) ? File_GetInputFormat() : Switches->Reader->Format;
+	if (format == FILE_IF_INPUT_FORMAT_TEXT)
+	{
+		workers = calloc(Workers, sizeof(Chunk_Worker_t));
+		retError = (workers == NULL) ? CHUNK_ERROR_NO_RESOURCES : CHUNK_ERROR_OK;
+	}
+	for (; workers != NULL && retError == CHUNK_ERROR_OK && prepared < Workers; prepared++)
+	{
+		workers[prepared].Chunk = &chunk;
+		workers[prepared].Text = malloc((size_t)chunk.Size + 1u);
+		workers[prepared].Records = malloc(CHUNK_RECORDS * sizeof(Parse_Record_t));
+		workers[prepared].Speeds = malloc(CHUNK_RECORDS * sizeof(int));
+		workers[prepared].Records_Size = CHUNK_RECORDS;
+		if (workers[prepared].Text == NULL || workers[prepared].Records == NULL ||
+			workers[prepared].Speeds == NULL)
+		{
+			retError = CHUNK_ERROR_NO_RESOURCES;
+		}
+	}
+
+	if (workers != NULL && retError == CHUNK_ERROR_OK)
+	{
+		pthread_mutex_init(&chunk.Lock, NULL);
+		pthread_cond_init(&chunk.Turn_Signal, NULL);
+
+		/* The calling thread is the first worker, if a thread can't be
+		   started the started workers take its chunks */
+		while (started < Workers && pthread_create(&workers[started].Thread, NULL,
+			Chunk_WorkerMain, &workers[started]) == 0)
+		{
+			started++;
+		}
+		Chunk_WorkerMain(&workers[0]);
+		for (index = 1; index < started; index++)
+		{
+			pthread_join(workers[index].Thread, NULL);
+		}
+
+		pthread_cond_destroy(&chunk.Turn_Signal);
+		pthread_mutex_destroy(&chunk.Lock);
+	}
+	else	/* Nothing is read, replay the lines one by one */
+	{
+		while (Switches_ContextUpdateState(Switches) == SWITCH_UPDATE_OK)
+		{
+			Motor_ContextUpdateSpeed(Motor, SpeedControl_ContextCalcNewSpeed(Switches, Motor));
+		}
+	}
+
+	/* Free all resources */
+	for (index = 0; index < prepared; index++)
+	{
+		free(workers[index].Text);
+		free(workers[index].Records);
+		free(workers[index].Speeds);
+	}
+	free(workers);
+
+	return retError;
+}
@@ -0,0 +1,64 @@
+/**
+ *  \file	Chunk.h
+ *  \brief	This file handles replaying one device by parsing chunks
+ *  		of its input file in parallel.
+ *  \author Ahmed Wageh.
+ *  \details	The input text file is split into chunks of whole lines.
+ *  			Every worker thread parses its chunk into an array of
+ *  			records and appends the \ref SpeedControl_Transfer_t of its
+ *  			lines. The first speed of every chunk is the last speed of
+ *  			the chunk before it, so only applying the change of every
+ *  			chunk to the first speed of it is done in the order of the
+ *  			chunks. Then the speeds of the chunks are calculated in
+ *  			parallel and written in the order of the chunks.
+ */
+#ifndef CHUNK_H_
+#define CHUNK_H_
+/* Inclusion */
+#include "../Switches/Switches.h"
+#include "../Motor/Motor.h"
+
+/* Macros */
+/** The default size of a chunk in bytes */
+#define CHUNK_DEFAULT_SIZE		(1024u * 1024u)
+/** The initial number of records of a chunk, they grow with the chunk lines */
+#define CHUNK_RECORDS			4096u
+
+/* User-defined data types */
+/**
+ *  This enum for error types that could happens when
+ *  replaying by chunks
+ */
+enum Chunk_Error_t
+{
+	/** All lines are replayed by chunks */
+	CHUNK_ERROR_OK = 0,
+	/** Can't allocate the chunks or start the workers, all lines are
+	 *  replayed one by one by the calling thread */
+	CHUNK_ERROR_NO_RESOURCES = 1
+};
+typedef enum Chunk_Error_t Chunk_Error_t;
+
+/* Functions prototypes */
+/**
+ *  \brief This function replays all lines of one device by parsing
+ *  		chunks of them on worker threads.
+ *
+ *  \param [in] Switches The \ref Switches_Context_t of the device, it
+ *  			has the last read states at the end.
+ *  \param [in] Motor The \ref Motor_Context_t of the device, it has the
+ *  			last speed at the end.
+ *  \param [in] Workers The number of worker threads, the calling thread
+ *  			is one of them.
+ *  \param [in] Size The size of a chunk in bytes, 0 for #CHUNK_DEFAULT_SIZE.
+ *  \return \ref Chunk_Error_t type data
+ *
+ *  \details The output is the same as calling \ref Switches_ContextUpdateState,
+ *  		 \ref SpeedControl_ContextCalcNewSpeed and \ref Motor_ContextUpdateSpeed
+ *  		 for every line. A line longer than a chunk is split like a line
+ *  		 longer than a block of #FILE_IF_INPUT_MODE_STREAM mode. A binary
+ *  		 trace input has no lines to parse, so it's replayed one by one.
+ */
+Chunk_Error_t Chunk_Run(Switches_Context_t * Switches, Motor_Context_t * Motor, unsigned int Workers,
+			unsigned int Size);
+#endif // !CHUNK_H_
@@ -0,0 +1,85 @@
+/**
+ *  \file	Device.c
+ *  \brief	This file is the implementation of one simulated
+ *  		vacuum cleaner device.
+ *  \author Ahmed Wageh.
+ */
+/* Inclusion */
+#include <string.h>
+#include "Device.h"
+#include "../Speed Control/SpeedControl.h"
+
+/* Functions definition */
+/* Public functions */
+/**
+ *  \brief This function opens the files of a device and initializes it.
+ *
+ *  \param [out] Device The device to be opened.
+ *  \param [in] Input_Path The path of the input text file.
+ *  \param [in] Output_Path The path of the output text file.
+ *  \param [in] Read_Buffer The reader block buffer, it must hold
+ *  			\p Read_Size + 1 bytes.
+ *  \param [in] Read_Size The size of one read block in bytes.
+ *  \param [in] Write_Buffer The writer buffer.
+ *  \param [in] Write_Size The size of \p Write_Buffer in bytes.
+ *  \return \ref FileIf_Error_t type data.
+ */
+FileIf_Error_t Device_Open(Device_t * Device, const char * Input_Path, const char * Output_Path,
+			char * Read_Buffer, unsigned int Read_Size, char * Write_Buffer, unsigned int Write_Size)
+{
+	/* Needed variables */
+	FileIf_Error_t retError;
+
+	/* Function logic */
+	memset(&Device->Writer, 0, sizeof(Device->Writer));	/* Closing is safe even if opening fails */
+	retError = File_ReaderOpenMode(&Device->Reader, Input_Path, Read_Buffer, Read_Size,
+		FILE_IF_INPUT_MODE_MAPPED);
+	if (retError == FILE_IF_ERROR_OK)
+	{
+		retError = File_WriterOpen(&Device->Writer, Output_Path, Write_Buffer, Write_Size);
+		if (retError != FILE_IF_ERROR_OK)
+		{
+			File_WriterClose(&Device->Writer);
+			File_ReaderClose(&Device->Reader);
+		}
+	}
+
+	Switches_ContextInit(&Device->Switches, &Device->Reader);
+	Motor_ContextInit(&Device->Motor, &Device->Writer);
+
+	return retError;
+}
+
+/**
+ *  \brief This function processes the next line of the device input file.
+ *
+ *  \param [in] Device The device.
+ *  \return \ref Switches_UpdateState_t type data
+ */
+Switches_UpdateState_t Device_Step(Device_t * Device)
+{
+	/* Needed variables */
+	Switches_UpdateState_t retState;
+
+	/* Function logic */
+	retState = Switches_ContextUpdateState(&Device->Switches);
+	if (retState == SWITCH_UPDATE_OK)
+	{
+		Motor_ContextUpdateSpeed(&Device->Motor,
+			SpeedControl_ContextCalcNewSpeed(&Device->Switches, &Device->Motor));
+	}
+
+	return retState;
+}
+
+/**
+ *  \brief This function closes the files of a device.
+ *
+ *  \param [in] Device The device.
+ *  \return \ref FileIf_Error_t type data of writing the last lines.
+ */
+FileIf_Error_t Device_Close(Device_t * Device)
+{
+	File_ReaderClose(&Device->Reader);
+	return File_WriterClose(&Device->Writer);
+}
@@ -0,0 +1,74 @@
+/**
+ *  \file	Device.h
+ *  \brief	This file handles one simulated vacuum cleaner device.
+ *  \author Ahmed Wageh.
+ *  \details	A device has its own switches, motor, input text file
+ *  			and output text file, so many devices can be simulated
+ *  			in one process.
+ */
+#ifndef DEVICE_H_
+#define DEVICE_H_
+/* Inclusion */
+#include "../File If/FileIf.h"
+#include "../Switches/Switches.h"
+#include "../Motor/Motor.h"
+
+/* User-defined data types */
+/**
+ *  This struct holds all data of one device.
+ */
+struct Device_t
+{
+	/** The switches of the device */
+	Switches_Context_t Switches;
+	/** The motor of the device */
+	Motor_Context_t Motor;
+	/** The reader of the device input text file */
+	FileIf_Reader_t Reader;
+	/** The writer of the device output text file */
+	FileIf_Writer_t Writer;
+};
+typedef struct Device_t Device_t;
+
+/* Functions prototypes */
+/**
+ *  \brief This function opens the files of a device and initializes it.
+ *
+ *  \param [out] Device The device to be opened.
+ *  \param [in] Input_Path The path of the input text file.
+ *  \param [in] Output_Path The path of the output text file.
+ *  \param [in] Read_Buffer The reader block buffer, it must hold
+ *  			\p Read_Size + 1 bytes.
+ *  \param [in] Read_Size The size of one read block in bytes.
+ *  \param [in] Write_Buffer The writer buffer.
+ *  \param [in] Write_Size The size of \p Write_Buffer in bytes.
+ *  \return \ref FileIf_Error_t type data.
+ *
+ *  \details The input file is read in #FILE_IF_INPUT_MODE_MAPPED mode.
+ *  		 The buffers are owned by the caller, so their sizes decide
+ *  		 the memory of every device. Nothing stays opened if it fails
+ *  		 and \ref Device_Close can still be called.
+ */
+FileIf_Error_t Device_Open(Device_t * Device, const char * Input_Path, const char * Output_Path,
+			char * Read_Buffer, unsigned int Read_Size, char * Write_Buffer, unsigned int Write_Size);
+
+/**
+ *  \brief This function processes the next line of the device input file.
+ *
+ *  \param [in] Device The device.
+ *  \return \ref Switches_UpdateState_t type data
+ *
+ *  \details It updates the switches, calculates the new speed and
+ *  		 updates the motor. It returns #SWITCH_UPDATE_ERROR at the
+ *  		 end of the input file.
+ */
+Switches_UpdateState_t Device_Step(Device_t * Device);
+
+/**
+ *  \brief This function closes the files of a device.
+ *
+ *  \param [in] Device The device.
+ *  \return \ref FileIf_Error_t type data of writing the last lines.
+ */
+FileIf_Error_t Device_Close(Device_t * Device);
+#endif // !DEVICE_H_
@@ -7,148 +7,1584 @@
  */
 /* Inclusion */
 #include "FileIf.h"
+#include "FileIfCompress.h"
+#include <stdlib.h>
 #include <string.h>
+#include "../Trace/Trace.h"
+#include "../Profile/Profile.h"
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+#ifdef _WIN32
+#include <io.h>
+#include <fcntl.h>
+#endif
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+/** The system supports memory-mapped input files */
+#define FILE_IF_MMAP_SUPPORTED
+#endif
 
 /* Private variables */
-/** For holding the input file handler */
-static FILE * File_Input_File_Handler = NULL;
-/** For holding the output file handler */
-static FILE * File_Output_File_Handler = NULL;
+/** The reader object of the input file */
+static FileIf_Reader_t File_Input_Reader;
+/** The block buffer of the input file, one extra byte for terminating the last line */
+static char File_Input_Buffer[FILE_IF_INPUT_BUFFER_SIZE + 1u];
+/** The writer object of the output file */
+static FileIf_Writer_t File_Output_Writer;
+/** The user-space buffer of the output file */
+static char File_Output_Buffer[FILE_IF_OUTPUT_BUFFER_SIZE];
+/** The flush policy applied when the output file is prepared */
+static FileIf_FlushPolicy_t File_Output_Policy = {0, 0, 1};
+/** The format applied when the output file is prepared */
+static FileIf_OutputFormat_t File_Output_Format = FILE_IF_OUTPUT_FORMAT_TEXT;
+/** Whether the exit handler of output file is registered */
+static int File_Output_Exit_Registered = 0;
+/** The path applied when the input file is prepared */
+static const char * File_Input_Path = FILE_IF_INPUT_FILE_FULL_PATH;
+/** The path applied when the output file is prepared, NULL for the path of the format */
+static const char * File_Output_Path = NULL;
+
+/* Private functions prototype */
+/**
+ *  \brief Gets a monotonic time stamp in milliseconds.
+ *
+ *  \return The time stamp in milliseconds.
+ */
+static unsigned long File_GetTimeMs(void);
+
+/**
+ *  \brief Formats \p Data as a decimal text line.
+ *
+ *  \param [out] Text at least #FILE_IF_OUTPUT_LINE_MAX_LENGTH characters.
+ *  \param [in] Data The number to be formatted.
+ *  \return The number of written characters including "\n".
+ */
+static unsigned int File_FormatLine(char * Text, int Data);
+
+/**
+ *  \brief The exit handler which applies the "on exit" flush policy
+ *  		of the output file.
+ */
+static void File_OutputAtExit(void);
+
+/**
+ *  \brief Opens a file or a standard stream.
+ *
+ *  \param [in] Path The path of the file or #FILE_IF_STANDARD_STREAM_PATH.
+ *  \param [in] Mode The fopen mode, "rb" or "wb".
+ *  \return The opened file, NULL if it can't be opened.
+ */
+static FILE * File_Open(const char * Path, const char * Mode);
+
+/**
+ *  \brief Maps the opened input file of a reader object.
+ *
+ *  \param [in] Reader The reader object with the opened file.
+ *  \return Not 0 if the file is mapped.
+ */
+static int File_ReaderMap(FileIf_Reader_t * Reader);
+
+/**
+ *  \brief Gets the next line of a mapped reader object.
+ *
+ *  \param [in] Reader The reader object.
+ *  \param [out] Line Points to the first character of the line.
+ *  \param [out] Length The number of characters in the line.
+ *  \return \ref FileIf_Error_t type data.
+ */
+static FileIf_Error_t File_ReaderNextMappedLine(FileIf_Reader_t * Reader,
+			const char ** Line, unsigned int * Length);
+
+/**
+ *  \brief Gets the next line of a stream reader object.
+ *
+ *  \param [in] Reader The reader object.
+ *  \param [out] Line Points to the first character of the line.
+ *  \param [out] Length The number of characters in the line.
+ *  \return \ref FileIf_Error_t type data.
+ */
+static FileIf_Error_t File_ReaderNextStreamLine(FileIf_Reader_t * Reader,
+			const char ** Line, unsigned int * Length);
+
+/**
+ *  \brief Loads the next block of a stream reader object after its unread data.
+ *
+ *  \param [in] Reader The reader object.
+ *  \return \ref FileIf_Error_t type data.
+ */
+static FileIf_Error_t File_ReaderLoadBlock(FileIf_Reader_t * Reader);
+
+/**
+ *  \brief Detects a compressed input file and starts decompressing it.
+ *
+ *  \param [in] Reader The opened reader object.
+ *  \return \ref FileIf_Error_t type data.
+ */
+static FileIf_Error_t File_ReaderOpenCompressed(FileIf_Reader_t * Reader);
+
+/**
+ *  \brief Gets the next bytes of a reader object without reading them.
+ *
+ *  \param [in] Reader The reader object.
+ *  \param [in] Count The needed number of bytes.
+ *  \param [out] Data Points to the first unread byte.
+ *  \param [out] Length The number of bytes at \p Data, less than \p Count
+ *  			only at the end of the file.
+ *  \return \ref FileIf_Error_t type data.
+ */
+static FileIf_Error_t File_ReaderPeek(FileIf_Reader_t * Reader, unsigned int Count,
+			const unsigned char ** Data, unsigned int * Length);
+
+/**
+ *  \brief Marks the next bytes of a reader object as read.
+ *
+ *  \param [in] Reader The reader object.
+ *  \param [in] Count The number of bytes got by \ref File_ReaderPeek.
+ */
+static void File_ReaderSkip(FileIf_Reader_t * Reader, unsigned int Count);
+
+/**
+ *  \brief Writes the current run of a run-length writer object.
+ *
+ *  \param [in] Writer The writer object.
+ *  \return \ref FileIf_Error_t type data.
+ */
+static FileIf_Error_t File_WriterEndRun(FileIf_Writer_t * Writer);
+
+/**
+ *  \brief Flushes a writer object if its flush policy is due.
+ *
+ *  \param [in] Writer The writer object.
+ *  \return \ref FileIf_Error_t type data.
+ */
+static FileIf_Error_t File_WriterApplyPolicy(FileIf_Writer_t * Writer);
+
+/**
+ *  \brief Writes bytes to the output file of a writer object.
+ *
+ *  \param [in] Writer The writer object.
+ *  \param [in] Data The bytes to be written.
+ *  \param [in] Length The number of bytes of \p Data.
+ *  \return \ref FileIf_Error_t type data.
+ */
+static FileIf_Error_t File_WriterPut(FileIf_Writer_t * Writer, const void * Data, unsigned int Length);
 
 /* Functions definition */
+/* Private functions */
+/**
+ *  \brief Gets a monotonic time stamp in milliseconds.
+ *
+ *  \return The time stamp in milliseconds.
+ */
+static unsigned long File_GetTimeMs(void)
+{
+#ifdef _WIN32
+	return (unsigned long)GetTickCount64();
+#else
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (unsigned long)now.tv_sec * 1000ul + (unsigned long)now.tv_nsec / 1000000ul;
+#endif
+}
+
+/**
+ *  \brief Formats \p Data as a decimal text line.
+ *
+ *  \param [out] Text at least #FILE_IF_OUTPUT_LINE_MAX_LENGTH characters.
+ *  \param [in] Data The number to be formatted.
+ *  \return The number of written characters including "\n".
+ */
+static unsigned int File_FormatLine(char * Text, int Data)
+{
+	/* Needed variables */
+	char digits[10];
+	unsigned int value = (Data < 0) ? 0u - (unsigned int)Data : (unsigned int)Data;
+	unsigned int count = 0;
+	unsigned int length = 0;
+
+	/* Function Logic */
+	do	/* Get the digits in reverse order */
+	{
+		digits[count] = (char)('0' + value % 10u);
+		count++;
+		value /= 10u;
+	} while (value != 0u);
+
+	if (Data < 0)
+	{
+		Text[length] = '-';
+		length++;
+	}
+	while (count > 0u)
+	{
+		count--;
+		Text[length] = digits[count];
+		length++;
+	}
+	Text[length] = '\n';
+	length++;
+
+	return length;
+}
+
+/**
+ *  \brief The exit handler which applies the "on exit" flush policy
+ *  		of the output file.
+ */
+static void File_OutputAtExit(void)
+{
+	if (File_Output_Writer.Policy.On_Exit != 0)
+	{
+		File_WriterClose(&File_Output_Writer);
+	}
+}
+
+/**
+ *  \brief Opens a file or a standard stream.
+ *
+ *  \param [in] Path The path of the file or #FILE_IF_STANDARD_STREAM_PATH.
+ *  \param [in] Mode The fopen mode, "rb" or "wb".
+ *  \return The opened file, NULL if it can't be opened.
+ *
+ *  \details The standard streams are switched to binary mode on Windows,
+ *  		 so traces and run-length files aren't changed by new lines.
+ */
+static FILE * File_Open(const char * Path, const char * Mode)
+{
+	/* Needed variables */
+	FILE * retHandler;
+
+	/* Function Logic */
+	if (strcmp(Path, FILE_IF_STANDARD_STREAM_PATH) == 0)
+	{
+		retHandler = (Mode[0] == 'r') ? stdin : stdout;
+#ifdef _WIN32
+		_setmode(_fileno(retHandler), _O_BINARY);
+#endif
+	}
+	else
+	{
+		retHandler = fopen(Path, Mode);
+	}
+
+	return retHandler;
+}
+
+/**
+ *  \brief Maps the opened input file of a reader object.
+ *
+ *  \param [in] Reader The reader object with the opened file.
+ *  \return Not 0 if the file is mapped.
+ *
+ *  \details Only regular files are mapped, pipes and devices stay
+ *  		 opened to be read as a stream, they are never opened twice.
+ */
+static int File_ReaderMap(FileIf_Reader_t * Reader)
+{
+#ifdef FILE_IF_MMAP_SUPPORTED
+	/* Needed variables */
+	struct stat status;
+	void * map;
+	int handler;
+
+	/* Function Logic */
+	handler = fileno(Reader->Handler);
+	if (fstat(handler, &status) == 0 && S_ISREG(status.st_mode) && status.st_size > 0)
+	{
+		map = mmap(NULL, (size_t)status.st_size, PROT_READ, MAP_PRIVATE, handler, 0);
+		if (map != MAP_FAILED)
+		{
+			madvise(map, (size_t)status.st_size, MADV_SEQUENTIAL);	/* Read-ahead hint */
+			Reader->Map = (const char *)map;
+			Reader->Map_Size = (size_t)status.st_size;
+			Reader->Map_Position = 0;
+		}
+	}
+#endif
+
+	return Reader->Map != NULL;
+}
+
+/**
+ *  \brief Gets the next line of a mapped reader object.
+ *
+ *  \param [in] Reader The reader object.
+ *  \param [out] Line Points to the first character of the line.
+ *  \param [out] Length The number of characters in the line.
+ *  \return \ref FileIf_Error_t type data.
+ */
+static FileIf_Error_t File_ReaderNextMappedLine(FileIf_Reader_t * Reader,
+			const char ** Line, unsigned int * Length)
+{
+	/* Needed variables */
+	FileIf_Error_t retData = FILE_IF_ERROR_OK;
+	const char * newLine;
+	size_t count;
+	int lineFound = 0;
+
+	/* Function Logic */
+	while (lineFound == 0 && retData == FILE_IF_ERROR_OK)
+	{
+		count = Reader->Map_Size - Reader->Map_Position;
+		newLine = memchr(Reader->Map + Reader->Map_Position, '\n', count);
+		if (newLine != NULL)	/* The line is a view into the mapping */
+		{
+			*Line = Reader->Map + Reader->Map_Position;
+			*Length = (unsigned int)(newLine - *Line);
+			Reader->Map_Position += *Length + 1u;
+			lineFound = (*Length != 0u);	/* Skip empty lines */
+		}
+		else if (count == 0u)
+		{
+			retData = FILE_IF_ERROR_END_OF_FILE;
+			File_ReaderClose(Reader);
+			Reader->End_Of_File = 1;
+		}
+		else	/* Copy the last line to terminate it */
+		{
+			if (count > Reader->Size)
+			{
+				count = Reader->Size;
+			}
+			memcpy(Reader->Buffer, Reader->Map + Reader->Map_Position, count);
+			Reader->Buffer[count] = 0;
+			Reader->Map_Position = Reader->Map_Size;
+			*Line = Reader->Buffer;
+			*Length = (unsigned int)count;
+			lineFound = 1;
+		}
+	}
+
+	return retData;
+}
+
+/**
+ *  \brief Gets the next line of a stream reader object.
+ *
+ *  \param [in] Reader The reader object.
+ *  \param [out] Line Points to the first character of the line.
+ *  \param [out] Length The number of characters in the line.
+ *  \return \ref FileIf_Error_t type data.
+ */
+static FileIf_Error_t File_ReaderNextStreamLine(FileIf_Reader_t * Reader,
+			const char ** Line, unsigned int * Length)
+{
+	/* Needed variables */
+	FileIf_Error_t retData = FILE_IF_ERROR_OK;
+	const char * newLine;
+	int lineFound = 0;
+
+	/* Function Logic */
+	while (lineFound == 0 && retData == FILE_IF_ERROR_OK)
+	{
+		newLine = memchr(Reader->Buffer + Reader->Start, '\n', Reader->End - Reader->Start);
+		if (newLine != NULL)	/* A complete line is in the buffer */
+		{
+			*Line = Reader->Buffer + Reader->Start;
+			*Length = (unsigned int)(newLine - *Line);
+			Reader->Start += *Length + 1u;
+			lineFound = (*Length != 0u);	/* Skip empty lines */
+		}
+		else if (Reader->End_Of_File != 0)	/* No more data to load */
+		{
+			if (Reader->Start == Reader->End)
+			{
+				retData = FILE_IF_ERROR_END_OF_FILE;
+			}
+			else	/* The last line doesn't end with "\n" */
+			{
+				*Line = Reader->Buffer + Reader->Start;
+				*Length = Reader->End - Reader->Start;
+				Reader->Buffer[Reader->End] = 0;
+				Reader->Start = Reader->End;
+				lineFound = 1;
+			}
+		}
+		else if (Reader->Handler == NULL)	/* If the file couldn't open */
+		{
+			retData = FILE_IF_ERROR_CAN_NOT_OPEN;
+		}
+		else if (Reader->Start == 0u && Reader->End == Reader->Size)	/* Line is longer than a block */
+		{
+			*Line = Reader->Buffer;
+			*Length = Reader->Size;
+			Reader->Buffer[Reader->Size] = 0;
+			Reader->Start = Reader->Size;
+			lineFound = 1;
+		}
+		else	/* Load the next block after the unread data */
+		{
+			retData = File_ReaderLoadBlock(Reader);
+		}
+	}
+
+	return retData;
+}
+
+/**
+ *  \brief Loads the next block of a stream reader object after its unread data.
+ *
+ *  \param [in] Reader The reader object.
+ *  \return \ref FileIf_Error_t type data.
+ *
+ *  \details The file is closed when it ends.
+ */
+static FileIf_Error_t File_ReaderLoadBlock(FileIf_Reader_t * Reader)
+{
+	/* Needed variables */
+	FileIf_Error_t retData = FILE_IF_ERROR_OK;
+	unsigned int count;
+
+	/* Function Logic */
+	memmove(Reader->Buffer, Reader->Buffer + Reader->Start, Reader->End - Reader->Start);
+	Reader->End -= Reader->Start;
+	Reader->Start = 0;
+	if (Reader->Compress_Stream != NULL)	/* Decompress the next block */
+	{
+		retData = FileIfCompress_Read(Reader->Compress_Stream, Reader->Buffer + Reader->End,
+			Reader->Size - Reader->End, &count);
+	}
+	else
+	{
+		count = (unsigned int)fread(Reader->Buffer + Reader->End, 1,
+			Reader->Size - Reader->End, Reader->Handler);
+		if (count == 0u && ferror(Reader->Handler))
+		{
+			retData = FILE_IF_ERROR_CAN_NOT_READ;
+		}
+	}
+	Reader->End += count;
+	if (retData == FILE_IF_ERROR_OK && count == 0u)	/* Close the file if it ends */
+	{
+		Reader->End_Of_File = 1;
+		File_ReaderClose(Reader);
+	}
+
+	return retData;
+}
+
+/**
+ *  \brief Detects a compressed input file and starts decompressing it.
+ *
+ *  \param [in] Reader The opened reader object.
+ *  \return \ref FileIf_Error_t type data.
+ *
+ *  \details The first bytes are read to \p Buffer of a stream reader,
+ *  		 they are kept there for a file that isn't compressed. A
+ *  		 compressed mapped file is unmapped and read as a stream from
+ *  		 its still opened handler, because the decompressed lines can't
+ *  		 be views into the mapping. The handler of a mapped file that
+ *  		 isn't compressed is closed.
+ */
+static FileIf_Error_t File_ReaderOpenCompressed(FileIf_Reader_t * Reader)
+{
+	/* Needed variables */
+	FileIf_Error_t retData = FILE_IF_ERROR_OK;
+	unsigned int length = (Reader->Size < FILE_IF_COMPRESS_MAGIC_SIZE) ? Reader->Size : FILE_IF_COMPRESS_MAGIC_SIZE;
+
+	/* Function Logic */
+	if (Reader->Map != NULL)
+	{
+		Reader->Compression = FileIfCompress_Detect((const unsigned char *)Reader->Map,
+			(Reader->Map_Size < FILE_IF_COMPRESS_MAGIC_SIZE) ? (unsigned int)Reader->Map_Size : FILE_IF_COMPRESS_MAGIC_SIZE);
+		if (Reader->Compression != FILE_IF_COMPRESSION_NONE)	/* Fall back to stream mode */
+		{
+#ifdef FILE_IF_MMAP_SUPPORTED
+			munmap((void *)Reader->Map, Reader->Map_Size);
+#endif
+			Reader->Map = NULL;
+			Reader->Mode = FILE_IF_INPUT_MODE_STREAM;
+		}
+		else	/* The mapping stays valid after closing */
+		{
+			fclose(Reader->Handler);
+			Reader->Handler = NULL;
+		}
+	}
+	else
+	{
+		Reader->End = (unsigned int)fread(Reader->Buffer, 1, length, Reader->Handler);
+		Reader->Compression = FileIfCompress_Detect((const unsigned char *)Reader->Buffer, Reader->End);
+		if (Reader->End < length && ferror(Reader->Handler))
+		{
+			retData = FILE_IF_ERROR_CAN_NOT_READ;
+		}
+	}
+
+	if (retData == FILE_IF_ERROR_OK && Reader->Compression != FILE_IF_COMPRESSION_NONE)
+	{
+		if (FileIfCompress_IsSupported(Reader->Compression) == 0)
+		{
+			retData = FILE_IF_ERROR_UNSUPPORTED;
+		}
+		else
+		{
+			/* The read bytes are decompressed first */
+			Reader->Compress_Stream = FileIfCompress_OpenReader(Reader->Compression, Reader->Handler,
+				(const unsigned char *)Reader->Buffer, Reader->End);
+			Reader->End = 0;
+			if (Reader->Compress_Stream == NULL)
+			{
+				retData = FILE_IF_ERROR_CAN_NOT_READ;
+			}
+		}
+	}
+
+	return retData;
+}
+
+/**
+ *  \brief Gets the next bytes of a reader object without reading them.
+ *
+ *  \param [in] Reader The reader object.
+ *  \param [in] Count The needed number of bytes, not more than the block size.
+ *  \param [out] Data Points to the first unread byte.
+ *  \param [out] Length The number of bytes at \p Data, less than \p Count
+ *  			only at the end of the file.
+ *  \return \ref FileIf_Error_t type data, #FILE_IF_ERROR_END_OF_FILE
+ *  		 if there are no more bytes.
+ */
+static FileIf_Error_t File_ReaderPeek(FileIf_Reader_t * Reader, unsigned int Count,
+			const unsigned char ** Data, unsigned int * Length)
+{
+	/* Needed variables */
+	FileIf_Error_t retData = FILE_IF_ERROR_OK;
+	size_t count;
+
+	/* Function Logic */
+	if (Reader->Map != NULL)
+	{
+		count = Reader->Map_Size - Reader->Map_Position;
+		*Data = (const unsigned char *)Reader->Map + Reader->Map_Position;
+		*Length = (count < Count) ? (unsigned int)count : Count;
+		if (count == 0u)
+		{
+			retData = FILE_IF_ERROR_END_OF_FILE;
+			File_ReaderClose(Reader);
+			Reader->End_Of_File = 1;
+		}
+	}
+	else
+	{
+		while (retData == FILE_IF_ERROR_OK && Reader->End - Reader->Start < Count &&
+			Reader->End_Of_File == 0)
+		{
+			retData = (Reader->Handler == NULL) ? FILE_IF_ERROR_CAN_NOT_OPEN : File_ReaderLoadBlock(Reader);
+		}
+		*Data = (const unsigned char *)Reader->Buffer + Reader->Start;
+		*Length = (Reader->End - Reader->Start < Count) ? Reader->End - Reader->Start : Count;
+		if (retData == FILE_IF_ERROR_OK && *Length == 0u)
+		{
+			retData = FILE_IF_ERROR_END_OF_FILE;
+		}
+	}
+
+	return retData;
+}
+
+/**
+ *  \brief Marks the next bytes of a reader object as read.
+ *
+ *  \param [in] Reader The reader object.
+ *  \param [in] Count The number of bytes got by \ref File_ReaderPeek.
+ */
+static void File_ReaderSkip(FileIf_Reader_t * Reader, unsigned int Count)
+{
+	if (Reader->Map != NULL)
+	{
+		Reader->Map_Position += Count;
+	}
+	else
+	{
+		Reader->Start += Count;
+	}
+}
+
+/**
+ *  \brief Writes the current run of a run-length writer object.
+ *
+ *  \param [in] Writer The writer object.
+ *  \return \ref FileIf_Error_t type data.
+ *
+ *  \details The run is added to the buffer, the buffer is written to the
+ *  		 file first if it's full. Without a buffer the run is written
+ *  		 directly to the file.
+ */
+static FileIf_Error_t File_WriterEndRun(FileIf_Writer_t * Writer)
+{
+	/* Needed variables */
+	FileIf_Error_t retData = FILE_IF_ERROR_OK;
+	unsigned char run[FILE_IF_RUN_LENGTH_RUN_MAX_SIZE];
+	unsigned int delta;
+	unsigned int length;
+
+	/* Function Logic */
+	if (Writer->Run_Count != 0u)
+	{
+		/* Zigzag keeps the small decrements short */
+		delta = (unsigned int)Writer->Run_Data - (unsigned int)Writer->Run_Previous;
+		length = Trace_EncodeVarint((delta << 1) ^ (0u - (delta >> 31)), run);
+		length += Trace_EncodeVarint(Writer->Run_Count, run + length);
+		if (Writer->Size < FILE_IF_RUN_LENGTH_RUN_MAX_SIZE)	/* No buffer */
+		{
+			if (File_WriterPut(Writer, run, length) != FILE_IF_ERROR_OK)
+			{
+				retData = FILE_IF_ERROR_CAN_NOT_WRITE;
+			}
+		}
+		else
+		{
+			if (Writer->Size - Writer->Used < length)	/* Buffer is full */
+			{
+				if (File_WriterPut(Writer, Writer->Buffer, Writer->Used) != FILE_IF_ERROR_OK)
+				{
+					retData = FILE_IF_ERROR_CAN_NOT_WRITE;
+				}
+				Writer->Used = 0;
+			}
+			memcpy(Writer->Buffer + Writer->Used, run, length);
+			Writer->Used += length;
+		}
+		Writer->Run_Previous = Writer->Run_Data;
+		Writer->Run_Count = 0;
+	}
+
+	return retData;
+}
+
+/**
+ *  \brief Flushes a writer object if its flush policy is due.
+ *
+ *  \param [in] Writer The writer object.
+ *  \return \ref FileIf_Error_t type data.
+ */
+static FileIf_Error_t File_WriterApplyPolicy(FileIf_Writer_t * Writer)
+{
+	/* Needed variables */
+	FileIf_Error_t retData = FILE_IF_ERROR_OK;
+
+	/* Function Logic */
+	if ((Writer->Policy.Every_Lines != 0u && Writer->Pending_Lines >= Writer->Policy.Every_Lines) ||
+		(Writer->Policy.Every_Ms != 0u &&
+		File_GetTimeMs() - Writer->Last_Flush_Ms >= Writer->Policy.Every_Ms))
+	{
+		retData = File_WriterFlush(Writer);
+	}
+
+	return retData;
+}
+
+/**
+ *  \brief Writes bytes to the output file of a writer object.
+ *
+ *  \param [in] Writer The writer object.
+ *  \param [in] Data The bytes to be written.
+ *  \param [in] Length The number of bytes of \p Data.
+ *  \return \ref FileIf_Error_t type data.
+ *
+ *  \details The bytes of a compressed file are compressed first.
+ */
+static FileIf_Error_t File_WriterPut(FileIf_Writer_t * Writer, const void * Data, unsigned int Length)
+{
+	/* Needed variables */
+	FileIf_Error_t retData = FILE_IF_ERROR_OK;
+
+	/* Function Logic */
+	if (Writer->Compress_Stream != NULL)
+	{
+		retData = FileIfCompress_Write(Writer->Compress_Stream, Data, Length);
+	}
+	else if (fwrite(Data, 1, Length, Writer->Handler) != Length)
+	{
+		retData = FILE_IF_ERROR_CAN_NOT_WRITE;
+	}
+
+	return retData;
+}
+
+/* Public functions */
+/**
+ *  \brief 		This is considered as initialization function
+ *				for output file.
+ *	\param		None.
+ *	\return		None.
+ *  \details	It creates the file if it doesn't exist or
+ *  			clear it to be ready for writing if it exists.
+ *  			The file is kept opened until \ref File_CloseOutputFile
+ *  			is called or the program exits.
+ */
+void File_PrepareOutputFile(void)
+{
+	if (File_Output_Writer.Handler == NULL)	/* The file haven't been opened */
+	{
+		if (File_WriterOpenFormat(&File_Output_Writer,
+			(File_Output_Path != NULL) ? File_Output_Path :
+			(File_Output_Format == FILE_IF_OUTPUT_FORMAT_RUN_LENGTH) ?
+			FILE_IF_OUTPUT_RUN_LENGTH_FULL_PATH : FILE_IF_OUTPUT_FILE_FULL_PATH,
+			File_Output_Buffer, FILE_IF_OUTPUT_BUFFER_SIZE, File_Output_Format) == FILE_IF_ERROR_OK)
+		{
+			File_Output_Writer.Policy = File_Output_Policy;
+			if (File_Output_Exit_Registered == 0)
+			{
+				atexit(File_OutputAtExit);
+				File_Output_Exit_Registered = 1;
+			}
+		}
+	}
+}
+
+/**
+ *  \brief 		This is considered as initialization function
+ *				for input file.
+ *	\param		None.
+ *	\return		\ref FileIf_Error_t type data.
+ *	\details	It opens the file and read its header to be
+ *				ready for reading process.
+ */
+FileIf_Error_t File_PrepareInputFile(void)
+{
+	return File_PrepareInputFileMode(FILE_IF_INPUT_MODE_STREAM);
+}
+
+/**
+ *  \brief 		This is considered as initialization function
+ *				for input file with a selected input mode.
+ *	\param [in]	Mode The \ref FileIf_InputMode_t to read the file with.
+ *	\return		\ref FileIf_Error_t type data.
+ */
+FileIf_Error_t File_PrepareInputFileMode(FileIf_InputMode_t Mode)
+{
+	/* Needed variables */
+	FileIf_Error_t retData = FILE_IF_ERROR_OK;
+
+	/* Function Logic */
+	if (File_Input_Reader.Handler == NULL && File_Input_Reader.Map == NULL)	/* The file haven't been opened */
+	{
+		retData = File_ReaderOpenMode(&File_Input_Reader, File_Input_Path,
+			File_Input_Buffer, FILE_IF_INPUT_BUFFER_SIZE, Mode);
+	}
+
+	return retData;
+}
+
+/**
+ *  \brief 	This function used to read a line of text from
+ *  		input file.
+ *
+ *  \param [out] 	Return_Reference char * for holding the
+ *  				return text line.
+ *
+ *  \return \ref FileIf_Error_t type data.
+ *
+ *  \details 	It reads the next line from the input file text
+ *  			and return an error code:
+ *  			- #FILE_IF_ERROR_OK: Reading done successfully
+ *  			- #FILE_IF_ERROR_CAN_NOT_OPEN: Can't open the
+ *  											input file.
+ *  			- #FILE_IF_ERROR_CAN_NOT_READ: Can't read from the
+ *  											input file.
+ *  			- #FILE_IF_ERROR_END_OF_FILE:	Reaches the end of file.
+ *
+ */
+FileIf_Error_t File_ReadLine(char * Return_Reference)
+{
+	/* Needed data types */
+	FileIf_Error_t retData;
+	const char * line;
+	unsigned int length;
+
+	/* Function Logic */
+	retData = File_ReaderNextLine(&File_Input_Reader, &line, &length);
+	if (retData == FILE_IF_ERROR_OK)
+	{
+		if (length > FILE_IF_LINE_MAX_LENGTH - 1u)	/* Truncate too long lines */
+		{
+			length = FILE_IF_LINE_MAX_LENGTH - 1u;
+		}
+		memcpy(Return_Reference, line, length);
+		Return_Reference[length] = 0;	/* End the string with Null terminator */
+	}
+
+	return retData;
+}
+
+/**
+ *  \brief 	This function used to get a view of the next line of
+ *  		input file without copying it.
+ *
+ *  \param [out] Line Points to the first character of the line.
+ *  \param [out] Length The number of characters in the line.
+ *
+ *  \return \ref FileIf_Error_t type data as \ref File_ReadLine.
+ */
+FileIf_Error_t File_ReadLineView(const char ** Line, unsigned int * Length)
+{
+	return File_ReaderNextLine(&File_Input_Reader, Line, Length);
+}
+
+/**
+ *  \brief 	This function used to read the next record of input file
+ *  		if it's a binary trace.
+ *
+ *  \param [out] Record The decoded record.
+ *
+ *  \return \ref FileIf_Error_t type data as \ref File_ReaderNextRecord.
+ */
+FileIf_Error_t File_ReadRecord(struct Parse_Record_t * Record)
+{
+	return File_ReaderNextRecord(&File_Input_Reader, Record);
+}
+
+/**
+ *  \brief 	This function used to copy the next whole lines of input file.
+ *
+ *  \param [out] Chunk The copied lines.
+ *  \param [in] Size The maximum number of copied bytes.
+ *  \param [out] Length The number of copied bytes.
+ *
+ *  \return \ref FileIf_Error_t type data as \ref File_ReaderReadChunk.
+ */
+FileIf_Error_t File_ReadChunk(char * Chunk, unsigned int Size, unsigned int * Length)
+{
+	return File_ReaderReadChunk(&File_Input_Reader, Chunk, Size, Length);
+}
+
+/**
+ *  \brief 	This function gets the format of input file.
+ *
+ *  \return \ref FileIf_InputFormat_t type data.
+ */
+FileIf_InputFormat_t File_GetInputFormat(void)
+{
+	return File_Input_Reader.Format;
+}
+
+/**
+ *  \brief 	This function gets the error that stopped reading input file.
+ *
+ *  \return \ref FileIf_Error_t type data.
+ */
+FileIf_Error_t File_GetInputError(void)
+{
+	return File_Input_Reader.Error;
+}
+
+/**
+ *  \brief This function used to write calculated data to output file.
+ *
+ *  \param [in] Data the data needed to be written to output file.
+ *  \return \ref FileIf_Error_t type data.
+ *
+ *  \details It writes a calculated data to the buffer of output file
+ *  			text, flushes it according to the flush policy and
+ *  			return an error code:
+ *  			- #FILE_IF_ERROR_OK: Reading done successfully
+ *  			- #FILE_IF_ERROR_CAN_NOT_OPEN: Can't open the
+ *  											output file.
+ *  			- #FILE_IF_ERROR_CAN_NOT_WRITE: Can't write to
+ *  											 the output file.
+ *
+ */
+FileIf_Error_t File_WriteLine(int Data)
+{
+	return File_WriterWriteLine(&File_Output_Writer, Data);
+}
+
+/**
+ *  \brief This function used to write the same data to many lines of
+ *  		output file.
+ *
+ *  \param [in] Data The data needed to be written to output file.
+ *  \param [in] Count The number of lines.
+ *  \return \ref FileIf_Error_t type data as \ref File_WriteLine.
+ */
+FileIf_Error_t File_WriteRepeat(int Data, unsigned int Count)
+{
+	return File_WriterWriteRepeat(&File_Output_Writer, Data, Count);
+}
+
+/**
+ *  \brief This function opens an input text file for a reader object.
+ *
+ *  \param [out] Reader The reader object to be opened.
+ *  \param [in] Path The path of the input text file.
+ *  \param [in] Buffer The block buffer, it must hold \p Size + 1 bytes.
+ *  \param [in] Size The size of one block in bytes.
+ *  \return \ref FileIf_Error_t type data.
+ */
+FileIf_Error_t File_ReaderOpen(FileIf_Reader_t * Reader, const char * Path,
+			char * Buffer, unsigned int Size)
+{
+	return File_ReaderOpenMode(Reader, Path, Buffer, Size, FILE_IF_INPUT_MODE_STREAM);
+}
+
+/**
+ *  \brief This function opens an input text file for a reader object
+ *  		with a selected input mode.
+ *
+ *  \param [out] Reader The reader object to be opened.
+ *  \param [in] Path The path of the input text file.
+ *  \param [in] Buffer The block buffer, it must hold \p Size + 1 bytes.
+ *  \param [in] Size The size of one block in bytes.
+ *  \param [in] Mode The requested \ref FileIf_InputMode_t.
+ *  \return \ref FileIf_Error_t type data.
+ */
+FileIf_Error_t File_ReaderOpenMode(FileIf_Reader_t * Reader, const char * Path,
+			char * Buffer, unsigned int Size, FileIf_InputMode_t Mode)
+{
+	/* Needed variables */
+	FileIf_Error_t retData = FILE_IF_ERROR_OK;
+	const unsigned char * data;
+	const char * header;
+	unsigned int length;
+	Trace_Error_t trace;
+
+	/* Function Logic */
+	Reader->Buffer = Buffer;
+	Reader->Size = Size;
+	Reader->Start = 0;
+	Reader->End = 0;
+	Reader->End_Of_File = 0;
+	Reader->Handler = NULL;
+	Reader->Map = NULL;
+	Reader->Mode = FILE_IF_INPUT_MODE_STREAM;
+	Reader->Format = FILE_IF_INPUT_FORMAT_TEXT;
+	Reader->Compression = FILE_IF_COMPRESSION_NONE;
+	Reader->Compress_Stream = NULL;
+	Reader->Error = FILE_IF_ERROR_OK;
+	Reader->Handler = File_Open(Path, "rb");	/* Open the file once, a pipe can't be opened again */
+	if (Reader->Handler != NULL && Mode == FILE_IF_INPUT_MODE_MAPPED &&
+		strcmp(Path, FILE_IF_STANDARD_STREAM_PATH) != 0 && File_ReaderMap(Reader) != 0)
+	{
+		Reader->Mode = FILE_IF_INPUT_MODE_MAPPED;
+	}
+
+	if (Reader->Handler == NULL && Reader->Map == NULL)
+	{
+		retData = FILE_IF_ERROR_CAN_NOT_OPEN;
+	}
+	else
+	{
+		retData = File_ReaderOpenCompressed(Reader);
+		if (retData == FILE_IF_ERROR_OK)
+		{
+			retData = File_ReaderPeek(Reader, TRACE_HEADER_SIZE, &data, &length);
+		}
+		trace = (retData == FILE_IF_ERROR_OK) ? Trace_CheckHeader(data, length) : TRACE_ERROR_NOT_TRACE;
+		if (trace == TRACE_ERROR_OK)	/* Binary trace */
+		{
+			Reader->Format = FILE_IF_INPUT_FORMAT_TRACE;
+			File_ReaderSkip(Reader, TRACE_HEADER_SIZE);
+		}
+		else if (trace != TRACE_ERROR_NOT_TRACE)	/* Unsupported or truncated trace */
+		{
+			retData = FILE_IF_ERROR_BAD_FORMAT;
+		}
+		else if (retData == FILE_IF_ERROR_OK)
+		{
+			retData = File_ReaderNextLine(Reader, &header, &length);	/* Read the header */
+		}
+
+		if (retData == FILE_IF_ERROR_END_OF_FILE)	/* Empty file has no lines to read */
+		{
+			retData = FILE_IF_ERROR_OK;
+		}
+		else if (retData != FILE_IF_ERROR_OK)	/* The read bytes must never be replayed as lines */
+		{
+			File_ReaderClose(Reader);
+			Reader->Start = 0;
+			Reader->End = 0;
+		}
+	}
+	Reader->Error = retData;
+
+	return retData;
+}
+
+/**
+ *  \brief This function gets the next line of a reader object.
+ *
+ *  \param [in] Reader The reader object.
+ *  \param [out] Line Points to the first character of the line.
+ *  \param [out] Length The number of characters in the line.
+ *  \return \ref FileIf_Error_t type data.
+ */
+FileIf_Error_t File_ReaderNextLine(FileIf_Reader_t * Reader, const char ** Line,
+			unsigned int * Length)
+{
+	/* Needed variables */
+	FileIf_Error_t retData;
+
+	/* Function Logic */
+	PROFILE_BEGIN(PROFILE_STAGE_READ);
+	if (Reader->Map != NULL)
+	{
+		retData = File_ReaderNextMappedLine(Reader, Line, Length);
+	}
+	else
+	{
+		retData = File_ReaderNextStreamLine(Reader, Line, Length);
+	}
+	if (retData != FILE_IF_ERROR_OK && retData != FILE_IF_ERROR_END_OF_FILE)	/* Not the end of the file */
+	{
+		Reader->Error = retData;
+	}
+	PROFILE_END(PROFILE_STAGE_READ);
+
+	return retData;
+}
+
 /**
- *  \brief 		This is considered as initialization function
- *				for output file.
- *	\param		None.
- *	\return		None.
- *  \details	It creates the file if it doesn't exist or
- *  			clear it to be ready for writing if it exists.
+ *  \brief This function gets the next record of a reader object.
+ *
+ *  \param [in] Reader The reader object of a #FILE_IF_INPUT_FORMAT_TRACE file.
+ *  \param [out] Record The decoded record.
+ *  \return \ref FileIf_Error_t type data.
  */
-void File_PrepareOutputFile(void)
+FileIf_Error_t File_ReaderNextRecord(FileIf_Reader_t * Reader, struct Parse_Record_t * Record)
 {
-	if (File_Output_File_Handler == NULL)	/* The file haven't been opened ever */
+	/* Needed variables */
+	FileIf_Error_t retData = FILE_IF_ERROR_BAD_FORMAT;
+	const unsigned char * data;
+	unsigned int length;
+	unsigned int used;
+
+	/* Function Logic */
+	PROFILE_BEGIN(PROFILE_STAGE_READ);
+	if (Reader->Format == FILE_IF_INPUT_FORMAT_TRACE)
 	{
-		File_Output_File_Handler = fopen(FILE_IF_OUTPUT_FILE_FULL_PATH, "w");	/* Create and open the file */
-		fprintf(File_Output_File_Handler, "Motor angle\n");	/* Print file header */
-		fclose(File_Output_File_Handler);
+		retData = File_ReaderPeek(Reader, TRACE_RECORD_MAX_SIZE, &data, &length);
+		if (retData == FILE_IF_ERROR_OK)
+		{
+			if (Trace_DecodeRecord(data, length, Record, &used) == TRACE_ERROR_OK)
+			{
+				File_ReaderSkip(Reader, used);
+			}
+			else
+			{
+				retData = FILE_IF_ERROR_BAD_FORMAT;
+			}
+		}
+	}
+	if (retData != FILE_IF_ERROR_OK && retData != FILE_IF_ERROR_END_OF_FILE)	/* Not the end of the file */
+	{
+		Reader->Error = retData;
 	}
+	PROFILE_END(PROFILE_STAGE_READ);
+
+	return retData;
 }
 
 /**
- *  \brief 		This is considered as initialization function
- *				for input file.
- *	\param		None.
- *	\return		None.
- *	\details	It opens the file and read its header to be
- *				ready for reading process.
+ *  \brief This function copies the next whole lines of a reader object.
+ *
+ *  \param [in] Reader The reader object of a #FILE_IF_INPUT_FORMAT_TEXT file.
+ *  \param [out] Chunk The copied lines.
+ *  \param [in] Size The maximum number of copied bytes.
+ *  \param [out] Length The number of copied bytes.
+ *  \return \ref FileIf_Error_t type data.
+ *
+ *  \details The unread bytes are peeked once and cut after their last
+ *  		 "\n", the partial line after it is left for the next chunk.
  */
-void File_PrepareInputFile(void)
+FileIf_Error_t File_ReaderReadChunk(FileIf_Reader_t * Reader, char * Chunk, unsigned int Size,
+			unsigned int * Length)
 {
-	/* Needed Variables */
-	char tempdata;
-	int tempRet;
+	/* Needed variables */
+	FileIf_Error_t retData = FILE_IF_ERROR_BAD_FORMAT;
+	const unsigned char * data;
+	unsigned int count = (Reader->Map == NULL && Size > Reader->Size) ? Reader->Size : Size;
+	unsigned int length = 0;
 
 	/* Function Logic */
-	if (File_Input_File_Handler == NULL)	/* The file haven't been opened ever */
+	*Length = 0;
+	if (Reader->Format == FILE_IF_INPUT_FORMAT_TEXT)
 	{
-		File_Input_File_Handler = fopen(FILE_IF_INPUT_FILE_FULL_PATH, "r");	/* Open the file */
-		do /* Read the header */
+		retData = File_ReaderPeek(Reader, count, &data, &length);
+	}
+	if (retData == FILE_IF_ERROR_OK)
+	{
+		*Length = length;
+		if (length == count)	/* Not the end of the file, keep the partial last line */
 		{
-			tempRet = fscanf(File_Input_File_Handler, "%c", &tempdata);
-		} while (tempdata != '\n' && tempRet != EOF);	/* If line ends or file ends */
+			while (*Length != 0u && data[*Length - 1u] != '\n')
+			{
+				(*Length)--;
+			}
+			if (*Length == 0u)	/* Line is longer than a chunk */
+			{
+				*Length = length;
+			}
+		}
+		memcpy(Chunk, data, *Length);
+		File_ReaderSkip(Reader, *Length);
+	}
+	if (retData != FILE_IF_ERROR_OK && retData != FILE_IF_ERROR_END_OF_FILE)	/* Not the end of the file */
+	{
+		Reader->Error = retData;
 	}
+
+	return retData;
 }
 
 /**
- *  \brief 	This function used to read a line of text from
- *  		input file.
+ *  \brief This function closes the input file of a reader object.
  *
- *  \param [out] 	Return_Reference char * for holding the
- *  				return text line.
+ *  \param [in] Reader The reader object.
+ *  \return None.
+ */
+void File_ReaderClose(FileIf_Reader_t * Reader)
+{
+	FileIfCompress_Close(Reader->Compress_Stream);
+	Reader->Compress_Stream = NULL;
+	if (Reader->Handler != NULL)
+	{
+		if (Reader->Handler != stdin)	/* The standard input stays opened */
+		{
+			fclose(Reader->Handler);
+		}
+		Reader->Handler = NULL;
+	}
+#ifdef FILE_IF_MMAP_SUPPORTED
+	if (Reader->Map != NULL)
+	{
+		munmap((void *)Reader->Map, Reader->Map_Size);
+		Reader->Map = NULL;
+	}
+#endif
+}
+
+/**
+ *  \brief This function flushes the buffered lines to the output file.
+ *
+ *  \return \ref FileIf_Error_t type data.
+ */
+FileIf_Error_t File_FlushOutputFile(void)
+{
+	return File_WriterFlush(&File_Output_Writer);
+}
+
+/**
+ *  \brief This function flushes the buffered lines and closes the
+ *  		output file.
  *
  *  \return \ref FileIf_Error_t type data.
+ */
+FileIf_Error_t File_CloseOutputFile(void)
+{
+	return File_WriterClose(&File_Output_Writer);
+}
+
+/**
+ *  \brief This function sets the flush policy of the output file.
  *
- *  \details 	It reads the next line from the input file text
- *  			and return an error code:
- *  			- #FILE_IF_ERROR_OK: Reading done successfully
- *  			- #FILE_IF_ERROR_CAN_NOT_OPEN: Can't open the
- *  											input file.
- *  			- #FILE_IF_ERROR_CAN_NOT_READ: Can't read from the
- *  											input file.
- *  			- #FILE_IF_ERROR_END_OF_FILE:	Reaches the end of file.
+ *  \param [in] Policy The new \ref FileIf_FlushPolicy_t.
+ *  \return None.
+ */
+void File_SetOutputFlushPolicy(FileIf_FlushPolicy_t Policy)
+{
+	File_Output_Policy = Policy;
+	File_Output_Writer.Policy = Policy;
+}
+
+/**
+ *  \brief This function sets the format of the output file.
  *
+ *  \param [in] Format The new \ref FileIf_OutputFormat_t.
+ *  \return None.
  */
-FileIf_Error_t File_ReadLine(char * Return_Reference)
+void File_SetOutputFormat(FileIf_OutputFormat_t Format)
+{
+	File_Output_Format = Format;
+}
+
+/**
+ *  \brief This function sets the path of the input file.
+ *
+ *  \param [in] Path The path of the input file, it must stay valid.
+ *  \return None.
+ */
+void File_SetInputPath(const char * Path)
+{
+	File_Input_Path = Path;
+}
+
+/**
+ *  \brief This function sets the path of the output file.
+ *
+ *  \param [in] Path The path of the output file, it must stay valid.
+ *  			NULL selects the default path of the output format.
+ *  \return None.
+ */
+void File_SetOutputPath(const char * Path)
+{
+	File_Output_Path = Path;
+}
+
+/**
+ *  \brief This function opens an output text file for a writer object.
+ *
+ *  \param [out] Writer The writer object to be opened.
+ *  \param [in] Path The path of the output text file.
+ *  \param [in] Buffer The user-space buffer of the writer.
+ *  \param [in] Size The size of \p Buffer in bytes.
+ *  \return \ref FileIf_Error_t type data.
+ */
+FileIf_Error_t File_WriterOpen(FileIf_Writer_t * Writer, const char * Path,
+			char * Buffer, unsigned int Size)
+{
+	return File_WriterOpenFormat(Writer, Path, Buffer, Size, FILE_IF_OUTPUT_FORMAT_TEXT);
+}
+
+/**
+ *  \brief This function opens an output file for a writer object
+ *  		with a selected output format.
+ *
+ *  \param [out] Writer The writer object to be opened.
+ *  \param [in] Path The path of the output file.
+ *  \param [in] Buffer The user-space buffer of the writer.
+ *  \param [in] Size The size of \p Buffer in bytes.
+ *  \param [in] Format The \ref FileIf_OutputFormat_t of the file.
+ *  \return \ref FileIf_Error_t type data.
+ */
+FileIf_Error_t File_WriterOpenFormat(FileIf_Writer_t * Writer, const char * Path,
+			char * Buffer, unsigned int Size, FileIf_OutputFormat_t Format)
+{
+	return File_WriterOpenCompressed(Writer, Path, Buffer, Size, Format, FileIfCompress_GetPathCompression(Path));
+}
+
+/**
+ *  \brief This function opens an output file for a writer object
+ *  		with a selected output format and compression.
+ *
+ *  \param [out] Writer The writer object to be opened.
+ *  \param [in] Path The path of the output file.
+ *  \param [in] Buffer The user-space buffer of the writer.
+ *  \param [in] Size The size of \p Buffer in bytes.
+ *  \param [in] Format The \ref FileIf_OutputFormat_t of the file.
+ *  \param [in] Compression The \ref FileIf_Compression_t of the file.
+ *  \return \ref FileIf_Error_t type data.
+ */
+FileIf_Error_t File_WriterOpenCompressed(FileIf_Writer_t * Writer, const char * Path,
+			char * Buffer, unsigned int Size, FileIf_OutputFormat_t Format,
+			FileIf_Compression_t Compression)
 {
-    /* Needed data types */
-    FileIf_Error_t retData = FILE_IF_ERROR_OK;
-    char tempdata;
-    int index = 0;
-	int tempRet;
+	/* Needed variables */
+	FileIf_Error_t retData = FILE_IF_ERROR_OK;
+	unsigned char header[FILE_IF_RUN_LENGTH_HEADER_SIZE] = FILE_IF_RUN_LENGTH_MAGIC;
 
 	/* Function Logic */
-	if(File_Input_File_Handler == NULL)	/* If the file couldn't open */
-    {
-        retData = FILE_IF_ERROR_CAN_NOT_OPEN;
-        //printf("Can't Open The File\n");
-    }
+	Writer->Buffer = Buffer;
+	Writer->Size = (Buffer == NULL) ? 0u : Size;
+	Writer->Used = 0;
+	Writer->Pending_Lines = 0;
+	Writer->Policy.Every_Lines = 0;
+	Writer->Policy.Every_Ms = 0;
+	Writer->Policy.On_Exit = 1;
+	Writer->Format = Format;
+	Writer->Run_Data = 0;
+	Writer->Run_Count = 0;
+	Writer->Run_Previous = 0;
+	Writer->Compression = Compression;
+	Writer->Compress_Stream = NULL;
+	Writer->Handler = NULL;
+	if (Compression != FILE_IF_COMPRESSION_NONE && FileIfCompress_IsSupported(Compression) == 0)
+	{
+		retData = FILE_IF_ERROR_UNSUPPORTED;
+	}
+	else if ((Writer->Handler = File_Open(Path, "wb")) == NULL)	/* Create and open the file */
+	{
+		retData = FILE_IF_ERROR_CAN_NOT_OPEN;
+	}
 	else
 	{
-		tempRet = fscanf(File_Input_File_Handler, "%c", &tempdata);	/* Read the first character */
-		if (tempRet == EOF)	/* Check End Of File (EOF) */
+		if (Writer->Handler != stdout)	/* The standard output may be used already */
 		{
-			retData = FILE_IF_ERROR_END_OF_FILE;
-			//printf("End Of File\n");
-			fclose(File_Input_File_Handler);
+			setvbuf(Writer->Handler, NULL, _IONBF, 0);	/* The writer does its own buffering */
 		}
-		else
+		if (Compression != FILE_IF_COMPRESSION_NONE)
 		{
-			do /* Continue Reading */
+			Writer->Compress_Stream = FileIfCompress_OpenWriter(Compression, Writer->Handler);
+			if (Writer->Compress_Stream == NULL)
 			{
-				Return_Reference[index] = tempdata;
-				index++;
-				tempRet = fscanf(File_Input_File_Handler, "%c", &tempdata);
-			} while (tempdata != '\n' && tempRet != EOF);	/* If line ends or file ends */
+				retData = FILE_IF_ERROR_CAN_NOT_WRITE;
+			}
+		}
+		if (Format == FILE_IF_OUTPUT_FORMAT_RUN_LENGTH)
+		{
+			header[FILE_IF_RUN_LENGTH_MAGIC_SIZE] = FILE_IF_RUN_LENGTH_VERSION;
+			if (retData == FILE_IF_ERROR_OK &&
+				File_WriterPut(Writer, header, sizeof(header)) != FILE_IF_ERROR_OK)	/* Write file header */
+			{
+				retData = FILE_IF_ERROR_CAN_NOT_WRITE;
+			}
+		}
+		else if (retData == FILE_IF_ERROR_OK && File_WriterPut(Writer, FILE_IF_OUTPUT_FILE_HEADER,
+			sizeof(FILE_IF_OUTPUT_FILE_HEADER) - 1u) != FILE_IF_ERROR_OK)	/* Print file header */
+		{
+			retData = FILE_IF_ERROR_CAN_NOT_WRITE;
+		}
+		Writer->Last_Flush_Ms = File_GetTimeMs();
+	}
+
+	return retData;
+}
+
+/**
+ *  \brief This function writes a line to a writer object.
+ *
+ *  \param [in] Writer The writer object.
+ *  \param [in] Data The data needed to be written.
+ *  \return \ref FileIf_Error_t type data.
+ */
+FileIf_Error_t File_WriterWriteLine(FileIf_Writer_t * Writer, int Data)
+{
+	/* Needed variables */
+	FileIf_Error_t retData = FILE_IF_ERROR_OK;	/* For returning error identification */
+	char line[FILE_IF_OUTPUT_LINE_MAX_LENGTH];
+	unsigned int length;
+
+	/* Function Logic */
+	PROFILE_BEGIN(PROFILE_STAGE_WRITE);
+	if (Writer->Handler == NULL)	/* If the file couldn't open */
+	{
+		retData = FILE_IF_ERROR_CAN_NOT_OPEN;
+	}
+	else if (Writer->Format == FILE_IF_OUTPUT_FORMAT_RUN_LENGTH)
+	{
+		if (Writer->Run_Count == 0u || Data != Writer->Run_Data || Writer->Run_Count == ~0u)	/* New run */
+		{
+			retData = File_WriterEndRun(Writer);
+			Writer->Run_Data = Data;
+		}
+		Writer->Run_Count++;
+		Writer->Pending_Lines++;
+		if (File_WriterApplyPolicy(Writer) != FILE_IF_ERROR_OK)
+		{
+			retData = FILE_IF_ERROR_CAN_NOT_WRITE;
+		}
+	}
+	else if (Writer->Size < FILE_IF_OUTPUT_LINE_MAX_LENGTH)	/* No buffer */
+	{
+		length = File_FormatLine(line, Data);
+		if (File_WriterPut(Writer, line, length) != FILE_IF_ERROR_OK)	/* Error in writing */
+		{
+			retData = FILE_IF_ERROR_CAN_NOT_WRITE;
+		}
+	}
+	else
+	{
+		if (Writer->Size - Writer->Used < FILE_IF_OUTPUT_LINE_MAX_LENGTH)	/* Buffer is full */
+		{
+			retData = File_WriterFlush(Writer);
+		}
+		Writer->Used += File_FormatLine(Writer->Buffer + Writer->Used, Data);
+		Writer->Pending_Lines++;
+		if (File_WriterApplyPolicy(Writer) != FILE_IF_ERROR_OK)
+		{
+			retData = FILE_IF_ERROR_CAN_NOT_WRITE;
+		}
+	}
+
+	PROFILE_END(PROFILE_STAGE_WRITE);
+
+	return retData;
+}
+
+/**
+ *  \brief This function writes the same data to many lines of a writer object.
+ *
+ *  \param [in] Writer The writer object.
+ *  \param [in] Data The data needed to be written.
+ *  \param [in] Count The number of lines.
+ *  \return \ref FileIf_Error_t type data.
+ */
+FileIf_Error_t File_WriterWriteRepeat(FileIf_Writer_t * Writer, int Data, unsigned int Count)
+{
+	/* Needed variables */
+	FileIf_Error_t retData = FILE_IF_ERROR_OK;
+	char line[FILE_IF_OUTPUT_LINE_MAX_LENGTH];
+	unsigned int length;
+	unsigned int index;
 
-			Return_Reference[index] = 0;	/* End the string with Null terminator */
-			if (tempRet == EOF)	/* Close the file if it ends */
+	/* Function Logic */
+	PROFILE_BEGIN(PROFILE_STAGE_WRITE);
+	if (Writer->Handler == NULL)	/* If the file couldn't open */
+	{
+		retData = FILE_IF_ERROR_CAN_NOT_OPEN;
+	}
+	else if (Count != 0u)
+	{
+		if (Writer->Format == FILE_IF_OUTPUT_FORMAT_RUN_LENGTH)
+		{
+			if (Writer->Run_Count == 0u || Data != Writer->Run_Data || Writer->Run_Count > ~0u - Count)	/* New run */
+			{
+				retData = File_WriterEndRun(Writer);
+				Writer->Run_Data = Data;
+			}
+			Writer->Run_Count += Count;
+		}
+		else
+		{
+			/* The line is formatted once and copied */
+			length = File_FormatLine(line, Data);
+			for (index = 0; index < Count && retData == FILE_IF_ERROR_OK; index++)
 			{
-				//printf("End Of File\n");
-				fclose(File_Input_File_Handler);
+				if (Writer->Size < FILE_IF_OUTPUT_LINE_MAX_LENGTH)	/* No buffer */
+				{
+					if (File_WriterPut(Writer, line, length) != FILE_IF_ERROR_OK)	/* Error in writing */
+					{
+						retData = FILE_IF_ERROR_CAN_NOT_WRITE;
+					}
+				}
+				else
+				{
+					if (Writer->Size - Writer->Used < length)	/* Buffer is full */
+					{
+						retData = File_WriterFlush(Writer);
+					}
+					memcpy(Writer->Buffer + Writer->Used, line, length);
+					Writer->Used += length;
+				}
 			}
 		}
+		Writer->Pending_Lines += Count;
+		if (File_WriterApplyPolicy(Writer) != FILE_IF_ERROR_OK)
+		{
+			retData = FILE_IF_ERROR_CAN_NOT_WRITE;
+		}
 	}
 
-    return retData;
+	PROFILE_END(PROFILE_STAGE_WRITE);
+
+	return retData;
 }
 
 /**
- *  \brief This function used to write calculated data to output file.
+ *  \brief This function flushes the buffer of a writer object.
  *
- *  \param [in] Data the data needed to be written to output file.
+ *  \param [in] Writer The writer object.
  *  \return \ref FileIf_Error_t type data.
+ */
+FileIf_Error_t File_WriterFlush(FileIf_Writer_t * Writer)
+{
+	/* Needed variables */
+	FileIf_Error_t retData = FILE_IF_ERROR_OK;
+
+	/* Function Logic */
+	if (Writer->Handler == NULL)
+	{
+		retData = FILE_IF_ERROR_CAN_NOT_OPEN;
+	}
+	else
+	{
+		retData = File_WriterEndRun(Writer);
+		if (Writer->Used != 0u && File_WriterPut(Writer, Writer->Buffer, Writer->Used) != FILE_IF_ERROR_OK)
+		{
+			retData = FILE_IF_ERROR_CAN_NOT_WRITE;
+		}
+		if (Writer->Compress_Stream != NULL &&
+			FileIfCompress_Flush(Writer->Compress_Stream, 0) != FILE_IF_ERROR_OK)	/* Make the lines readable */
+		{
+			retData = FILE_IF_ERROR_CAN_NOT_WRITE;
+		}
+		if (Writer->Handler == stdout && fflush(Writer->Handler) != 0)	/* Buffered by the C library */
+		{
+			retData = FILE_IF_ERROR_CAN_NOT_WRITE;
+		}
+		Writer->Used = 0;
+		Writer->Pending_Lines = 0;
+		if (Writer->Policy.Every_Ms != 0u)
+		{
+			Writer->Last_Flush_Ms = File_GetTimeMs();
+		}
+	}
+
+	return retData;
+}
+
+/**
+ *  \brief This function flushes and closes a writer object.
  *
- *  \details It writes a calculated data to output file text
- *  			and return an error code:
- *  			- #FILE_IF_ERROR_OK: Reading done successfully
- *  			- #FILE_IF_ERROR_CAN_NOT_OPEN: Can't open the
- *  											output file.
- *  			- #FILE_IF_ERROR_CAN_NOT_WRITE: Can't write to
- *  											 the output file.
+ *  \param [in] Writer The writer object.
+ *  \return \ref FileIf_Error_t type data.
+ */
+FileIf_Error_t File_WriterClose(FileIf_Writer_t * Writer)
+{
+	/* Needed variables */
+	FileIf_Error_t retData;
+
+	/* Function Logic */
+	retData = File_WriterFlush(Writer);
+	if (Writer->Compress_Stream != NULL)	/* End the compressed file */
+	{
+		if (FileIfCompress_Flush(Writer->Compress_Stream, 1) != FILE_IF_ERROR_OK ||
+			(Writer->Handler == stdout && fflush(Writer->Handler) != 0))
+		{
+			retData = FILE_IF_ERROR_CAN_NOT_WRITE;
+		}
+		FileIfCompress_Close(Writer->Compress_Stream);
+		Writer->Compress_Stream = NULL;
+	}
+	if (Writer->Handler != NULL)
+	{
+		if (Writer->Handler != stdout && fclose(Writer->Handler) != 0)	/* The standard output stays opened */
+		{
+			retData = FILE_IF_ERROR_CAN_NOT_WRITE;
+		}
+		Writer->Handler = NULL;
+	}
+
+	return retData;
+}
+
+/**
+ *  \brief This function decodes one run of a run-length file.
  *
+ *  \param [in] Data The encoded run after the file header.
+ *  \param [in] Length The number of bytes of \p Data, it can be more
+ *  			than the run.
+ *  \param [in,out] Run_Data The data of the previous run, 0 for the
+ *  			first run, it's updated to the data of this run.
+ *  \param [out] Count The number of lines of the run.
+ *  \param [out] Used The number of bytes of the run.
+ *  \return \ref FileIf_Error_t type data.
  */
-FileIf_Error_t File_WriteLine(int Data)
+FileIf_Error_t File_DecodeRun(const unsigned char * Data, unsigned int Length,
+			int * Run_Data, unsigned int * Count, unsigned int * Used)
 {
 	/* Needed variables */
-	FileIf_Error_t retData = FILE_IF_ERROR_OK;	/* For returning error identification */
+	FileIf_Error_t retData = FILE_IF_ERROR_OK;
+	Trace_Error_t error;
+	unsigned int delta;
+	unsigned int deltaLength;
+	unsigned int countLength = 0;
 
 	/* Function Logic */
-	File_Output_File_Handler = fopen(FILE_IF_OUTPUT_FILE_FULL_PATH, "a");
-	if (fprintf(File_Output_File_Handler, "%d\n", Data) < 0)	/* Error in writing */
+	error = Trace_DecodeVarint(Data, Length, &delta, &deltaLength);
+	if (error == TRACE_ERROR_OK)
 	{
-		retData = FILE_IF_ERROR_CAN_NOT_WRITE;
+		error = Trace_DecodeVarint(Data + deltaLength, Length - deltaLength, Count, &countLength);
+	}
+
+	if (error == TRACE_ERROR_TRUNCATED)
+	{
+		retData = FILE_IF_ERROR_END_OF_FILE;
+	}
+	else if (error != TRACE_ERROR_OK || *Count == 0u)
+	{
+		retData = FILE_IF_ERROR_BAD_FORMAT;
+	}
+	else
+	{
+		*Run_Data = (int)((unsigned int)*Run_Data + ((delta >> 1) ^ (0u - (delta & 1u))));
+		*Used = deltaLength + countLength;
 	}
-	fclose(File_Output_File_Handler);
 
 	return retData;
 }
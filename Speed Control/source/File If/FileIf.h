@@ -13,8 +13,33 @@
 /* Macros */
 /**	This is the full path of input text file */
 #define FILE_IF_INPUT_FILE_FULL_PATH	"switches.txt"
+/**	This is the size of one block read from input text file */
+#define FILE_IF_INPUT_BUFFER_SIZE		(1024u * 1024u)
+/**	This is the maximum length of a line returned by \ref File_ReadLine
+ *  including the Null terminator */
+#define FILE_IF_LINE_MAX_LENGTH			84u
 /**	This is the full path of output text file */
 #define FILE_IF_OUTPUT_FILE_FULL_PATH	"motor.txt"
+/**	This is the header line of output text file */
+#define FILE_IF_OUTPUT_FILE_HEADER		"Motor angle\n"
+/**	This is the size of the user-space buffer of output text file */
+#define FILE_IF_OUTPUT_BUFFER_SIZE		(1024u * 1024u)
+/**	This is the maximum length of one output line "sign + 10 digits + \n" */
+#define FILE_IF_OUTPUT_LINE_MAX_LENGTH	12u
+/**	This is the full path of output run-length file */
+#define FILE_IF_OUTPUT_RUN_LENGTH_FULL_PATH	"motor.rle"
+/**	This is the first bytes of output run-length file, the first byte isn't a text character */
+#define FILE_IF_RUN_LENGTH_MAGIC		"\x89VCM"
+/**	This is the number of bytes of #FILE_IF_RUN_LENGTH_MAGIC */
+#define FILE_IF_RUN_LENGTH_MAGIC_SIZE	4u
+/**	This is the version of the run-length format */
+#define FILE_IF_RUN_LENGTH_VERSION		1u
+/**	This is the size of the run-length file header, the magic and the version */
+#define FILE_IF_RUN_LENGTH_HEADER_SIZE	(FILE_IF_RUN_LENGTH_MAGIC_SIZE + 1u)
+/**	This is the maximum size of one run, two varints of 5 bytes */
+#define FILE_IF_RUN_LENGTH_RUN_MAX_SIZE	10u
+/**	This is the path of the standard input for readers and the standard output for writers */
+#define FILE_IF_STANDARD_STREAM_PATH	"-"
 
 
 /* User-defined Data Types */
@@ -32,10 +57,173 @@ enum FileIf_Error_t{
 	/** Can't write data to the file */
     FILE_IF_ERROR_CAN_NOT_WRITE = 3,
 	/** Reaches the end of file */
-	FILE_IF_ERROR_END_OF_FILE = 4
+	FILE_IF_ERROR_END_OF_FILE = 4,
+	/** The input file is a trace of another version or it's corrupted */
+	FILE_IF_ERROR_BAD_FORMAT = 5,
+	/** The file is compressed by a compression that isn't built in */
+	FILE_IF_ERROR_UNSUPPORTED = 6
 };
 typedef enum FileIf_Error_t FileIf_Error_t;
 
+/**
+ *  This enum is for the ways of reading an input text file
+ */
+enum FileIf_InputMode_t
+{
+	/** The file is read in blocks through stdio, it works with pipes */
+	FILE_IF_INPUT_MODE_STREAM = 0,
+	/** The file is memory-mapped and lines are views into the mapping,
+	 *  it falls back to #FILE_IF_INPUT_MODE_STREAM if the file can't
+	 *  be mapped */
+	FILE_IF_INPUT_MODE_MAPPED = 1
+};
+typedef enum FileIf_InputMode_t FileIf_InputMode_t;
+
+/**
+ *  This enum is for the formats of an input file, it's detected
+ *  when the file is opened
+ */
+enum FileIf_InputFormat_t
+{
+	/** The input text file, it's read by lines */
+	FILE_IF_INPUT_FORMAT_TEXT = 0,
+	/** The binary trace described in "Trace.h", it's read by records */
+	FILE_IF_INPUT_FORMAT_TRACE = 1
+};
+typedef enum FileIf_InputFormat_t FileIf_InputFormat_t;
+
+/**
+ *  This enum is for the formats of an output file
+ */
+enum FileIf_OutputFormat_t
+{
+	/** The output text file, one decimal line for every data */
+	FILE_IF_OUTPUT_FORMAT_TEXT = 0,
+	/** The binary run-length file. It starts with #FILE_IF_RUN_LENGTH_MAGIC
+	 *  and the version byte #FILE_IF_RUN_LENGTH_VERSION. Every run of the
+	 *  same data is the zigzag varint of its difference from the data of
+	 *  the previous run, which is 0 before the first run, then the varint
+	 *  of the number of lines in the run. The varints are described in
+	 *  "Trace.h" */
+	FILE_IF_OUTPUT_FORMAT_RUN_LENGTH = 1
+};
+typedef enum FileIf_OutputFormat_t FileIf_OutputFormat_t;
+
+/**
+ *  This enum is for the compressions of a file. An input file is
+ *  detected by its first bytes and an output file by its path suffix,
+ *  see "FileIfCompress.h"
+ */
+enum FileIf_Compression_t
+{
+	/** The file isn't compressed */
+	FILE_IF_COMPRESSION_NONE = 0,
+	/** The file is gzip compressed, it's built in only if
+	 *  FILE_IF_COMPRESS_ENABLED is defined */
+	FILE_IF_COMPRESSION_GZIP = 1,
+	/** The file is zstd compressed, it's built in only if
+	 *  FILE_IF_COMPRESS_ENABLED and FILE_IF_ZSTD_ENABLED are defined */
+	FILE_IF_COMPRESSION_ZSTD = 2
+};
+typedef enum FileIf_Compression_t FileIf_Compression_t;
+
+/* The record of one line of the Parse module */
+struct Parse_Record_t;
+/* The state of a compressed file of "FileIfCompress.h" */
+struct FileIfCompress_Stream_t;
+
+/**
+ *  This struct is a reader object for an input text file.
+ *  The file is read in blocks into \p Buffer or mapped to \p Map
+ *  and the lines are handed back as slices of them.
+ */
+struct FileIf_Reader_t
+{
+	/** The input file handler, NULL if it's not opened or closed */
+	FILE * Handler;
+	/** The block buffer, it holds \p Size + 1 bytes */
+	char * Buffer;
+	/** The size of one block in bytes */
+	unsigned int Size;
+	/** The index of the first unread byte in \p Buffer */
+	unsigned int Start;
+	/** The index after the last loaded byte in \p Buffer */
+	unsigned int End;
+	/** Not 0 if the whole file was loaded */
+	int End_Of_File;
+	/** The input mode used by the reader */
+	FileIf_InputMode_t Mode;
+	/** The format of the input file */
+	FileIf_InputFormat_t Format;
+	/** The mapped file in #FILE_IF_INPUT_MODE_MAPPED mode */
+	const char * Map;
+	/** The size of \p Map in bytes */
+	size_t Map_Size;
+	/** The offset of the first unread byte in \p Map */
+	size_t Map_Position;
+	/** The compression of the input file */
+	FileIf_Compression_t Compression;
+	/** The decompression state of a compressed file, NULL otherwise */
+	struct FileIfCompress_Stream_t * Compress_Stream;
+	/** The error that stopped opening or reading the file, it stays
+	 *  #FILE_IF_ERROR_OK at the end of the file */
+	FileIf_Error_t Error;
+};
+typedef struct FileIf_Reader_t FileIf_Reader_t;
+
+/**
+ *  This struct is for deciding when the buffered output
+ *  is flushed to the output text file. The buffer is always
+ *  flushed when it gets full.
+ */
+struct FileIf_FlushPolicy_t
+{
+	/** Flush after writing this number of lines, 0 disables it */
+	unsigned int Every_Lines;
+	/** Flush if this number of milliseconds passed since the last
+	 *  flush, 0 disables it */
+	unsigned int Every_Ms;
+	/** Flush and close the file at program exit if it's not 0 */
+	int On_Exit;
+};
+typedef struct FileIf_FlushPolicy_t FileIf_FlushPolicy_t;
+
+/**
+ *  This struct is a writer object for an output text file.
+ *  The file is opened once and the written lines are collected
+ *  in \p Buffer until they are flushed according to \p Policy.
+ */
+struct FileIf_Writer_t
+{
+	/** The output file handler, NULL if it's not opened */
+	FILE * Handler;
+	/** The user-space buffer that holds the output lines */
+	char * Buffer;
+	/** The size of \p Buffer in bytes */
+	unsigned int Size;
+	/** The number of bytes waiting in \p Buffer */
+	unsigned int Used;
+	/** The number of lines written since the last flush */
+	unsigned int Pending_Lines;
+	/** The time of the last flush in milliseconds */
+	unsigned long Last_Flush_Ms;
+	/** When to flush \p Buffer to the file */
+	FileIf_FlushPolicy_t Policy;
+	/** The format of the output file */
+	FileIf_OutputFormat_t Format;
+	/** The data of the current run in #FILE_IF_OUTPUT_FORMAT_RUN_LENGTH format */
+	int Run_Data;
+	/** The number of lines of the current run, 0 if there's no run */
+	unsigned int Run_Count;
+	/** The data of the last run written to \p Buffer */
+	int Run_Previous;
+	/** The compression of the output file */
+	FileIf_Compression_t Compression;
+	/** The compression state of a compressed file, NULL otherwise */
+	struct FileIfCompress_Stream_t * Compress_Stream;
+};
+typedef struct FileIf_Writer_t FileIf_Writer_t;
+
 /* Functions prototypes */
 /**	
  *  \brief 		This is considered as initialization function 
@@ -44,6 +232,8 @@ typedef enum FileIf_Error_t FileIf_Error_t;
  *	\return		None.
  *  \details	It creates the file if it doesn't exist or 
  *  			clear it to be ready for writing if it exists.
+ *  			The file is kept opened until \ref File_CloseOutputFile
+ *  			is called or the program exits.
  */
 void File_PrepareOutputFile(void);
 
@@ -51,18 +241,30 @@ void File_PrepareOutputFile(void);
  *  \brief 		This is considered as initialization function 
  *				for input file. 
  *	\param		None.
- *	\return		None.
+ *	\return		\ref FileIf_Error_t type data.
  *	\details	It opens the file and read its header to be 
- *				ready for reading process.
+ *				ready for reading process. The file is read in
+ *				blocks of #FILE_IF_INPUT_BUFFER_SIZE bytes.
+ */
+FileIf_Error_t File_PrepareInputFile(void);
+
+/**
+ *  \brief 		This is considered as initialization function
+ *				for input file with a selected input mode.
+ *	\param [in]	Mode The \ref FileIf_InputMode_t to read the file with.
+ *	\return		\ref FileIf_Error_t type data.
+ *	\details	It's the same as \ref File_PrepareInputFile but it can
+ *				memory-map the file.
  */
-void File_PrepareInputFile(void);
+FileIf_Error_t File_PrepareInputFileMode(FileIf_InputMode_t Mode);
 
 /**
  *  \brief 	This function used to read a line of text from 
  *  		input file.
  *  
  *  \param [out] 	Return_Reference char * for holding the 
- *  				return text line.
+ *  				return text line, it must hold
+ *  				#FILE_IF_LINE_MAX_LENGTH characters.
  *  
  *  \return \ref FileIf_Error_t type data.
  *  
@@ -77,6 +279,59 @@ void File_PrepareInputFile(void);
  *  
  */
 FileIf_Error_t File_ReadLine(char * Return_Reference);
+
+/**
+ *  \brief 	This function used to get a view of the next line of
+ *  		input file without copying it.
+ *
+ *  \param [out] Line Points to the first character of the line.
+ *  \param [out] Length The number of characters in the line.
+ *
+ *  \return \ref FileIf_Error_t type data as \ref File_ReadLine.
+ *
+ *  \details The view is valid until the next reading and it's
+ *  			described in \ref File_ReaderNextLine.
+ */
+FileIf_Error_t File_ReadLineView(const char ** Line, unsigned int * Length);
+
+/**
+ *  \brief 	This function used to read the next record of input file
+ *  		if it's a binary trace.
+ *
+ *  \param [out] Record The decoded record.
+ *
+ *  \return \ref FileIf_Error_t type data as \ref File_ReaderNextRecord.
+ */
+FileIf_Error_t File_ReadRecord(struct Parse_Record_t * Record);
+
+/**
+ *  \brief 	This function used to copy the next whole lines of input file.
+ *
+ *  \param [out] Chunk The copied lines.
+ *  \param [in] Size The maximum number of copied bytes.
+ *  \param [out] Length The number of copied bytes.
+ *
+ *  \return \ref FileIf_Error_t type data as \ref File_ReaderReadChunk.
+ */
+FileIf_Error_t File_ReadChunk(char * Chunk, unsigned int Size, unsigned int * Length);
+
+/**
+ *  \brief 	This function gets the format of input file.
+ *
+ *  \return \ref FileIf_InputFormat_t type data.
+ */
+FileIf_InputFormat_t File_GetInputFormat(void);
+
+/**
+ *  \brief 	This function gets the error that stopped reading input file.
+ *
+ *  \return \ref FileIf_Error_t type data, #FILE_IF_ERROR_OK if input
+ *  		file is read to its end.
+ *
+ *  \details It tells a broken or truncated input file apart from its
+ *  		 end, both of them stop the reading functions.
+ */
+FileIf_Error_t File_GetInputError(void);
  
 /**
  *  \brief This function used to write calculated data to output file.
@@ -84,8 +339,9 @@ FileIf_Error_t File_ReadLine(char * Return_Reference);
  *  \param [in] Data the data needed to be written to output file.
  *  \return \ref FileIf_Error_t type data.
  *  
- *  \details It writes a calculated data to output file text 
- *  			and return an error code:
+ *  \details It writes a calculated data to the buffer of output file
+ *  			text, flushes it according to the flush policy and
+ *  			return an error code:
  *  			- #FILE_IF_ERROR_OK: Reading done successfully
  *  			- #FILE_IF_ERROR_CAN_NOT_OPEN: Can't open the 
  *  											output file.
@@ -94,4 +350,313 @@ FileIf_Error_t File_ReadLine(char * Return_Reference);
  *  
  */
 FileIf_Error_t File_WriteLine(int Data);
+
+/**
+ *  \brief This function used to write the same data to many lines of
+ *  		output file.
+ *
+ *  \param [in] Data The data needed to be written to output file.
+ *  \param [in] Count The number of lines.
+ *  \return \ref FileIf_Error_t type data as \ref File_WriteLine.
+ *
+ *  \details The output file is the same as calling \ref File_WriteLine
+ *  			\p Count times.
+ */
+FileIf_Error_t File_WriteRepeat(int Data, unsigned int Count);
+
+/**
+ *  \brief This function opens an input text file for a reader object.
+ *
+ *  \param [out] Reader The reader object to be opened.
+ *  \param [in] Path The path of the input text file.
+ *  \param [in] Buffer The block buffer, it must hold \p Size + 1 bytes.
+ *  \param [in] Size The size of one block in bytes.
+ *  \return \ref FileIf_Error_t type data.
+ *
+ *  \details It opens the file and reads its header to be ready
+ *  			for reading process.
+ */
+FileIf_Error_t File_ReaderOpen(FileIf_Reader_t * Reader, const char * Path,
+			char * Buffer, unsigned int Size);
+
+/**
+ *  \brief This function opens an input text file for a reader object
+ *  		with a selected input mode.
+ *
+ *  \param [out] Reader The reader object to be opened.
+ *  \param [in] Path The path of the input text file.
+ *  \param [in] Buffer The block buffer, it must hold \p Size + 1 bytes.
+ *  \param [in] Size The size of one block in bytes.
+ *  \param [in] Mode The requested \ref FileIf_InputMode_t.
+ *  \return \ref FileIf_Error_t type data.
+ *
+ *  \details In #FILE_IF_INPUT_MODE_MAPPED mode the file is mapped with
+ *  			sequential read-ahead hint and \p Buffer is only used for
+ *  			a last line that doesn't end with "\n". Pipes, empty files
+ *  			and systems without mmap use #FILE_IF_INPUT_MODE_STREAM.
+ *  			A file that starts with a trace header is read in
+ *  			#FILE_IF_INPUT_FORMAT_TRACE format, it returns
+ *  			#FILE_IF_ERROR_BAD_FORMAT for a trace of another version.
+ *  			The path #FILE_IF_STANDARD_STREAM_PATH reads the standard
+ *  			input in #FILE_IF_INPUT_MODE_STREAM mode, it isn't closed
+ *  			by \ref File_ReaderClose. A compressed file is detected
+ *  			by its first bytes and decompressed block by block in
+ *  			#FILE_IF_INPUT_MODE_STREAM mode, it returns
+ *  			#FILE_IF_ERROR_UNSUPPORTED if its compression isn't built in.
+ *  			The file is closed on any error, so no bytes of it are
+ *  			read as lines.
+ */
+FileIf_Error_t File_ReaderOpenMode(FileIf_Reader_t * Reader, const char * Path,
+			char * Buffer, unsigned int Size, FileIf_InputMode_t Mode);
+
+/**
+ *  \brief This function gets the next line of a reader object.
+ *
+ *  \param [in] Reader The reader object.
+ *  \param [out] Line Points to the first character of the line.
+ *  \param [out] Length The number of characters in the line.
+ *  \return \ref FileIf_Error_t type data.
+ *
+ *  \details The line is a slice of the reader buffer without its "\n"
+ *  			and it stays valid until the next call. It's always
+ *  			followed by "\n" or a Null terminator. Empty lines are
+ *  			skipped and a line longer than one block is split.
+ */
+FileIf_Error_t File_ReaderNextLine(FileIf_Reader_t * Reader, const char ** Line,
+			unsigned int * Length);
+
+/**
+ *  \brief This function gets the next record of a reader object.
+ *
+ *  \param [in] Reader The reader object of a #FILE_IF_INPUT_FORMAT_TRACE file.
+ *  \param [out] Record The decoded record.
+ *  \return \ref FileIf_Error_t type data.
+ *
+ *  \details The record is decoded without the parser. It returns
+ *  			#FILE_IF_ERROR_BAD_FORMAT for a text file and for a
+ *  			corrupted or truncated record.
+ */
+FileIf_Error_t File_ReaderNextRecord(FileIf_Reader_t * Reader, struct Parse_Record_t * Record);
+
+/**
+ *  \brief This function copies the next whole lines of a reader object.
+ *
+ *  \param [in] Reader The reader object of a #FILE_IF_INPUT_FORMAT_TEXT file.
+ *  \param [out] Chunk The copied lines.
+ *  \param [in] Size The maximum number of copied bytes.
+ *  \param [out] Length The number of copied bytes.
+ *  \return \ref FileIf_Error_t type data.
+ *
+ *  \details The chunk ends with "\n" unless it's the end of the file or
+ *  		 a line is longer than the chunk, then the line is split. In
+ *  		 #FILE_IF_INPUT_MODE_STREAM mode the chunk is at most one block.
+ *  		 Empty lines are copied, so the lines of the chunks are the
+ *  		 lines of \ref File_ReaderNextLine after skipping empty lines.
+ *  		 It returns #FILE_IF_ERROR_END_OF_FILE if there are no more
+ *  		 bytes and #FILE_IF_ERROR_BAD_FORMAT for a binary trace.
+ */
+FileIf_Error_t File_ReaderReadChunk(FileIf_Reader_t * Reader, char * Chunk, unsigned int Size,
+			unsigned int * Length);
+
+/**
+ *  \brief This function closes the input file of a reader object.
+ *
+ *  \param [in] Reader The reader object.
+ *  \return None.
+ */
+void File_ReaderClose(FileIf_Reader_t * Reader);
+
+/**
+ *  \brief This function flushes the buffered lines to the output file.
+ *
+ *  \return \ref FileIf_Error_t type data.
+ *
+ *  \details It returns #FILE_IF_ERROR_CAN_NOT_OPEN if the output
+ *  			file isn't prepared and #FILE_IF_ERROR_CAN_NOT_WRITE if
+ *  			the buffered lines couldn't be written.
+ */
+FileIf_Error_t File_FlushOutputFile(void);
+
+/**
+ *  \brief This function flushes the buffered lines and closes the
+ *  		output file.
+ *
+ *  \return \ref FileIf_Error_t type data.
+ *
+ *  \details After closing, \ref File_PrepareOutputFile can be called
+ *  			again to recreate the output file.
+ */
+FileIf_Error_t File_CloseOutputFile(void);
+
+/**
+ *  \brief This function sets the flush policy of the output file.
+ *
+ *  \param [in] Policy The new \ref FileIf_FlushPolicy_t.
+ *  \return None.
+ *
+ *  \details The default policy flushes only when the buffer
+ *  			gets full and at program exit.
+ */
+void File_SetOutputFlushPolicy(FileIf_FlushPolicy_t Policy);
+
+/**
+ *  \brief This function sets the format of the output file.
+ *
+ *  \param [in] Format The new \ref FileIf_OutputFormat_t.
+ *  \return None.
+ *
+ *  \details It's applied when the output file is prepared. The output
+ *  			file of #FILE_IF_OUTPUT_FORMAT_RUN_LENGTH format is
+ *  			#FILE_IF_OUTPUT_RUN_LENGTH_FULL_PATH.
+ */
+void File_SetOutputFormat(FileIf_OutputFormat_t Format);
+
+/**
+ *  \brief This function sets the path of the input file.
+ *
+ *  \param [in] Path The path of the input file, it must stay valid.
+ *  \return None.
+ *
+ *  \details It's applied when the input file is prepared, the default
+ *  			path is #FILE_IF_INPUT_FILE_FULL_PATH. The path
+ *  			#FILE_IF_STANDARD_STREAM_PATH reads the standard input.
+ */
+void File_SetInputPath(const char * Path);
+
+/**
+ *  \brief This function sets the path of the output file.
+ *
+ *  \param [in] Path The path of the output file, it must stay valid.
+ *  			NULL selects the default path of the output format.
+ *  \return None.
+ *
+ *  \details It's applied when the output file is prepared. The path
+ *  			#FILE_IF_STANDARD_STREAM_PATH writes to the standard output.
+ */
+void File_SetOutputPath(const char * Path);
+
+/**
+ *  \brief This function opens an output text file for a writer object.
+ *
+ *  \param [out] Writer The writer object to be opened.
+ *  \param [in] Path The path of the output text file.
+ *  \param [in] Buffer The user-space buffer of the writer.
+ *  \param [in] Size The size of \p Buffer in bytes.
+ *  \return \ref FileIf_Error_t type data.
+ *
+ *  \details It creates the file or clears it if it exists and writes
+ *  			the file header. If \p Size is less than
+ *  			#FILE_IF_OUTPUT_LINE_MAX_LENGTH every line is written
+ *  			directly to the file. The policy is set to the default one.
+ *  			The path #FILE_IF_STANDARD_STREAM_PATH writes to the standard
+ *  			output, it's flushed but not closed by \ref File_WriterClose.
+ */
+FileIf_Error_t File_WriterOpen(FileIf_Writer_t * Writer, const char * Path,
+			char * Buffer, unsigned int Size);
+
+/**
+ *  \brief This function opens an output file for a writer object
+ *  		with a selected output format.
+ *
+ *  \param [out] Writer The writer object to be opened.
+ *  \param [in] Path The path of the output file.
+ *  \param [in] Buffer The user-space buffer of the writer.
+ *  \param [in] Size The size of \p Buffer in bytes.
+ *  \param [in] Format The \ref FileIf_OutputFormat_t of the file.
+ *  \return \ref FileIf_Error_t type data.
+ *
+ *  \details It's the same as \ref File_WriterOpen. In
+ *  			#FILE_IF_OUTPUT_FORMAT_RUN_LENGTH format the current run is
+ *  			kept in the writer until a different data is written or
+ *  			the writer is flushed, so flushing after every line stores
+ *  			every line as a run. The file is compressed as
+ *  			\ref File_WriterOpenCompressed if its path ends with
+ *  			".gz" or ".zst".
+ */
+FileIf_Error_t File_WriterOpenFormat(FileIf_Writer_t * Writer, const char * Path,
+			char * Buffer, unsigned int Size, FileIf_OutputFormat_t Format);
+
+/**
+ *  \brief This function opens an output file for a writer object
+ *  		with a selected output format and compression.
+ *
+ *  \param [out] Writer The writer object to be opened.
+ *  \param [in] Path The path of the output file.
+ *  \param [in] Buffer The user-space buffer of the writer.
+ *  \param [in] Size The size of \p Buffer in bytes.
+ *  \param [in] Format The \ref FileIf_OutputFormat_t of the file.
+ *  \param [in] Compression The \ref FileIf_Compression_t of the file.
+ *  \return \ref FileIf_Error_t type data.
+ *
+ *  \details It's the same as \ref File_WriterOpenFormat. The written
+ *  			bytes are compressed when they are flushed and every flush
+ *  			makes them readable from the file. The compressed file is
+ *  			ended by \ref File_WriterClose. It returns
+ *  			#FILE_IF_ERROR_UNSUPPORTED without creating the file if
+ *  			\p Compression isn't built in.
+ */
+FileIf_Error_t File_WriterOpenCompressed(FileIf_Writer_t * Writer, const char * Path,
+			char * Buffer, unsigned int Size, FileIf_OutputFormat_t Format,
+			FileIf_Compression_t Compression);
+
+/**
+ *  \brief This function writes a line to a writer object.
+ *
+ *  \param [in] Writer The writer object.
+ *  \param [in] Data The data needed to be written.
+ *  \return \ref FileIf_Error_t type data.
+ */
+FileIf_Error_t File_WriterWriteLine(FileIf_Writer_t * Writer, int Data);
+
+/**
+ *  \brief This function writes the same data to many lines of a writer object.
+ *
+ *  \param [in] Writer The writer object.
+ *  \param [in] Data The data needed to be written.
+ *  \param [in] Count The number of lines.
+ *  \return \ref FileIf_Error_t type data.
+ *
+ *  \details The file is the same as calling \ref File_WriterWriteLine
+ *  			\p Count times. The text line is formatted once and the
+ *  			#FILE_IF_OUTPUT_FORMAT_RUN_LENGTH format adds \p Count to
+ *  			the current run. The flush policy is applied once after
+ *  			all lines, so a policy of every N lines may flush after
+ *  			more than N lines.
+ */
+FileIf_Error_t File_WriterWriteRepeat(FileIf_Writer_t * Writer, int Data, unsigned int Count);
+
+/**
+ *  \brief This function flushes the buffer of a writer object.
+ *
+ *  \param [in] Writer The writer object.
+ *  \return \ref FileIf_Error_t type data.
+ */
+FileIf_Error_t File_WriterFlush(FileIf_Writer_t * Writer);
+
+/**
+ *  \brief This function flushes and closes a writer object.
+ *
+ *  \param [in] Writer The writer object.
+ *  \return \ref FileIf_Error_t type data.
+ */
+FileIf_Error_t File_WriterClose(FileIf_Writer_t * Writer);
+
+/**
+ *  \brief This function decodes one run of a run-length file.
+ *
+ *  \param [in] Data The encoded run after the file header.
+ *  \param [in] Length The number of bytes of \p Data, it can be more
+ *  			than the run.
+ *  \param [in,out] Run_Data The data of the previous run, 0 for the
+ *  			first run, it's updated to the data of this run.
+ *  \param [out] Count The number of lines of the run.
+ *  \param [out] Used The number of bytes of the run.
+ *  \return \ref FileIf_Error_t type data.
+ *
+ *  \details It returns #FILE_IF_ERROR_END_OF_FILE if \p Data ends in
+ *  			the middle of the run and #FILE_IF_ERROR_BAD_FORMAT for a
+ *  			corrupted run. \p Run_Data is updated only for a whole run.
+ */
+FileIf_Error_t File_DecodeRun(const unsigned char * Data, unsigned int Length,
+			int * Run_Data, unsigned int * Count, unsigned int * Used);
 #endif // FILE_IF_H_
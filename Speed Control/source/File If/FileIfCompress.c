@@ -0,0 +1,684 @@
+/**
+ *  \file	FileIfCompress.c
+ *  \brief	This file includes the implementation of handling the
+ *  		compressed input and output files of the File If module.
+ *  \author Ahmed Wageh.
+ *  \details	Every state has one block of compressed data. A reader
+ *  			loads the block from the file and decompresses it into
+ *  			the reader buffer, a writer compresses into the block and
+ *  			writes it to the file when it's full or flushed. Without
+ *  			#FILE_IF_COMPRESS_ENABLED compressed files are only
+ *  			detected and no state is ever started.
+ */
+/* Inclusion */
+#include <stdlib.h>
+#include <string.h>
+#include "FileIfCompress.h"
+#ifdef FILE_IF_COMPRESS_ENABLED
+#include <zlib.h>
+#ifdef FILE_IF_ZSTD_ENABLED
+#include <zstd.h>
+#endif
+
+/* Macros */
+/** The window bits of zlib for the gzip wrapper */
+#define FILE_IF_COMPRESS_GZIP_WINDOW	(MAX_WBITS + 16)
+
+/* User-defined data types */
+/**
+ *  This enum is for the ways of compressing the written data.
+ */
+enum FileIfCompress_Flush_t
+{
+	/** The compressed bytes may be kept in the compressor */
+	FILE_IF_COMPRESS_FLUSH_NONE = 0,
+	/** All compressed bytes are put into the block */
+	FILE_IF_COMPRESS_FLUSH_SYNC = 1,
+	/** The compressed file is ended */
+	FILE_IF_COMPRESS_FLUSH_FINISH = 2
+};
+typedef enum FileIfCompress_Flush_t FileIfCompress_Flush_t;
+
+/**
+ *  This struct is the state of decompressing an input file or
+ *  compressing an output file.
+ */
+struct FileIfCompress_Stream_t
+{
+	/** The compression of the file */
+	FileIf_Compression_t Compression;
+	/** The opened file */
+	FILE * Handler;
+	/** The block of compressed data, it holds #FILE_IF_COMPRESS_BLOCK_SIZE bytes */
+	unsigned char * Buffer;
+	/** The index of the first unread compressed byte of a reader */
+	unsigned int Start;
+	/** The index after the last compressed byte in \p Buffer */
+	unsigned int End;
+	/** Not 0 if the whole input file was loaded */
+	int End_Of_Input;
+	/** Not 0 if the last gzip member or zstd frame was ended */
+	int Frame_End;
+	/** Not 0 if the last decompression filled its output, so the
+	 *  decompressor may still hold decompressed bytes */
+	int Pending;
+	/** Not 0 for a writer */
+	int Writing;
+	/** Not 0 if \p Gzip is initialized */
+	int Gzip_Ready;
+	/** The zlib state of a gzip file */
+	z_stream Gzip;
+#ifdef FILE_IF_ZSTD_ENABLED
+	/** The zstd state of a zstd input file */
+	ZSTD_DCtx * Zstd_Reader;
+	/** The zstd state of a zstd output file */
+	ZSTD_CCtx * Zstd_Writer;
+#endif
+};
+
+/* Private functions proto-type */
+/**
+ *  \brief Allocates a state with its block of compressed data.
+ *
+ *  \param [in] Compression The \ref FileIf_Compression_t of the file.
+ *  \param [in] Handler The opened file.
+ *  \return The state, NULL if it can't be allocated.
+ */
+static FileIfCompress_Stream_t * FileIfCompress_Allocate(FileIf_Compression_t Compression, FILE * Handler);
+
+/**
+ *  \brief Decompresses the unread compressed bytes of a reader.
+ *
+ *  \param [in] Stream The decompression state.
+ *  \param [out] Buffer The decompressed bytes.
+ *  \param [in] Size The size of \p Buffer in bytes.
+ *  \param [in,out] Count The number of decompressed bytes is added to it.
+ *  \return \ref FileIf_Error_t type data.
+ */
+static FileIf_Error_t FileIfCompress_Decompress(FileIfCompress_Stream_t * Stream, char * Buffer,
+			unsigned int Size, unsigned int * Count);
+
+/**
+ *  \brief Compresses bytes of a writer into its block.
+ *
+ *  \param [in] Stream The compression state.
+ *  \param [in] Data The bytes to be compressed.
+ *  \param [in] Length The number of bytes of \p Data.
+ *  \param [in] Flush The \ref FileIfCompress_Flush_t.
+ *  \return \ref FileIf_Error_t type data.
+ */
+static FileIf_Error_t FileIfCompress_Compress(FileIfCompress_Stream_t * Stream, const void * Data,
+			unsigned int Length, FileIfCompress_Flush_t Flush);
+
+/**
+ *  \brief Writes the block of a writer to the output file.
+ *
+ *  \param [in] Stream The compression state.
+ *  \return \ref FileIf_Error_t type data.
+ */
+static FileIf_Error_t FileIfCompress_WriteBlock(FileIfCompress_Stream_t * Stream);
+
+/* Functions definition */
+/* Private functions */
+/**
+ *  \brief Allocates a state with its block of compressed data.
+ *
+ *  \param [in] Compression The \ref FileIf_Compression_t of the file.
+ *  \param [in] Handler The opened file.
+ *  \return The state, NULL if it can't be allocated.
+ */
+static FileIfCompress_Stream_t * FileIfCompress_Allocate(FileIf_Compression_t Compression, FILE * Handler)
+{
+	/* Needed variables */
+	FileIfCompress_Stream_t * retStream = NULL;
+
+	/* Function Logic */
+	if (FileIfCompress_IsSupported(Compression))
+	{
+		retStream = (FileIfCompress_Stream_t *)calloc(1, sizeof(FileIfCompress_Stream_t));
+		if (retStream != NULL)
+		{
+			retStream->Compression = Compression;
+			retStream->Handler = Handler;
+			retStream->Buffer = (unsigned char *)malloc(FILE_IF_COMPRESS_BLOCK_SIZE);
+			if (retStream->Buffer == NULL)
+			{
+				free(retStream);
+				retStream = NULL;
+			}
+		}
+	}
+
+	return retStream;
+}
+
+/**
+ *  \brief Decompresses the unread compressed bytes of a reader.
+ *
+ *  \param [in] Stream The decompression state.
+ *  \param [out] Buffer The decompressed bytes.
+ *  \param [in] Size The size of \p Buffer in bytes.
+ *  \param [in,out] Count The number of decompressed bytes is added to it.
+ *  \return \ref FileIf_Error_t type data.
+ *
+ *  \details A gzip member that follows an ended member is started again.
+ */
+static FileIf_Error_t FileIfCompress_Decompress(FileIfCompress_Stream_t * Stream, char * Buffer,
+			unsigned int Size, unsigned int * Count)
+{
+	/* Needed variables */
+	FileIf_Error_t retData = FILE_IF_ERROR_OK;
+	int result;
+#ifdef FILE_IF_ZSTD_ENABLED
+	ZSTD_inBuffer input;
+	ZSTD_outBuffer output;
+	size_t remaining;
+#endif
+
+	/* Function Logic */
+	if (Stream->Compression == FILE_IF_COMPRESSION_GZIP)
+	{
+		if (Stream->Frame_End != 0)	/* Next member */
+		{
+			inflateReset(&Stream->Gzip);
+			Stream->Frame_End = 0;
+		}
+		Stream->Gzip.next_in = Stream->Buffer + Stream->Start;
+		Stream->Gzip.avail_in = Stream->End - Stream->Start;
+		Stream->Gzip.next_out = (Bytef *)Buffer;
+		Stream->Gzip.avail_out = Size;
+		result = inflate(&Stream->Gzip, Z_NO_FLUSH);
+		Stream->Start = Stream->End - Stream->Gzip.avail_in;
+		*Count += Size - Stream->Gzip.avail_out;
+		Stream->Frame_End = (result == Z_STREAM_END);
+		Stream->Pending = (result != Z_STREAM_END && Stream->Gzip.avail_out == 0u);
+		if (result != Z_OK && result != Z_STREAM_END && result != Z_BUF_ERROR)	/* No progress isn't an error */
+		{
+			retData = FILE_IF_ERROR_BAD_FORMAT;
+		}
+	}
+#ifdef FILE_IF_ZSTD_ENABLED
+	else
+	{
+		input.src = Stream->Buffer;
+		input.size = Stream->End;
+		input.pos = Stream->Start;
+		output.dst = Buffer;
+		output.size = Size;
+		output.pos = 0;
+		remaining = ZSTD_decompressStream(Stream->Zstd_Reader, &output, &input);
+		Stream->Start = (unsigned int)input.pos;
+		*Count += (unsigned int)output.pos;
+		Stream->Frame_End = (remaining == 0u);
+		Stream->Pending = (output.pos == output.size);
+		if (ZSTD_isError(remaining))
+		{
+			retData = FILE_IF_ERROR_BAD_FORMAT;
+		}
+	}
+#endif
+
+	return retData;
+}
+
+/**
+ *  \brief Compresses bytes of a writer into its block.
+ *
+ *  \param [in] Stream The compression state.
+ *  \param [in] Data The bytes to be compressed.
+ *  \param [in] Length The number of bytes of \p Data.
+ *  \param [in] Flush The \ref FileIfCompress_Flush_t.
+ *  \return \ref FileIf_Error_t type data.
+ *
+ *  \details The block is written to the file whenever it gets full.
+ */
+static FileIf_Error_t FileIfCompress_Compress(FileIfCompress_Stream_t * Stream, const void * Data,
+			unsigned int Length, FileIfCompress_Flush_t Flush)
+{
+	/* Needed variables */
+	static const int gzipFlush[] = {Z_NO_FLUSH, Z_SYNC_FLUSH, Z_FINISH};
+	FileIf_Error_t retData = FILE_IF_ERROR_OK;
+	int more = 1;
+	int result;
+#ifdef FILE_IF_ZSTD_ENABLED
+	static const ZSTD_EndDirective zstdFlush[] = {ZSTD_e_continue, ZSTD_e_flush, ZSTD_e_end};
+	ZSTD_inBuffer input = {Data, Length, 0};
+	ZSTD_outBuffer output;
+	size_t remaining;
+#endif
+
+	/* Function Logic */
+	Stream->Gzip.next_in = (Bytef *)Data;
+	Stream->Gzip.avail_in = Length;
+	while (retData == FILE_IF_ERROR_OK && more != 0)
+	{
+		if (Stream->End == FILE_IF_COMPRESS_BLOCK_SIZE)	/* Block is full */
+		{
+			retData = FileIfCompress_WriteBlock(Stream);
+		}
+		if (Stream->Compression == FILE_IF_COMPRESSION_GZIP)
+		{
+			Stream->Gzip.next_out = Stream->Buffer + Stream->End;
+			Stream->Gzip.avail_out = FILE_IF_COMPRESS_BLOCK_SIZE - Stream->End;
+			result = deflate(&Stream->Gzip, gzipFlush[Flush]);
+			Stream->End = FILE_IF_COMPRESS_BLOCK_SIZE - Stream->Gzip.avail_out;
+			/* The output is complete when the compressor doesn't fill the block */
+			more = (Stream->Gzip.avail_in != 0u || Stream->Gzip.avail_out == 0u);
+			if (result == Z_STREAM_ERROR)
+			{
+				retData = FILE_IF_ERROR_CAN_NOT_WRITE;
+			}
+		}
+#ifdef FILE_IF_ZSTD_ENABLED
+		else
+		{
+			output.dst = Stream->Buffer;
+			output.size = FILE_IF_COMPRESS_BLOCK_SIZE;
+			output.pos = Stream->End;
+			remaining = ZSTD_compressStream2(Stream->Zstd_Writer, &output, &input, zstdFlush[Flush]);
+			Stream->End = (unsigned int)output.pos;
+			more = (input.pos < input.size || (Flush != FILE_IF_COMPRESS_FLUSH_NONE && remaining != 0u));
+			if (ZSTD_isError(remaining))
+			{
+				retData = FILE_IF_ERROR_CAN_NOT_WRITE;
+			}
+		}
+#endif
+	}
+
+	return retData;
+}
+
+/**
+ *  \brief Writes the block of a writer to the output file.
+ *
+ *  \param [in] Stream The compression state.
+ *  \return \ref FileIf_Error_t type data.
+ */
+static FileIf_Error_t FileIfCompress_WriteBlock(FileIfCompress_Stream_t * Stream)
+{
+	/* Needed variables */
+	FileIf_Error_t retData = FILE_IF_ERROR_OK;
+
+	/* Function Logic */
+	if (Stream->End != 0u && fwrite(Stream->Buffer, 1, Stream->End, Stream->Handler) != Stream->End)
+	{
+		retData = FILE_IF_ERROR_CAN_NOT_WRITE;
+	}
+	Stream->End = 0;
+
+	return retData;
+}
+
+#endif
+
+/* Public functions */
+/**
+ *  \brief To detect the compression of a file from its first bytes.
+ *
+ *  \param [in] Data The first bytes of the file.
+ *  \param [in] Length The number of bytes of \p Data.
+ *  \return \ref FileIf_Compression_t type data.
+ *
+ *  \details gzip files start with 1F 8B and the deflate method 08,
+ *  		 zstd frames start with 28 B5 2F FD.
+ */
+FileIf_Compression_t FileIfCompress_Detect(const unsigned char * Data, unsigned int Length)
+{
+	/* Needed variables */
+	FileIf_Compression_t retCompression = FILE_IF_COMPRESSION_NONE;
+
+	/* Function Logic */
+	if (Length >= 3u && Data[0] == 0x1Fu && Data[1] == 0x8Bu && Data[2] == 0x08u)
+	{
+		retCompression = FILE_IF_COMPRESSION_GZIP;
+	}
+	else if (Length >= 4u && Data[0] == 0x28u && Data[1] == 0xB5u && Data[2] == 0x2Fu && Data[3] == 0xFDu)
+	{
+		retCompression = FILE_IF_COMPRESSION_ZSTD;
+	}
+
+	return retCompression;
+}
+
+/**
+ *  \brief To get the compression of an output file from its path suffix.
+ *
+ *  \param [in] Path The path of the file.
+ *  \return \ref FileIf_Compression_t type data.
+ */
+FileIf_Compression_t FileIfCompress_GetPathCompression(const char * Path)
+{
+	/* Needed variables */
+	FileIf_Compression_t retCompression = FILE_IF_COMPRESSION_NONE;
+	size_t length = strlen(Path);
+
+	/* Function Logic */
+	if (length >= sizeof(FILE_IF_COMPRESS_GZIP_SUFFIX) - 1u &&
+		strcmp(Path + length - (sizeof(FILE_IF_COMPRESS_GZIP_SUFFIX) - 1u), FILE_IF_COMPRESS_GZIP_SUFFIX) == 0)
+	{
+		retCompression = FILE_IF_COMPRESSION_GZIP;
+	}
+	else if (length >= sizeof(FILE_IF_COMPRESS_ZSTD_SUFFIX) - 1u &&
+		strcmp(Path + length - (sizeof(FILE_IF_COMPRESS_ZSTD_SUFFIX) - 1u), FILE_IF_COMPRESS_ZSTD_SUFFIX) == 0)
+	{
+		retCompression = FILE_IF_COMPRESSION_ZSTD;
+	}
+
+	return retCompression;
+}
+
+/**
+ *  \brief To check if a compression is built in.
+ *
+ *  \param [in] Compression The \ref FileIf_Compression_t.
+ *  \return Not 0 if files of \p Compression can be read and written.
+ */
+int FileIfCompress_IsSupported(FileIf_Compression_t Compression)
+{
+#if defined(FILE_IF_COMPRESS_ENABLED) && defined(FILE_IF_ZSTD_ENABLED)
+	return (Compression == FILE_IF_COMPRESSION_GZIP || Compression == FILE_IF_COMPRESSION_ZSTD);
+#elif defined(FILE_IF_COMPRESS_ENABLED)
+	return (Compression == FILE_IF_COMPRESSION_GZIP);
+#else
+	(void)Compression;
+	return 0;
+#endif
+}
+
+#ifdef FILE_IF_COMPRESS_ENABLED
+
+/**
+ *  \brief To start decompressing an input file.
+ *
+ *  \param [in] Compression The detected \ref FileIf_Compression_t.
+ *  \param [in] Handler The opened input file.
+ *  \param [in] Data The bytes already read from \p Handler.
+ *  \param [in] Length The number of bytes of \p Data.
+ *  \return The decompression state, NULL if it can't be started.
+ */
+FileIfCompress_Stream_t * FileIfCompress_OpenReader(FileIf_Compression_t Compression, FILE * Handler,
+			const unsigned char * Data, unsigned int Length)
+{
+	/* Needed variables */
+	FileIfCompress_Stream_t * retStream = FileIfCompress_Allocate(Compression, Handler);
+	int ready = 0;
+
+	/* Function Logic */
+	if (retStream != NULL)
+	{
+		memcpy(retStream->Buffer, Data, Length);
+		retStream->End = Length;
+		if (Compression == FILE_IF_COMPRESSION_GZIP)
+		{
+			retStream->Gzip_Ready = ready = (inflateInit2(&retStream->Gzip, FILE_IF_COMPRESS_GZIP_WINDOW) == Z_OK);
+		}
+#ifdef FILE_IF_ZSTD_ENABLED
+		else
+		{
+			retStream->Zstd_Reader = ZSTD_createDCtx();
+			ready = (retStream->Zstd_Reader != NULL);
+		}
+#endif
+		if (ready == 0)
+		{
+			FileIfCompress_Close(retStream);
+			retStream = NULL;
+		}
+	}
+
+	return retStream;
+}
+
+/**
+ *  \brief To read the next decompressed bytes.
+ *
+ *  \param [in] Stream The decompression state.
+ *  \param [out] Buffer The decompressed bytes.
+ *  \param [in] Size The size of \p Buffer in bytes.
+ *  \param [out] Count The number of decompressed bytes.
+ *  \return \ref FileIf_Error_t type data.
+ *
+ *  \details The compressed file ends in the middle of a member or a
+ *  		 frame if it's truncated.
+ */
+FileIf_Error_t FileIfCompress_Read(FileIfCompress_Stream_t * Stream, char * Buffer, unsigned int Size,
+			unsigned int * Count)
+{
+	/* Needed variables */
+	FileIf_Error_t retData = FILE_IF_ERROR_OK;
+	int done = 0;
+
+	/* Function Logic */
+	*Count = 0;
+	while (retData == FILE_IF_ERROR_OK && *Count < Size && done == 0)
+	{
+		if (Stream->Start != Stream->End || Stream->Pending != 0)
+		{
+			retData = FileIfCompress_Decompress(Stream, Buffer + *Count, Size - *Count, Count);
+		}
+		else if (Stream->End_Of_Input == 0)	/* Load the next compressed block */
+		{
+			Stream->Start = 0;
+			Stream->End = (unsigned int)fread(Stream->Buffer, 1, FILE_IF_COMPRESS_BLOCK_SIZE, Stream->Handler);
+			if (Stream->End == 0u)
+			{
+				if (ferror(Stream->Handler))
+				{
+					retData = FILE_IF_ERROR_CAN_NOT_READ;
+				}
+				Stream->End_Of_Input = 1;
+			}
+		}
+		else
+		{
+			if (Stream->Frame_End == 0)	/* Truncated file */
+			{
+				retData = FILE_IF_ERROR_BAD_FORMAT;
+			}
+			done = 1;
+		}
+	}
+
+	return retData;
+}
+
+/**
+ *  \brief To start compressing an output file.
+ *
+ *  \param [in] Compression The \ref FileIf_Compression_t of the file.
+ *  \param [in] Handler The opened output file.
+ *  \return The compression state, NULL if it can't be started.
+ */
+FileIfCompress_Stream_t * FileIfCompress_OpenWriter(FileIf_Compression_t Compression, FILE * Handler)
+{
+	/* Needed variables */
+	FileIfCompress_Stream_t * retStream = FileIfCompress_Allocate(Compression, Handler);
+	int ready = 0;
+
+	/* Function Logic */
+	if (retStream != NULL)
+	{
+		retStream->Writing = 1;
+		if (Compression == FILE_IF_COMPRESSION_GZIP)
+		{
+			retStream->Gzip_Ready = ready = (deflateInit2(&retStream->Gzip, FILE_IF_COMPRESS_GZIP_LEVEL,
+				Z_DEFLATED, FILE_IF_COMPRESS_GZIP_WINDOW, 8, Z_DEFAULT_STRATEGY) == Z_OK);
+		}
+#ifdef FILE_IF_ZSTD_ENABLED
+		else
+		{
+			retStream->Zstd_Writer = ZSTD_createCCtx();
+			ready = (retStream->Zstd_Writer != NULL && !ZSTD_isError(ZSTD_CCtx_setParameter(
+				retStream->Zstd_Writer, ZSTD_c_compressionLevel, FILE_IF_COMPRESS_ZSTD_LEVEL)));
+		}
+#endif
+		if (ready == 0)
+		{
+			FileIfCompress_Close(retStream);
+			retStream = NULL;
+		}
+	}
+
+	return retStream;
+}
+
+/**
+ *  \brief To compress bytes to the output file.
+ *
+ *  \param [in] Stream The compression state.
+ *  \param [in] Data The bytes to be compressed.
+ *  \param [in] Length The number of bytes of \p Data.
+ *  \return \ref FileIf_Error_t type data.
+ */
+FileIf_Error_t FileIfCompress_Write(FileIfCompress_Stream_t * Stream, const void * Data, unsigned int Length)
+{
+	return FileIfCompress_Compress(Stream, Data, Length, FILE_IF_COMPRESS_FLUSH_NONE);
+}
+
+/**
+ *  \brief To write all compressed bytes of the written data to the output file.
+ *
+ *  \param [in] Stream The compression state.
+ *  \param [in] Finish Not 0 to end the compressed file.
+ *  \return \ref FileIf_Error_t type data.
+ */
+FileIf_Error_t FileIfCompress_Flush(FileIfCompress_Stream_t * Stream, int Finish)
+{
+	/* Needed variables */
+	FileIf_Error_t retData;
+
+	/* Function Logic */
+	retData = FileIfCompress_Compress(Stream, NULL, 0u,
+		(Finish != 0) ? FILE_IF_COMPRESS_FLUSH_FINISH : FILE_IF_COMPRESS_FLUSH_SYNC);
+	if (FileIfCompress_WriteBlock(Stream) != FILE_IF_ERROR_OK)
+	{
+		retData = FILE_IF_ERROR_CAN_NOT_WRITE;
+	}
+
+	return retData;
+}
+
+/**
+ *  \brief To free a decompression or a compression state.
+ *
+ *  \param [in] Stream The state, NULL is ignored.
+ *  \return None.
+ */
+void FileIfCompress_Close(FileIfCompress_Stream_t * Stream)
+{
+	if (Stream != NULL)
+	{
+		if (Stream->Gzip_Ready != 0)
+		{
+			if (Stream->Writing != 0)
+			{
+				deflateEnd(&Stream->Gzip);
+			}
+			else
+			{
+				inflateEnd(&Stream->Gzip);
+			}
+		}
+#ifdef FILE_IF_ZSTD_ENABLED
+		ZSTD_freeDCtx(Stream->Zstd_Reader);
+		ZSTD_freeCCtx(Stream->Zstd_Writer);
+#endif
+		free(Stream->Buffer);
+		free(Stream);
+	}
+}
+#else
+/**
+ *  \brief To start decompressing an input file.
+ *
+ *  \param [in] Compression The detected \ref FileIf_Compression_t.
+ *  \param [in] Handler The opened input file.
+ *  \param [in] Data The bytes already read from \p Handler.
+ *  \param [in] Length The number of bytes of \p Data.
+ *  \return NULL, no compression is built in.
+ */
+FileIfCompress_Stream_t * FileIfCompress_OpenReader(FileIf_Compression_t Compression, FILE * Handler,
+			const unsigned char * Data, unsigned int Length)
+{
+	(void)Compression;
+	(void)Handler;
+	(void)Data;
+	(void)Length;
+	return NULL;
+}
+
+/**
+ *  \brief To read the next decompressed bytes.
+ *
+ *  \param [in] Stream The decompression state.
+ *  \param [out] Buffer The decompressed bytes.
+ *  \param [in] Size The size of \p Buffer in bytes.
+ *  \param [out] Count The number of decompressed bytes.
+ *  \return #FILE_IF_ERROR_UNSUPPORTED, no compression is built in.
+ */
+FileIf_Error_t FileIfCompress_Read(FileIfCompress_Stream_t * Stream, char * Buffer, unsigned int Size,
+			unsigned int * Count)
+{
+	(void)Stream;
+	(void)Buffer;
+	(void)Size;
+	*Count = 0;
+	return FILE_IF_ERROR_UNSUPPORTED;
+}
+
+/**
+ *  \brief To start compressing an output file.
+ *
+ *  \param [in] Compression The \ref FileIf_Compression_t of the file.
+ *  \param [in] Handler The opened output file.
+ *  \return NULL, no compression is built in.
+ */
+FileIfCompress_Stream_t * FileIfCompress_OpenWriter(FileIf_Compression_t Compression, FILE * Handler)
+{
+	(void)Compression;
+	(void)Handler;
+	return NULL;
+}
+
+/**
+ *  \brief To compress bytes to the output file.
+ *
+ *  \param [in] Stream The compression state.
+ *  \param [in] Data The bytes to be compressed.
+ *  \param [in] Length The number of bytes of \p Data.
+ *  \return #FILE_IF_ERROR_UNSUPPORTED, no compression is built in.
+ */
+FileIf_Error_t FileIfCompress_Write(FileIfCompress_Stream_t * Stream, const void * Data, unsigned int Length)
+{
+	(void)Stream;
+	(void)Data;
+	(void)Length;
+	return FILE_IF_ERROR_UNSUPPORTED;
+}
+
+/**
+ *  \brief To write all compressed bytes of the written data to the output file.
+ *
+ *  \param [in] Stream The compression state.
+ *  \param [in] Finish Not 0 to end the compressed file.
+ *  \return #FILE_IF_ERROR_UNSUPPORTED, no compression is built in.
+ */
+FileIf_Error_t FileIfCompress_Flush(FileIfCompress_Stream_t * Stream, int Finish)
+{
+	(void)Stream;
+	(void)Finish;
+	return FILE_IF_ERROR_UNSUPPORTED;
+}
+
+/**
+ *  \brief To free a decompression or a compression state.
+ *
+ *  \param [in] Stream The state, it's always NULL when no compression is built in.
+ *  \return None.
+ */
+void FileIfCompress_Close(FileIfCompress_Stream_t * Stream)
+{
+	(void)Stream;
+}
+#endif
@@ -0,0 +1,144 @@
+/**
+ *  \file	FileIfCompress.h
+ *  \brief	This file handles the compressed input and output files
+ *  		of the File If module.
+ *  \author Ahmed Wageh.
+ *  \details	The compressed data is decompressed and compressed in
+ *  			blocks while the file is read or written, the whole file
+ *  			is never expanded. Compression is built in only if
+ *  			#FILE_IF_COMPRESS_ENABLED is defined, then gzip is
+ *  			supported by zlib and zstd is supported too if
+ *  			#FILE_IF_ZSTD_ENABLED is defined and libzstd is linked.
+ *  			Otherwise compressed files are detected and rejected.
+ */
+#ifndef FILE_IF_COMPRESS_H_
+#define FILE_IF_COMPRESS_H_
+/* Inclusion */
+#include "FileIf.h"
+
+/* Macros */
+/**	This is the number of bytes needed to detect the compression of a file */
+#define FILE_IF_COMPRESS_MAGIC_SIZE		4u
+/**	This is the size of the compressed data read or written at once */
+#define FILE_IF_COMPRESS_BLOCK_SIZE		(256u * 1024u)
+/**	This is the level of written gzip files, the fastest one */
+#define FILE_IF_COMPRESS_GZIP_LEVEL		1
+/**	This is the level of written zstd files, the fastest one */
+#define FILE_IF_COMPRESS_ZSTD_LEVEL		1
+/**	This is the path suffix of gzip output files */
+#define FILE_IF_COMPRESS_GZIP_SUFFIX	".gz"
+/**	This is the path suffix of zstd output files */
+#define FILE_IF_COMPRESS_ZSTD_SUFFIX	".zst"
+
+/* User-defined data types */
+/**
+ *  This struct is the state of decompressing an input file or
+ *  compressing an output file, it's defined in "FileIfCompress.c".
+ */
+struct FileIfCompress_Stream_t;
+typedef struct FileIfCompress_Stream_t FileIfCompress_Stream_t;
+
+/* Functions proto-type */
+/**
+ *  \brief To detect the compression of a file from its first bytes.
+ *
+ *  \param [in] Data The first bytes of the file.
+ *  \param [in] Length The number of bytes of \p Data.
+ *  \return \ref FileIf_Compression_t type data.
+ */
+FileIf_Compression_t FileIfCompress_Detect(const unsigned char * Data, unsigned int Length);
+
+/**
+ *  \brief To get the compression of an output file from its path suffix.
+ *
+ *  \param [in] Path The path of the file.
+ *  \return #FILE_IF_COMPRESSION_GZIP for #FILE_IF_COMPRESS_GZIP_SUFFIX,
+ *  		#FILE_IF_COMPRESSION_ZSTD for #FILE_IF_COMPRESS_ZSTD_SUFFIX,
+ *  		otherwise #FILE_IF_COMPRESSION_NONE.
+ */
+FileIf_Compression_t FileIfCompress_GetPathCompression(const char * Path);
+
+/**
+ *  \brief To check if a compression is built in.
+ *
+ *  \param [in] Compression The \ref FileIf_Compression_t.
+ *  \return Not 0 if files of \p Compression can be read and written.
+ */
+int FileIfCompress_IsSupported(FileIf_Compression_t Compression);
+
+/**
+ *  \brief To start decompressing an input file.
+ *
+ *  \param [in] Compression The detected \ref FileIf_Compression_t.
+ *  \param [in] Handler The opened input file, it isn't closed by
+ *  			\ref FileIfCompress_Close.
+ *  \param [in] Data The bytes already read from \p Handler, they are
+ *  			decompressed first.
+ *  \param [in] Length The number of bytes of \p Data, at most
+ *  			#FILE_IF_COMPRESS_MAGIC_SIZE.
+ *  \return The decompression state, NULL if it can't be allocated or
+ *  		\p Compression isn't supported.
+ */
+FileIfCompress_Stream_t * FileIfCompress_OpenReader(FileIf_Compression_t Compression, FILE * Handler,
+			const unsigned char * Data, unsigned int Length);
+
+/**
+ *  \brief To read the next decompressed bytes.
+ *
+ *  \param [in] Stream The decompression state.
+ *  \param [out] Buffer The decompressed bytes.
+ *  \param [in] Size The size of \p Buffer in bytes.
+ *  \param [out] Count The number of decompressed bytes, less than
+ *  			\p Size only at the end of the file.
+ *  \return \ref FileIf_Error_t type data, #FILE_IF_ERROR_BAD_FORMAT
+ *  		for corrupted or truncated compressed data.
+ *
+ *  \details Concatenated gzip members and zstd frames are read as one file.
+ */
+FileIf_Error_t FileIfCompress_Read(FileIfCompress_Stream_t * Stream, char * Buffer, unsigned int Size,
+			unsigned int * Count);
+
+/**
+ *  \brief To start compressing an output file.
+ *
+ *  \param [in] Compression The \ref FileIf_Compression_t of the file.
+ *  \param [in] Handler The opened output file, it isn't closed by
+ *  			\ref FileIfCompress_Close.
+ *  \return The compression state, NULL if it can't be allocated or
+ *  		\p Compression isn't supported.
+ */
+FileIfCompress_Stream_t * FileIfCompress_OpenWriter(FileIf_Compression_t Compression, FILE * Handler);
+
+/**
+ *  \brief To compress bytes to the output file.
+ *
+ *  \param [in] Stream The compression state.
+ *  \param [in] Data The bytes to be compressed.
+ *  \param [in] Length The number of bytes of \p Data.
+ *  \return \ref FileIf_Error_t type data.
+ *
+ *  \details The compressed bytes are written when a block of them is full.
+ */
+FileIf_Error_t FileIfCompress_Write(FileIfCompress_Stream_t * Stream, const void * Data, unsigned int Length);
+
+/**
+ *  \brief To write all compressed bytes of the written data to the output file.
+ *
+ *  \param [in] Stream The compression state.
+ *  \param [in] Finish Not 0 to end the compressed file, nothing can be
+ *  			written after it.
+ *  \return \ref FileIf_Error_t type data.
+ *
+ *  \details Without \p Finish the written data can be decompressed from
+ *  		 the output file but the compression gets a bit worse.
+ */
+FileIf_Error_t FileIfCompress_Flush(FileIfCompress_Stream_t * Stream, int Finish);
+
+/**
+ *  \brief To free a decompression or a compression state.
+ *
+ *  \param [in] Stream The state, NULL is ignored.
+ *  \return None.
+ */
+void FileIfCompress_Close(FileIfCompress_Stream_t * Stream);
+#endif // FILE_IF_COMPRESS_H_
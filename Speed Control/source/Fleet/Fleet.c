@@ -0,0 +1,458 @@
+/**
+ *  \file	Fleet.c
+ *  \brief	This file is the implementation of replaying the traces
+ *  		of many devices.
+ *  \author Ahmed Wageh.
+ *  \details	Every worker thread has a queue of devices protected by
+ *  			a mutex. The devices are known before the workers start,
+ *  			so a worker finishes when all queues are empty.
+ */
+/* Inclusion */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+#include "Fleet.h"
+#include "../Device/Device.h"
+#include "../Speed Control/SpeedControl.h"
+
+/* Macros */
+/** The name of the input text file of every device */
+#define FLEET_INPUT_FILE_NAME	"switches.txt"
+/** The name of the output text file of every device */
+#define FLEET_OUTPUT_FILE_NAME	"motor.txt"
+
+/* User-defined data types */
+/**
+ *  This struct is one device to be replayed.
+ */
+struct Fleet_Job_t
+{
+	/** The directory of the device */
+	char * Path;
+	/** The size of the input text file in bytes */
+	long long Size;
+};
+typedef struct Fleet_Job_t Fleet_Job_t;
+
+/**
+ *  This struct is the queue of devices of one worker.
+ */
+struct Fleet_Queue_t
+{
+	/** Protects \p Front and \p Back */
+	pthread_mutex_t Lock;
+	/** The indexes of the queued jobs */
+	unsigned int * Jobs;
+	/** The index of the first queued job in \p Jobs */
+	unsigned int Front;
+	/** The index after the last queued job in \p Jobs */
+	unsigned int Back;
+};
+typedef struct Fleet_Queue_t Fleet_Queue_t;
+
+/* The fleet of devices */
+struct Fleet_t;
+
+/**
+ *  This struct is one worker thread.
+ */
+struct Fleet_Worker_t
+{
+	/** The thread of the worker */
+	pthread_t Thread;
+	/** The fleet of the worker */
+	struct Fleet_t * Fleet;
+	/** The index of the worker in the fleet */
+	unsigned int Index;
+	/** The queue of the worker */
+	Fleet_Queue_t Queue;
+	/** The number of devices that failed */
+	unsigned long Failed;
+	/** The number of replayed input lines */
+	unsigned long long Lines;
+	/** The number of stolen devices */
+	unsigned long Steals;
+	/** The reader block buffer, one extra byte for terminating the last line */
+	char * Read_Buffer;
+	/** The writer buffer */
+	char * Write_Buffer;
+};
+typedef struct Fleet_Worker_t Fleet_Worker_t;
+
+/**
+ *  This struct holds all devices and workers.
+ */
+struct Fleet_t
+{
+	/** The devices */
+	Fleet_Job_t * Jobs;
+	/** The number of devices */
+	unsigned int Jobs_Count;
+	/** The workers */
+	Fleet_Worker_t * Workers;
+	/** The number of workers */
+	unsigned int Workers_Count;
+};
+typedef struct Fleet_t Fleet_t;
+
+/* Private functions prototype */
+/**
+ *  \brief Finds the devices of a directory.
+ *
+ *  \param [in] Fleet The fleet that gets the devices.
+ *  \param [in] Input_Dir The directory of the devices.
+ *  \return \ref Fleet_Error_t type data
+ *
+ *  \details A device is a directory that has #FLEET_INPUT_FILE_NAME.
+ *  		 The devices are sorted by the size of this file, the
+ *  		 biggest first.
+ */
+static Fleet_Error_t Fleet_FindDevices(Fleet_t * Fleet, const char * Input_Dir);
+
+/**
+ *  \brief Takes the next device of a worker.
+ *
+ *  \param [in] Worker The worker.
+ *  \param [out] Job The index of the taken job.
+ *  \return Not 0 if a device is taken, 0 if all queues are empty.
+ */
+static int Fleet_TakeJob(Fleet_Worker_t * Worker, unsigned int * Job);
+
+/**
+ *  \brief Replays one device.
+ *
+ *  \param [in] Worker The worker.
+ *  \param [in] Job The device.
+ *  \return None.
+ */
+static void Fleet_ReplayDevice(Fleet_Worker_t * Worker, const Fleet_Job_t * Job);
+
+/**
+ *  \brief The body of a worker thread.
+ *
+ *  \param [in] Worker The \ref Fleet_Worker_t of the thread.
+ *  \return NULL.
+ */
+static void * Fleet_WorkerMain(void * Worker);
+
+/* Functions definition */
+/* Private functions */
+/**
+ *  \brief Compares two jobs to sort them by size, the biggest first.
+ */
+static int Fleet_CompareJobs(const void * First, const void * Second)
+{
+	const Fleet_Job_t * first = (const Fleet_Job_t *)First;
+	const Fleet_Job_t * second = (const Fleet_Job_t *)Second;
+
+	return (first->Size < second->Size) - (first->Size > second->Size);
+}
+
+/**
+ *  \brief Finds the devices of a directory.
+ *
+ *  \param [in] Fleet The fleet that gets the devices.
+ *  \param [in] Input_Dir The directory of the devices.
+ *  \return \ref Fleet_Error_t type data
+ */
+static Fleet_Error_t Fleet_FindDevices(Fleet_t * Fleet, const char * Input_Dir)
+{
+	/* Needed variables */
+	Fleet_Error_t retError = FLEET_ERROR_OK;
+	char path[FLEET_PATH_MAX_LENGTH];
+	unsigned int capacity = 0;
+	struct dirent * entry;
+	struct stat status;
+	Fleet_Job_t * jobs;
+	DIR * directory;
+	int length;
+
+	/* Function Logic */
+	Fleet->Jobs = NULL;
+	Fleet->Jobs_Count = 0;
+	directory = opendir(Input_Dir);
+	if (directory == NULL)
+	{
+		retError = FLEET_ERROR_CAN_NOT_OPEN_DIR;
+	}
+
+	while (retError == FLEET_ERROR_OK && (entry = readdir(directory)) != NULL)
+	{
+		length = snprintf(path, sizeof(path), "%s/%s/" FLEET_INPUT_FILE_NAME, Input_Dir, entry->d_name);
+		if (entry->d_name[0] != '.' && length > 0 && (unsigned int)length < sizeof(path) &&
+			stat(path, &status) == 0 && S_ISREG(status.st_mode))
+		{
+			if (Fleet->Jobs_Count == capacity)	/* Grow the jobs array */
+			{
+				capacity = (capacity == 0u) ? 64u : capacity * 2u;
+				jobs = realloc(Fleet->Jobs, capacity * sizeof(Fleet_Job_t));
+				retError = (jobs == NULL) ? FLEET_ERROR_NO_RESOURCES : FLEET_ERROR_OK;
+				Fleet->Jobs = (jobs == NULL) ? Fleet->Jobs : jobs;
+			}
+			if (retError == FLEET_ERROR_OK)
+			{
+				/* Keep the directory of the device only */
+				path[length - (int)(sizeof(FLEET_INPUT_FILE_NAME) - 1u) - 1] = 0;
+				Fleet->Jobs[Fleet->Jobs_Count].Path = malloc(strlen(path) + 1u);
+				if (Fleet->Jobs[Fleet->Jobs_Count].Path == NULL)
+				{
+					retError = FLEET_ERROR_NO_RESOURCES;
+				}
+				else
+				{
+					strcpy(Fleet->Jobs[Fleet->Jobs_Count].Path, path);
+					Fleet->Jobs[Fleet->Jobs_Count].Size = (long long)status.st_size;
+					Fleet->Jobs_Count++;
+				}
+			}
+		}
+	}
+
+	if (directory != NULL)
+	{
+		closedir(directory);
+	}
+	if (Fleet->Jobs_Count > 1u)
+	{
+		qsort(Fleet->Jobs, Fleet->Jobs_Count, sizeof(Fleet_Job_t), Fleet_CompareJobs);
+	}
+
+	return retError;
+}
+
+/**
+ *  \brief Takes the next device of a worker.
+ *
+ *  \param [in] Worker The worker.
+ *  \param [out] Job The index of the taken job.
+ *  \return Not 0 if a device is taken, 0 if all queues are empty.
+ *
+ *  \details The worker takes from the front of its own queue and
+ *  		 steals from the back of the other queues, so the owner and
+ *  		 the thief work on different ends.
+ */
+static int Fleet_TakeJob(Fleet_Worker_t * Worker, unsigned int * Job)
+{
+	/* Needed variables */
+	Fleet_t * fleet = Worker->Fleet;
+	Fleet_Queue_t * queue = &Worker->Queue;
+	unsigned int victim;
+	int found = 0;
+
+	/* Function Logic */
+	pthread_mutex_lock(&queue->Lock);
+	if (queue->Front < queue->Back)
+	{
+		*Job = queue->Jobs[queue->Front++];
+		found = 1;
+	}
+	pthread_mutex_unlock(&queue->Lock);
+
+	for (victim = 1; found == 0 && victim < fleet->Workers_Count; victim++)
+	{
+		queue = &fleet->Workers[(Worker->Index + victim) % fleet->Workers_Count].Queue;
+		pthread_mutex_lock(&queue->Lock);
+		if (queue->Front < queue->Back)
+		{
+			*Job = queue->Jobs[--queue->Back];
+			found = 1;
+			Worker->Steals++;
+		}
+		pthread_mutex_unlock(&queue->Lock);
+	}
+
+	return found;
+}
+
+/**
+ *  \brief Replays one device.
+ *
+ *  \param [in] Worker The worker.
+ *  \param [in] Job The device.
+ *  \return None.
+ */
+static void Fleet_ReplayDevice(Fleet_Worker_t * Worker, const Fleet_Job_t * Job)
+{
+	/* Needed variables */
+	char inputPath[FLEET_PATH_MAX_LENGTH];
+	char outputPath[FLEET_PATH_MAX_LENGTH];
+	unsigned long long lines = 0;
+	Device_t device;
+
+	/* Function Logic */
+	snprintf(inputPath, sizeof(inputPath), "%s/" FLEET_INPUT_FILE_NAME, Job->Path);
+	snprintf(outputPath, sizeof(outputPath), "%s/" FLEET_OUTPUT_FILE_NAME, Job->Path);
+	if (Device_Open(&device, inputPath, outputPath, Worker->Read_Buffer, FLEET_READ_BUFFER_SIZE,
+		Worker->Write_Buffer, FILE_IF_OUTPUT_BUFFER_SIZE) != FILE_IF_ERROR_OK)
+	{
+		Worker->Failed++;
+	}
+	else
+	{
+		while (Device_Step(&device) == SWITCH_UPDATE_OK)
+		{
+			lines++;
+		}
+		if (Device_Close(&device) != FILE_IF_ERROR_OK)
+		{
+			Worker->Failed++;
+		}
+		Worker->Lines += lines;
+	}
+}
+
+/**
+ *  \brief The body of a worker thread.
+ *
+ *  \param [in] Worker The \ref Fleet_Worker_t of the thread.
+ *  \return NULL.
+ */
+static void * Fleet_WorkerMain(void * Worker)
+{
+	/* Needed variables */
+	Fleet_Worker_t * worker = (Fleet_Worker_t *)Worker;
+	unsigned int job;
+
+	/* Function Logic */
+	while (Fleet_TakeJob(worker, &job))
+	{
+		Fleet_ReplayDevice(worker, &worker->Fleet->Jobs[job]);
+	}
+
+	return NULL;
+}
+
+/* Public functions */
+/**
+ *  \brief This function gets the number of online CPU cores.
+ *
+ *  \return The number of cores, at least 1.
+ */
+unsigned int Fleet_GetCoreCount(void)
+{
+	/* Needed variables */
+	long cores;
+
+	/* Function Logic */
+#ifdef _WIN32
+	SYSTEM_INFO information;
+
+	GetSystemInfo(&information);
+	cores = (long)information.dwNumberOfProcessors;
+#else
+	cores = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+
+	return (cores < 1) ? 1u : (unsigned int)cores;
+}
+
+/**
+ *  \brief This function replays all devices of a directory.
+ *
+ *  \param [in] Input_Dir The directory that has a directory for every device.
+ *  \param [in] Workers The number of worker threads, 0 for one worker
+ *  			for every core.
+ *  \param [out] Result The \ref Fleet_Result_t of replaying.
+ *  \return \ref Fleet_Error_t type data
+ */
+Fleet_Error_t Fleet_Run(const char * Input_Dir, unsigned int Workers, Fleet_Result_t * Result)
+{
+	/* Needed variables */
+	Fleet_Error_t retError;
+	Fleet_Worker_t * worker;
+	unsigned int prepared = 0;
+	unsigned int started = 1;
+	unsigned int index;
+	Fleet_t fleet;
+
+	/* Function Logic */
+	memset(Result, 0, sizeof(*Result));
+	fleet.Workers = NULL;
+	fleet.Workers_Count = (Workers == 0u) ? Fleet_GetCoreCount() : Workers;
+	retError = Fleet_FindDevices(&fleet, Input_Dir);
+	if (fleet.Workers_Count > fleet.Jobs_Count && fleet.Jobs_Count > 0u)	/* No idle workers */
+	{
+		fleet.Workers_Count = fleet.Jobs_Count;
+	}
+
+	if (retError == FLEET_ERROR_OK)
+	{
+		fleet.Workers = calloc(fleet.Workers_Count, sizeof(Fleet_Worker_t));
+		retError = (fleet.Workers == NULL) ? FLEET_ERROR_NO_RESOURCES : FLEET_ERROR_OK;
+	}
+	for (; retError == FLEET_ERROR_OK && prepared < fleet.Workers_Count; prepared++)
+	{
+		worker = &fleet.Workers[prepared];
+		worker->Fleet = &fleet;
+		worker->Index = prepared;
+		worker->Queue.Jobs = malloc((fleet.Jobs_Count / fleet.Workers_Count + 1u) * sizeof(unsigned int));
+		worker->Read_Buffer = malloc(FLEET_READ_BUFFER_SIZE + 1u);
+		worker->Write_Buffer = malloc(FILE_IF_OUTPUT_BUFFER_SIZE);
+		pthread_mutex_init(&worker->Queue.Lock, NULL);
+		if (worker->Queue.Jobs == NULL || worker->Read_Buffer == NULL || worker->Write_Buffer == NULL)
+		{
+			retError = FLEET_ERROR_NO_RESOURCES;
+		}
+	}
+
+	if (retError == FLEET_ERROR_OK)
+	{
+		/* Deal the devices, the biggest first, one to every worker in turn */
+		for (index = 0; index < fleet.Jobs_Count; index++)
+		{
+			worker = &fleet.Workers[index % fleet.Workers_Count];
+			worker->Queue.Jobs[worker->Queue.Back++] = index;
+		}
+
+		/* The tables of the new speed are generated before the workers use them */
+		SpeedControl_TableInit();
+
+		/* The calling thread is the first worker, if a thread can't be
+		   started the started workers steal its devices */
+		while (started < fleet.Workers_Count && pthread_create(&fleet.Workers[started].Thread, NULL,
+			Fleet_WorkerMain, &fleet.Workers[started]) == 0)
+		{
+			started++;
+		}
+		Fleet_WorkerMain(&fleet.Workers[0]);
+		for (index = 1; index < started; index++)
+		{
+			pthread_join(fleet.Workers[index].Thread, NULL);
+		}
+
+		for (index = 0; index < fleet.Workers_Count; index++)
+		{
+			Result->Failed += fleet.Workers[index].Failed;
+			Result->Lines += fleet.Workers[index].Lines;
+			Result->Steals += fleet.Workers[index].Steals;
+		}
+		Result->Devices = fleet.Jobs_Count;
+		Result->Workers = started;
+		retError = (Result->Failed != 0u) ? FLEET_ERROR_DEVICE : FLEET_ERROR_OK;
+	}
+
+	/* Free all resources */
+	for (index = 0; index < prepared; index++)
+	{
+		pthread_mutex_destroy(&fleet.Workers[index].Queue.Lock);
+		free(fleet.Workers[index].Queue.Jobs);
+		free(fleet.Workers[index].Read_Buffer);
+		free(fleet.Workers[index].Write_Buffer);
+	}
+	free(fleet.Workers);
+	for (index = 0; index < fleet.Jobs_Count; index++)
+	{
+		free(fleet.Jobs[index].Path);
+	}
+	free(fleet.Jobs);
+
+	return retError;
+}
@@ -0,0 +1,82 @@
+/**
+ *  \file	Fleet.h
+ *  \brief	This file handles replaying the traces of many devices.
+ *  \author Ahmed Wageh.
+ *  \details	Every device is a directory that has its input text
+ *  			file "switches.txt". The devices are replayed by worker
+ *  			threads and every one gets its output text file
+ *  			"motor.txt" in its directory.
+ */
+#ifndef FLEET_H_
+#define FLEET_H_
+
+/* Macros */
+/** The maximum length of a device path including the Null terminator */
+#define FLEET_PATH_MAX_LENGTH	4096u
+/** The size of one read block of every worker */
+#define FLEET_READ_BUFFER_SIZE	(64u * 1024u)
+
+/* User-defined data types */
+/**
+ *  This enum for error types that could happens when
+ *  replaying the devices
+ */
+enum Fleet_Error_t
+{
+	/** All devices are replayed */
+	FLEET_ERROR_OK = 0,
+	/** Can't open the input directory */
+	FLEET_ERROR_CAN_NOT_OPEN_DIR = 1,
+	/** Can't allocate memory or start the worker threads */
+	FLEET_ERROR_NO_RESOURCES = 2,
+	/** The files of one device or more couldn't be opened or written */
+	FLEET_ERROR_DEVICE = 3
+};
+typedef enum Fleet_Error_t Fleet_Error_t;
+
+/**
+ *  This struct holds the statistics of replaying the devices.
+ */
+struct Fleet_Result_t
+{
+	/** The number of found devices */
+	unsigned long Devices;
+	/** The number of devices that failed */
+	unsigned long Failed;
+	/** The number of replayed input lines of all devices */
+	unsigned long long Lines;
+	/** The number of devices taken from the queue of another worker */
+	unsigned long Steals;
+	/** The number of used worker threads */
+	unsigned int Workers;
+};
+typedef struct Fleet_Result_t Fleet_Result_t;
+
+/* Functions prototypes */
+/**
+ *  \brief This function gets the number of online CPU cores.
+ *
+ *  \return The number of cores, at least 1.
+ */
+unsigned int Fleet_GetCoreCount(void);
+
+/**
+ *  \brief This function replays all devices of a directory.
+ *
+ *  \param [in] Input_Dir The directory that has a directory for every device.
+ *  \param [in] Workers The number of worker threads, 0 for one worker
+ *  			for every core.
+ *  \param [out] Result The \ref Fleet_Result_t of replaying.
+ *  \return \ref Fleet_Error_t type data
+ *
+ *  \details The devices are queued by the size of their input file,
+ *  		 the biggest first, on the workers one after the other. A
+ *  		 worker takes the biggest device from the front of its own
+ *  		 queue and when it's empty it steals the smallest device from
+ *  		 the back of the queue of another worker, so long and short
+ *  		 traces are balanced between the workers. The tables of
+ *  		 \ref SpeedControl_TableInit are generated before the workers
+ *  		 start, Fleet target calculates the speeds by them.
+ */
+Fleet_Error_t Fleet_Run(const char * Input_Dir, unsigned int Workers, Fleet_Result_t * Result);
+#endif // !FLEET_H_
@@ -0,0 +1,406 @@
+/**
+ *  \file	Generate.c
+ *  \brief	This file is the implementation of generating synthetic
+ *  		input text files.
+ *  \author Ahmed Wageh.
+ *  \details	The workers take the chunks in order under a mutex and
+ *  			a worker writes its chunk when the number of written
+ *  			chunks reaches its index, so at most one chunk is written
+ *  			at a time and the others are generated meanwhile.
+ */
+/* Inclusion */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <pthread.h>
+#include "Generate.h"
+
+/* Macros */
+/** The multiplier of the seeds of the chunks */
+#define GENERATE_GOLDEN_GAMMA	0x9E3779B97F4A7C15ull
+
+/* User-defined data types */
+/**
+ *  This struct holds the state of generating one file.
+ */
+struct Generate_t
+{
+	/** The model of the lines */
+	const Generate_Config_t * Config;
+	/** The opened output file */
+	FILE * Handler;
+	/** The number of lines after the header */
+	unsigned long long Lines;
+	/** The number of lines of every chunk */
+	unsigned int Chunk_Lines;
+	/** The number of chunks */
+	unsigned long long Chunks;
+	/** Protects the members after it */
+	pthread_mutex_t Lock;
+	/** Signaled when a chunk is written */
+	pthread_cond_t Written_Signal;
+	/** The index of the next chunk to be generated */
+	unsigned long long Next_Chunk;
+	/** The number of written chunks */
+	unsigned long long Written_Chunks;
+	/** The number of written bytes */
+	unsigned long long Size;
+	/** Not 0 if a chunk couldn't be written */
+	int Error;
+};
+typedef struct Generate_t Generate_t;
+
+/**
+ *  This struct is one worker thread.
+ */
+struct Generate_Worker_t
+{
+	/** The thread of the worker */
+	pthread_t Thread;
+	/** The generated file */
+	Generate_t * Generate;
+	/** The buffer of one chunk */
+	char * Buffer;
+};
+typedef struct Generate_Worker_t Generate_Worker_t;
+
+/* Private variables */
+/** The tab padded text of every \ref Switches_States_t like "switches.txt" */
+static const char * const Generate_Texts[GENERATE_STATES] =
+{
+	"", PRE_PRESSED_TEXT "\t\t\t", PRESSED_TEXT "\t\t\t\t", RELEASED_TEXT "\t\t\t", PRE_RELEASED_TEXT "\t\t"
+};
+/** The size of every text of \ref Generate_Texts */
+static const unsigned int Generate_Sizes[GENERATE_STATES] =
+{
+	0u, sizeof(PRE_PRESSED_TEXT "\t\t\t") - 1u, sizeof(PRESSED_TEXT "\t\t\t\t") - 1u,
+	sizeof(RELEASED_TEXT "\t\t\t") - 1u, sizeof(PRE_RELEASED_TEXT "\t\t") - 1u
+};
+/** The state after every \ref Switches_States_t of a button */
+static const Switches_States_t Generate_Next[GENERATE_STATES] =
+{
+	SWITCH_RELEASED, SWITCH_PRESSED, SWITCH_PRE_RELEASED, SWITCH_PRE_PRESSED, SWITCH_RELEASED
+};
+
+/* Private functions prototype */
+/**
+ *  \brief Gets the next random number of a splitmix64 sequence.
+ *
+ *  \param [in,out] State The state of the sequence.
+ *  \return The next random number.
+ */
+static unsigned long long Generate_Random(unsigned long long * State);
+
+/**
+ *  \brief Writes an unsigned number as decimal digits.
+ *
+ *  \param [in] Value The number.
+ *  \param [out] Buffer The digits without a Null terminator.
+ *  \return The number of digits.
+ */
+static unsigned int Generate_WriteNumber(unsigned int Value, char * Buffer);
+
+/**
+ *  \brief The body of a worker thread.
+ *
+ *  \param [in] Worker The \ref Generate_Worker_t of the thread.
+ *  \return NULL.
+ */
+static void * Generate_WorkerMain(void * Worker);
+
+/* Functions definition */
+/* Private functions */
+/**
+ *  \brief Gets the next random number of a splitmix64 sequence.
+ *
+ *  \param [in,out] State The state of the sequence.
+ *  \return The next random number.
+ *
+ *  \details Unlike rand it gives the same numbers on every platform.
+ */
+static unsigned long long Generate_Random(unsigned long long * State)
+{
+	/* Needed variables */
+	unsigned long long retRandom;
+
+	/* Function Logic */
+	*State += GENERATE_GOLDEN_GAMMA;
+	retRandom = *State;
+	retRandom = (retRandom ^ (retRandom >> 30)) * 0xBF58476D1CE4E5B9ull;
+	retRandom = (retRandom ^ (retRandom >> 27)) * 0x94D049BB133111EBull;
+
+	return retRandom ^ (retRandom >> 31);
+}
+
+/**
+ *  \brief Writes an unsigned number as decimal digits.
+ *
+ *  \param [in] Value The number.
+ *  \param [out] Buffer The digits without a Null terminator.
+ *  \return The number of digits.
+ */
+static unsigned int Generate_WriteNumber(unsigned int Value, char * Buffer)
+{
+	/* Needed variables */
+	char digits[10];
+	unsigned int retCount = 0;
+	unsigned int index = 0;
+
+	/* Function Logic */
+	do
+	{
+		digits[index++] = (char)('0' + Value % 10u);
+		Value /= 10u;
+	} while (Value != 0u);
+	while (index > 0u)
+	{
+		Buffer[retCount++] = digits[--index];
+	}
+
+	return retCount;
+}
+
+/**
+ *  \brief The body of a worker thread.
+ *
+ *  \param [in] Worker The \ref Generate_Worker_t of the thread.
+ *  \return NULL.
+ *
+ *  \details The chunks are taken in order, so the first chunk that
+ *  		 isn't written is always taken by a worker and the waiting
+ *  		 workers always get their turn.
+ */
+static void * Generate_WorkerMain(void * Worker)
+{
+	/* Needed variables */
+	Generate_Worker_t * worker = (Generate_Worker_t *)Worker;
+	Generate_t * generate = worker->Generate;
+	unsigned long long chunk;
+	unsigned long long first;
+	unsigned int lines;
+	unsigned int size;
+	int error;
+
+	/* Function Logic */
+	pthread_mutex_lock(&generate->Lock);
+	while (generate->Next_Chunk < generate->Chunks)
+	{
+		chunk = generate->Next_Chunk++;
+		pthread_mutex_unlock(&generate->Lock);
+
+		first = chunk * generate->Chunk_Lines;
+		lines = (generate->Lines - first < generate->Chunk_Lines) ?
+			(unsigned int)(generate->Lines - first) : generate->Chunk_Lines;
+		size = Generate_Chunk(generate->Config, chunk, lines, worker->Buffer);
+
+		pthread_mutex_lock(&generate->Lock);
+		while (generate->Written_Chunks != chunk)
+		{
+			pthread_cond_wait(&generate->Written_Signal, &generate->Lock);
+		}
+		pthread_mutex_unlock(&generate->Lock);
+
+		/* Only this worker writes until the chunk is counted */
+		error = (fwrite(worker->Buffer, 1, size, generate->Handler) != size);
+
+		pthread_mutex_lock(&generate->Lock);
+		generate->Error |= error;
+		generate->Size += size;
+		generate->Written_Chunks++;
+		pthread_cond_broadcast(&generate->Written_Signal);
+	}
+	pthread_mutex_unlock(&generate->Lock);
+
+	return NULL;
+}
+
+/* Public functions */
+/**
+ *  \brief This function sets the default model.
+ *
+ *  \param [out] Config The \ref Generate_Config_t to be set.
+ *  \return None.
+ */
+void Generate_DefaultConfig(Generate_Config_t * Config)
+{
+	/* Needed variables */
+	unsigned int id;
+
+	/* Function Logic */
+	for (id = 0; id < GENERATE_SWITCHES; id++)
+	{
+		Config->Leave[id][SWITCH_ERROR] = 0.0;
+		Config->Leave[id][SWITCH_RELEASED] = (id == SWITCH_P) ? 0.001 : 0.02;
+		Config->Leave[id][SWITCH_PRE_PRESSED] = 0.9;
+		Config->Leave[id][SWITCH_PRESSED] = (id == SWITCH_P) ? 0.002 : 0.3;
+		Config->Leave[id][SWITCH_PRE_RELEASED] = 0.9;
+	}
+	Config->Tick_Ms = 100u;
+	Config->Chunk_Lines = GENERATE_DEFAULT_CHUNK_LINES;
+	Config->Seed = 1u;
+}
+
+/**
+ *  \brief This function generates the lines of one chunk.
+ *
+ *  \param [in] Config The \ref Generate_Config_t of the file.
+ *  \param [in] Chunk The index of the chunk in the file.
+ *  \param [in] Lines The number of lines, at most the chunk lines.
+ *  \param [out] Buffer The generated lines, it must hold \p Lines *
+ *  			#GENERATE_MAX_LINE_SIZE bytes.
+ *  \return The size of the generated lines in bytes.
+ *
+ *  \details The probabilities are turned into 32-bit thresholds once,
+ *  		 so every switch of every line takes one compare.
+ */
+unsigned int Generate_Chunk(const Generate_Config_t * Config, unsigned long long Chunk,
+			unsigned int Lines, char * Buffer)
+{
+	/* Needed variables */
+	unsigned long long thresholds[GENERATE_SWITCHES][GENERATE_STATES];
+	Switches_States_t states[GENERATE_SWITCHES] = {SWITCH_RELEASED, SWITCH_RELEASED, SWITCH_RELEASED};
+	unsigned long long random = Config->Seed ^ (Chunk * GENERATE_GOLDEN_GAMMA);
+	unsigned long long duration = 0;
+	unsigned int retSize = 0;
+	unsigned int line;
+	unsigned int id;
+	unsigned int state;
+	double leave;
+
+	/* Function Logic */
+	for (id = 0; id < GENERATE_SWITCHES; id++)
+	{
+		for (state = 0; state < GENERATE_STATES; state++)
+		{
+			leave = Config->Leave[id][state];
+			thresholds[id][state] = (leave <= 0.0) ? 0u :
+				(leave >= 1.0) ? (1ull << 32) : (unsigned long long)(leave * 4294967296.0);
+		}
+	}
+	random = Generate_Random(&random);	/* Chunks with close indexes are far apart */
+
+	for (line = 0; line < Lines; line++)
+	{
+		for (id = 0; id < GENERATE_SWITCHES; id++)
+		{
+			if ((Generate_Random(&random) >> 32) < thresholds[id][states[id]])
+			{
+				states[id] = Generate_Next[states[id]];
+			}
+			memcpy(Buffer + retSize, Generate_Texts[states[id]], Generate_Sizes[states[id]]);
+			retSize += Generate_Sizes[states[id]];
+		}
+
+		/* The press time of the "p" switch grows while it's pressed */
+		if (states[SWITCH_P] != SWITCH_PRESSED)
+		{
+			duration = 0;
+		}
+		retSize += Generate_WriteNumber((unsigned int)duration, Buffer + retSize);
+		Buffer[retSize++] = '\n';
+		if (states[SWITCH_P] == SWITCH_PRESSED && duration <= (unsigned long long)INT_MAX - Config->Tick_Ms)
+		{
+			duration += Config->Tick_Ms;
+		}
+	}
+
+	return retSize;
+}
+
+/**
+ *  \brief This function generates an input text file.
+ *
+ *  \param [in] Path The path of the output file.
+ *  \param [in] Lines The number of lines after the header.
+ *  \param [in] Config The \ref Generate_Config_t of the file.
+ *  \param [in] Workers The number of worker threads, at least 1.
+ *  \param [out] Size The size of the written file in bytes.
+ *  \return \ref Generate_Error_t type data
+ */
+Generate_Error_t Generate_File(const char * Path, unsigned long long Lines, const Generate_Config_t * Config,
+			unsigned int Workers, unsigned long long * Size)
+{
+	/* Needed variables */
+	Generate_Error_t retError = GENERATE_ERROR_OK;
+	Generate_Worker_t * workers = NULL;
+	Generate_t generate;
+	unsigned int prepared = 0;
+	unsigned int started = 1;
+	unsigned int index;
+
+	/* Function Logic */
+	memset(&generate, 0, sizeof(generate));
+	generate.Config = Config;
+	generate.Lines = Lines;
+	generate.Chunk_Lines = (Config->Chunk_Lines == 0u) ? GENERATE_DEFAULT_CHUNK_LINES : Config->Chunk_Lines;
+	generate.Chunks = (Lines + generate.Chunk_Lines - 1u) / generate.Chunk_Lines;
+	if (Workers == 0u)
+	{
+		Workers = 1u;
+	}
+	if (Workers > generate.Chunks && generate.Chunks > 0u)	/* No idle workers */
+	{
+		Workers = (unsigned int)generate.Chunks;
+	}
+	*Size = 0;
+
+	generate.Handler = fopen(Path, "wb");
+	if (generate.Handler == NULL ||
+		fwrite(GENERATE_HEADER, 1, sizeof(GENERATE_HEADER) - 1u, generate.Handler) != sizeof(GENERATE_HEADER) - 1u)
+	{
+		retError = GENERATE_ERROR_CAN_NOT_WRITE;
+	}
+	else
+	{
+		generate.Size = sizeof(GENERATE_HEADER) - 1u;
+		workers = calloc(Workers, sizeof(Generate_Worker_t));
+		retError = (workers == NULL) ? GENERATE_ERROR_NO_RESOURCES : GENERATE_ERROR_OK;
+	}
+	for (; retError == GENERATE_ERROR_OK && prepared < Workers; prepared++)
+	{
+		workers[prepared].Generate = &generate;
+		workers[prepared].Buffer = malloc((size_t)generate.Chunk_Lines * GENERATE_MAX_LINE_SIZE);
+		if (workers[prepared].Buffer == NULL)
+		{
+			retError = GENERATE_ERROR_NO_RESOURCES;
+		}
+	}
+
+	if (retError == GENERATE_ERROR_OK)
+	{
+		pthread_mutex_init(&generate.Lock, NULL);
+		pthread_cond_init(&generate.Written_Signal, NULL);
+
+		/* The calling thread is the first worker, if a thread can't be
+		   started the started workers take its chunks */
+		while (started < Workers && pthread_create(&workers[started].Thread, NULL,
+			Generate_WorkerMain, &workers[started]) == 0)
+		{
+			started++;
+		}
+		Generate_WorkerMain(&workers[0]);
+		for (index = 1; index < started; index++)
+		{
+			pthread_join(workers[index].Thread, NULL);
+		}
+
+		pthread_cond_destroy(&generate.Written_Signal);
+		pthread_mutex_destroy(&generate.Lock);
+		retError = generate.Error ? GENERATE_ERROR_CAN_NOT_WRITE : GENERATE_ERROR_OK;
+		*Size = generate.Size;
+	}
+
+	/* Free all resources */
+	for (index = 0; index < prepared; index++)
+	{
+		free(workers[index].Buffer);
+	}
+	free(workers);
+	if (generate.Handler != NULL && fclose(generate.Handler) != 0 && retError == GENERATE_ERROR_OK)
+	{
+		retError = GENERATE_ERROR_CAN_NOT_WRITE;
+	}
+
+	return retError;
+}
@@ -0,0 +1,109 @@
+/**
+ *  \file	Generate.h
+ *  \brief	This file handles generating synthetic input text files.
+ *  \author Ahmed Wageh.
+ *  \details	Every switch goes through the states of a real button:
+ *  			released, pre_pressed, pressed, pre_released and released
+ *  			again. At every line a switch leaves its state to the next
+ *  			one with the probability of this state, otherwise it stays.
+ *  			The file is generated in chunks of lines and every chunk has
+ *  			its own random numbers from the seed and its index, so the
+ *  			chunks are generated in parallel and the same seed gives the
+ *  			same file for any number of worker threads.
+ */
+#ifndef GENERATE_H_
+#define GENERATE_H_
+/* Inclusion */
+#include "../Switches/Switches.h"
+
+/* Macros */
+/** The number of switches in every line */
+#define GENERATE_SWITCHES			3u
+/** The number of switch states, indexed by \ref Switches_States_t */
+#define GENERATE_STATES				(SWITCH_PRE_RELEASED + 1u)
+/** The maximum size of one generated line */
+#define GENERATE_MAX_LINE_SIZE		64u
+/** The default number of lines of every chunk */
+#define GENERATE_DEFAULT_CHUNK_LINES	65536u
+/** The header of the generated files */
+#define GENERATE_HEADER	"\"+ve\" switch state\t\"-ve\" switch state\t\"p\" switch state\t\"p\" switch press time in ms\n"
+
+/* User-defined data types */
+/**
+ *  This enum for error types that could happens when
+ *  generating a file
+ */
+enum Generate_Error_t
+{
+	/** The file is generated */
+	GENERATE_ERROR_OK = 0,
+	/** Can't open or write the output file */
+	GENERATE_ERROR_CAN_NOT_WRITE = 1,
+	/** Can't allocate memory or start the worker threads */
+	GENERATE_ERROR_NO_RESOURCES = 2
+};
+typedef enum Generate_Error_t Generate_Error_t;
+
+/**
+ *  This struct holds the model of the generated lines.
+ */
+struct Generate_Config_t
+{
+	/** The probability of leaving every \ref Switches_States_t of every
+	 *  \ref Switches_IDs_t at the next line, from 0 to 1 */
+	double Leave[GENERATE_SWITCHES][GENERATE_STATES];
+	/** The time between two lines in ms, the "p" switch press time
+	 *  grows by it while the switch is pressed */
+	unsigned int Tick_Ms;
+	/** The number of lines of every chunk, 0 for #GENERATE_DEFAULT_CHUNK_LINES */
+	unsigned int Chunk_Lines;
+	/** The seed of the random numbers */
+	unsigned long long Seed;
+};
+typedef struct Generate_Config_t Generate_Config_t;
+
+/* Functions prototypes */
+/**
+ *  \brief This function sets the default model.
+ *
+ *  \param [out] Config The \ref Generate_Config_t to be set.
+ *  \return None.
+ *
+ *  \details The "+ve" and "-ve" switches are pressed for a few lines
+ *  		 now and then, the "p" switch is pressed for tens of seconds.
+ *  		 The pre states last about one line.
+ */
+void Generate_DefaultConfig(Generate_Config_t * Config);
+
+/**
+ *  \brief This function generates the lines of one chunk.
+ *
+ *  \param [in] Config The \ref Generate_Config_t of the file.
+ *  \param [in] Chunk The index of the chunk in the file.
+ *  \param [in] Lines The number of lines, at most the chunk lines.
+ *  \param [out] Buffer The generated lines, it must hold \p Lines *
+ *  			#GENERATE_MAX_LINE_SIZE bytes.
+ *  \return The size of the generated lines in bytes.
+ *
+ *  \details Every chunk starts with released switches. The lines are
+ *  		 tab padded like the project "switches.txt".
+ */
+unsigned int Generate_Chunk(const Generate_Config_t * Config, unsigned long long Chunk,
+			unsigned int Lines, char * Buffer);
+
+/**
+ *  \brief This function generates an input text file.
+ *
+ *  \param [in] Path The path of the output file.
+ *  \param [in] Lines The number of lines after the header.
+ *  \param [in] Config The \ref Generate_Config_t of the file.
+ *  \param [in] Workers The number of worker threads, at least 1.
+ *  \param [out] Size The size of the written file in bytes.
+ *  \return \ref Generate_Error_t type data
+ *
+ *  \details Every worker takes the next chunk, generates it in its own
+ *  		 buffer and writes it when the chunks before it are written.
+ */
+Generate_Error_t Generate_File(const char * Path, unsigned long long Lines, const Generate_Config_t * Config,
+			unsigned int Workers, unsigned long long * Size);
+#endif // !GENERATE_H_
@@ -9,8 +9,9 @@
 #include "../File If/FileIf.h"
 
 /* Private Data */
-/** Current motor speed */
-static int motor_speed = MOTOR_MEDIUM_SPEED;
+/** The motor of the default device, it writes to the output
+ *  file prepared by \ref Motor_Init */
+static Motor_Context_t Motor_Default_Context = {MOTOR_MEDIUM_SPEED, NULL};
 
 /* Private Functions */
 /**
@@ -26,6 +27,15 @@ static int motor_speed = MOTOR_MEDIUM_SPEED;
  */
 void Motor_SetSpeed(int speed);
 
+/**
+ *  \brief Limits \p speed to the motor speed limitations
+ *
+ *  \param [in] speed The target speed of the motor.
+ *  \return \p speed limited to be between \ref MOTOR_MINIMUM_SPEED
+ *  		and \ref MOTOR_MAXIMUM_SPEED.
+ */
+static int Motor_LimitSpeed(int speed);
+
 /* Functions definition */
 /* Private functions */
 /**
@@ -41,20 +51,33 @@ void Motor_SetSpeed(int speed);
  */
 void Motor_SetSpeed(int speed)
 {
+	Motor_Default_Context.Speed = Motor_LimitSpeed(speed);
+}
+
+/**
+ *  \brief Limits \p speed to the motor speed limitations
+ *
+ *  \param [in] speed The target speed of the motor.
+ *  \return \p speed limited to be between \ref MOTOR_MINIMUM_SPEED
+ *  		and \ref MOTOR_MAXIMUM_SPEED.
+ */
+static int Motor_LimitSpeed(int speed)
+{
+	/* Needed variables */
+	int retSpeed = speed;
+
 	/* Function logic */
 	/* Speed limitations */
 	if (speed >= MOTOR_MAXIMUM_SPEED)
 	{
-		motor_speed = MOTOR_MAXIMUM_SPEED;
+		retSpeed = MOTOR_MAXIMUM_SPEED;
 	}
 	else if (speed <= MOTOR_MINIMUM_SPEED)
 	{
-		motor_speed = MOTOR_MINIMUM_SPEED;
-	}
-	else
-	{
-		motor_speed = speed;
+		retSpeed = MOTOR_MINIMUM_SPEED;
 	}
+
+	return retSpeed;
 }
 
 /* Public functions */
@@ -85,20 +108,97 @@ void Motor_Init(void)
  *  		 to \ref MOTOR_MAXIMUM_SPEED.
  */
 void Motor_UpdateSpeed(int new_speed)
+{
+	Motor_ContextUpdateSpeed(&Motor_Default_Context, new_speed);
+}
+
+/**
+ *  \brief Gets the current speed of the motor
+ *
+ *  \return The current speed of the motor
+ */
+int Motor_GetSpeed(void)
+{
+	return Motor_Default_Context.Speed;
+}
+
+/**
+ *  \brief This function initializes the motor of one device.
+ *
+ *  \param [out] Context The \ref Motor_Context_t of the device.
+ *  \param [in] Writer The opened writer of the device output text file.
+ *  \return None.
+ */
+void Motor_ContextInit(Motor_Context_t * Context, struct FileIf_Writer_t * Writer)
+{
+	Context->Speed = MOTOR_MEDIUM_SPEED;
+	Context->Writer = Writer;
+}
+
+/**
+ *  \brief Update the speed of the motor of one device to be \p new_speed
+ *
+ *  \param [in] Context The \ref Motor_Context_t of the device.
+ *  \param [in] new_speed The new target speed
+ *  \return None
+ *
+ *  \details The speed is written to \p Context writer or to the output
+ *  		 file prepared by \ref Motor_Init if it has no writer.
+ */
+void Motor_ContextUpdateSpeed(Motor_Context_t * Context, int new_speed)
 {
 	/* Function logic */
 	/* Set new speed */
-	Motor_SetSpeed(new_speed);
+	Context->Speed = Motor_LimitSpeed(new_speed);
 	/* Updating speed */
-	File_WriteLine(Motor_GetSpeed());
+	if (Context->Writer == NULL)
+	{
+		File_WriteLine(Context->Speed);
+	}
+	else
+	{
+		File_WriterWriteLine(Context->Writer, Context->Speed);
+	}
 }
 
 /**
- *  \brief Gets the current speed of the motor
+ *  \brief Sets the speed of the motor of one device to be \p new_speed
+ *
+ *  \param [in] Context The \ref Motor_Context_t of the device.
+ *  \param [in] new_speed The new target speed
+ *  \return None
+ */
+void Motor_ContextSetSpeed(Motor_Context_t * Context, int new_speed)
+{
+	Context->Speed = Motor_LimitSpeed(new_speed);
+}
+
+/**
+ *  \brief Keeps the speed of the motor of one device for more updates
  *
+ *  \param [in] Context The \ref Motor_Context_t of the device.
+ *  \param [in] Count The number of updates.
+ *  \return None
+ */
+void Motor_ContextRepeatSpeed(Motor_Context_t * Context, unsigned int Count)
+{
+	if (Context->Writer == NULL)
+	{
+		File_WriteRepeat(Context->Speed, Count);
+	}
+	else
+	{
+		File_WriterWriteRepeat(Context->Writer, Context->Speed, Count);
+	}
+}
+
+/**
+ *  \brief Gets the current speed of the motor of one device
+ *
+ *  \param [in] Context The \ref Motor_Context_t of the device.
  *  \return The current speed of the motor
  */
-int Motor_GetSpeed(void)
+int Motor_ContextGetSpeed(const Motor_Context_t * Context)
 {
-	return motor_speed;
+	return Context->Speed;
 }
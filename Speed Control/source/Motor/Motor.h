@@ -21,6 +21,23 @@
  *  @}
  */
 
+/* User-defined data types */
+/* The writer object of File Interface module */
+struct FileIf_Writer_t;
+
+/**
+ *  This struct holds the motor of one device.
+ */
+struct Motor_Context_t
+{
+	/** The current motor speed */
+	int Speed;
+	/** The writer of the output text file, NULL for the output file
+	 *  prepared by \ref Motor_Init */
+	struct FileIf_Writer_t * Writer;
+};
+typedef struct Motor_Context_t Motor_Context_t;
+
 /* Functions prototypes */
 /**
  *  \brief This function for initializing the motor
@@ -53,4 +70,60 @@ void Motor_UpdateSpeed(int new_speed);
  *  \return The current speed of the motor
  */
 int Motor_GetSpeed(void);
+
+/**
+ *  \brief This function initializes the motor of one device.
+ *
+ *  \param [out] Context The \ref Motor_Context_t of the device.
+ *  \param [in] Writer The opened writer of the device output text file.
+ *  \return None.
+ *
+ *  \details The initial speed is \ref MOTOR_MEDIUM_SPEED.
+ */
+void Motor_ContextInit(Motor_Context_t * Context, struct FileIf_Writer_t * Writer);
+
+/**
+ *  \brief Update the speed of the motor of one device to be \p new_speed
+ *
+ *  \param [in] Context The \ref Motor_Context_t of the device.
+ *  \param [in] new_speed The new target speed
+ *  \return None
+ *
+ *  \details It's the same as \ref Motor_UpdateSpeed for the motor of
+ *  		 \p Context.
+ */
+void Motor_ContextUpdateSpeed(Motor_Context_t * Context, int new_speed);
+
+/**
+ *  \brief Sets the speed of the motor of one device to be \p new_speed
+ *
+ *  \param [in] Context The \ref Motor_Context_t of the device.
+ *  \param [in] new_speed The new target speed
+ *  \return None
+ *
+ *  \details It's the same as \ref Motor_ContextUpdateSpeed but the speed
+ *  		 isn't written to the output text file.
+ */
+void Motor_ContextSetSpeed(Motor_Context_t * Context, int new_speed);
+
+/**
+ *  \brief Keeps the speed of the motor of one device for more updates
+ *
+ *  \param [in] Context The \ref Motor_Context_t of the device.
+ *  \param [in] Count The number of updates.
+ *  \return None
+ *
+ *  \details It's the same as calling \ref Motor_ContextUpdateSpeed with
+ *  		 the current speed \p Count times, but the output text file
+ *  		 gets all lines at once.
+ */
+void Motor_ContextRepeatSpeed(Motor_Context_t * Context, unsigned int Count);
+
+/**
+ *  \brief Gets the current speed of the motor of one device
+ *
+ *  \param [in] Context The \ref Motor_Context_t of the device.
+ *  \return The current speed of the motor
+ */
+int Motor_ContextGetSpeed(const Motor_Context_t * Context);
 #endif // !MOTOR_H_
@@ -8,175 +8,256 @@
  *  			pressing for "P" switch. It gets all this as a text.
  */
 /* Inclusion */
+#include <limits.h>
 #include <string.h>
 #include "Parse.h"
+#include "ParseScan.h"
+#include "../Profile/Profile.h"
 
-/* Private functions proto-type */
-/**
- *  \brief To prepare the line to be parsed for switch state.
- *  
- *  \param [in] text the text line
- *  \return integer which indecates the number of unhelpful
- *  		characters at the start of the text line
- *  
- *  \details This function gets the number of unhelpful characters
- *  		 at the start of the text line to be skipped when 
- *  		 parsing to get the switch state text.
- */
-static int Parse_PrepareForSWState(char * text);
+/* Macros */
+/** The number of characters of a switch state text in \ref Switches_text */
+#define PARSE_TEXT_LENGTH(text)	(sizeof(text) - 1u)
 
-/**
- *  \brief To prepare the line to be parsed for switch duration.
- *  
- *  \param [in] text the text line
- *  \return integer which indecates the number of unhelpful
- *  		characters at the start of the text line
- *  
- *  \details This function gets the number of unhelpful characters
- *  		 at the start of the text line to be skipped when 
- *  		 parsing to get the pressing duration as a text.
- */
-static int Parse_PrepareForDuration(char * text);
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+/** The duration digits are decoded 8 at once in a 64-bit word */
+#define PARSE_SWAR_DIGITS
+#endif
 
+/* Private functions proto-type */
 /**
  *  \brief To get a pure text from a specific line of text
  *  
  *  \param [out] ret_text the pure text extracted from the text line
  *  \param [in] text the whole text line
- *  \return None
+ *  \param [in] length the number of characters in \p text
+ *  \return the number of characters of the pure text
  *  
  *  \details This function removes all unused characters from end of
  *  		 the text line to get the pure text input that can be parsed 
  *  		 to get the switch state or duration.
  */
-static void Parse_GetText(char * ret_text, char * text);
+static unsigned int Parse_GetText(char * ret_text, const char * text, unsigned int length);
 
 /**
- *  \brief To get the \ref Switches_States_t from the input \p text line
+ *  \brief To get the \ref Switches_States_t from the input \p text
  *  
- *  \param [in] text the text line
- *  \return None
+ *  \param [in] text the pure text
+ *  \param [in] length the number of characters in \p text
+ *  \return \ref Switches_States_t type data.
  *  
  *  \details This function check the \p text to be equal to one of
  *  		 switch states as in \ref Switches_text and then returns
  *  		 the \ref Switches_States_t accoring to the equality check
  *  		 and returns #SWITCH_ERROR if it doesn't match any text.
+ *  		 The candidate text is selected by \p length in constant time
+ *  		 and only this text is compared.
+ */
+static Switches_States_t Parse_CheckText(const char * text, unsigned int length);
+
+/**
+ *  \brief To get the pressing duration from the input \p text
+ *  
+ *  \param [in] text the text starting with the duration
+ *  \param [in] length the number of characters in \p text
+ *  \param [out] duration the pressing duration, 0 if there are no digits
+ *  \return \ref Parse_Error_t type data.
+ *  
+ *  \details The duration is an optional "-" followed by decimal digits
+ *  		 and it returns #PARSE_ERROR_P_DURATION if there are no digits.
+ *  		 A value out of int range returns #PARSE_ERROR_P_DURATION_OVERFLOW
+ *  		 and \p duration is INT_MAX or INT_MIN. 8 digits are decoded
+ *  		 at once when #PARSE_SWAR_DIGITS is defined.
  */
-static Switches_States_t Parse_CheckText(char * text);
+static Parse_Error_t Parse_GetDuration(const char * text, unsigned int length, int * duration);
 
 /* Functions definition */
 /* Private functions definition */
 /**
- *  \brief To prepare the line to be parsed for switch state.
+ *  \brief To get a pure text from a specific line of text
  *  
- *  \param [in] text the text line
- *  \return integer which indecates the number of unhelpful
- *  		characters at the start of the text line
+ *  \param [out] ret_text the pure text extracted from the text line
+ *  \param [in] text the whole text line
+ *  \param [in] length the number of characters in \p text
+ *  \return the number of characters of the pure text
  *  
- *  \details This function gets the number of unhelpful characters
- *  		 at the start of the text line to be skipped when 
- *  		 parsing to get the switch state text.
+ *  \details This function removes all unused characters from the 
+ *  		 text line to get the pure text input that can be parsed 
+ *  		 to get the switch state or duration.
  */
-static int Parse_PrepareForSWState(char * text)
+static unsigned int Parse_GetText(char * ret_text, const char * text, unsigned int length)
 {
 	/* Needed Variables */
-	int offset = 0;
+	unsigned int index = ParseScan_TextLength(text, length);
 
-	/* Function logic */
-	while (text[offset] != 'p' && text[offset] != 'r')
-	{
-		offset++;
-	}
+	/* Function Logic */
+	memcpy(ret_text, text, index);
+	ret_text[index] = 0;
 
-	return offset;
+	return index;
 }
 
 /**
- *  \brief To prepare the line to be parsed for switch duration.
+ *  \brief To get the \ref Switches_States_t from the input \p text
  *  
- *  \param [in] text the text line
- *  \return integer which indecates the number of unhelpful
- *  		characters at the start of the text line
+ *  \param [in] text the pure text
+ *  \param [in] length the number of characters in \p text
+ *  \return \ref Switches_States_t type data.
  *  
- *  \details This function gets the number of unhelpful characters
- *  		 at the start of the text line to be skipped when 
- *  		 parsing to get the pressing duration as a text.
+ *  \details This function check the \p text to be equal to one of
+ *  		 switch states as in \ref Switches_text and then returns
+ *  		 the \ref Switches_States_t accoring to the equality check
+ *  		 and returns #SWITCH_ERROR if it doesn't match any text.
  */
-static int Parse_PrepareForDuration(char * text)
+static Switches_States_t Parse_CheckText(const char * text, unsigned int length)
 {
 	/* Needed Variables */
-	int offset = 0;
+	Switches_States_t retState = SWITCH_ERROR;
+	Switches_States_t candidate = SWITCH_ERROR;
+	const char * expected = NULL;
+
+	/* Function Logic */
+	/* The texts of Switches_text have different lengths, a duplicated
+	   length is a duplicated case label and fails the compilation */
+	switch (length)
+	{
+		case PARSE_TEXT_LENGTH(PRE_PRESSED_TEXT):
+			candidate = SWITCH_PRE_PRESSED;
+			expected = PRE_PRESSED_TEXT;
+		break;
+
+		case PARSE_TEXT_LENGTH(PRESSED_TEXT):
+			candidate = SWITCH_PRESSED;
+			expected = PRESSED_TEXT;
+		break;
+
+		case PARSE_TEXT_LENGTH(RELEASED_TEXT):
+			candidate = SWITCH_RELEASED;
+			expected = RELEASED_TEXT;
+		break;
+
+		case PARSE_TEXT_LENGTH(PRE_RELEASED_TEXT):
+			candidate = SWITCH_PRE_RELEASED;
+			expected = PRE_RELEASED_TEXT;
+		break;
+
+		default:;
+			/* Not a switch state */
+	}
 
-	/* Function logic */
-	while ((text[offset] < '0' || text[offset] > '9') && text[offset] != '-')
+	/* Check the first and last characters before confirming with one compare */
+	if (expected != NULL && text[0] == expected[0] && text[length - 1u] == expected[length - 1u] &&
+		memcmp(text, expected, length) == 0)
 	{
-		offset++;
+		retState = candidate;
 	}
 
-	return offset;
+	return retState;
 }
 
+#ifdef PARSE_SWAR_DIGITS
 /**
- *  \brief To get a pure text from a specific line of text
- *  
- *  \param [out] ret_text the pure text extracted from the text line
- *  \param [in] the whole text line
- *  \return None
+ *  \brief To decode up to 8 leading digits of \p text at once.
  *  
- *  \details This function removes all unused characters from the 
- *  		 text line to get the pure text input that can be parsed 
- *  		 to get the switch state or duration.
+ *  \param [in] text the text starting with the digits, it must have
+ *  		8 readable characters
+ *  \param [out] value the value of the leading digits
+ *  \return the number of leading digits, from 0 to 8
  */
-static void Parse_GetText(char * ret_text, char * text)
+static unsigned int Parse_GetEightDigits(const char * text, unsigned long long * value)
 {
 	/* Needed Variables */
-	int index = 0;
-	
+	unsigned long long word;
+	unsigned long long nonDigits;
+	unsigned int digits = 8u;
+
 	/* Function Logic */
-	while ((text[index] >= 'a' && text[index] <= 'z') || text[index] == '_' || 
-		(text[index] >= '0' && text[index] <= '9'))
+	memcpy(&word, text, sizeof(word));
+	/* Digits become 0 to 9, any other character keeps a bit in the high nibble */
+	word ^= 0x3030303030303030ull;
+	nonDigits = (word | ((word & 0x0F0F0F0F0F0F0F0Full) + 0x0606060606060606ull)) & 0xF0F0F0F0F0F0F0F0ull;
+	if (nonDigits != 0u)
 	{
-		ret_text[index] = text[index];
-		index++;
+		digits = (unsigned int)__builtin_ctzll(nonDigits) / 8u;
 	}
-	ret_text[index] = 0;
+
+	/* Move the digits to the high bytes so the rest are leading zeros */
+	word = (digits == 0u) ? 0u : (word << (8u * (8u - digits)));
+	word = (word * 10u + (word >> 8)) & 0x00FF00FF00FF00FFull;
+	word = (word * 100u + (word >> 16)) & 0x0000FFFF0000FFFFull;
+	word = (word * 10000u + (word >> 32)) & 0x00000000FFFFFFFFull;
+	*value = word;
+
+	return digits;
 }
+#endif
 
 /**
- *  \brief To get the \ref Switches_States_t from the input \p text line
- *  
- *  \param [in] text the text line
- *  \return None
+ *  \brief To get the pressing duration from the input \p text
  *  
- *  \details This function check the \p text to be equal to one of
- *  		 switch states as in \ref Switches_text and then returns
- *  		 the \ref Switches_States_t accoring to the equality check
- *  		 and returns #SWITCH_ERROR if it doesn't match any text.
+ *  \param [in] text the text starting with the duration
+ *  \param [in] length the number of characters in \p text
+ *  \param [out] duration the pressing duration, 0 if there are no digits
+ *  \return \ref Parse_Error_t type data.
  */
-static Switches_States_t Parse_CheckText(char * text)
+static Parse_Error_t Parse_GetDuration(const char * text, unsigned int length, int * duration)
 {
 	/* Needed Variables */
-	Switches_States_t retState = SWITCH_ERROR;
+	Parse_Error_t retError = PARSE_ERROR_OK;
+	unsigned long long value = 0;
+	unsigned long long limit = INT_MAX;
+	unsigned int index = 0;
+	unsigned int start;
+	int negative = 0;
+#ifdef PARSE_SWAR_DIGITS
+	static const unsigned long long powerOfTen[9] =
+	{
+		1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull, 100000000ull
+	};
+	unsigned long long chunk;
+	unsigned int digits = 8u;
+#endif
 
 	/* Function Logic */
-	if (strcmp(text, PRE_PRESSED_TEXT) == 0)
+	if (index < length && text[index] == '-')
 	{
-		retState = SWITCH_PRE_PRESSED;
+		negative = 1;
+		limit = (unsigned long long)INT_MAX + 1u;
+		index++;
 	}
-	else if (strcmp(text, PRESSED_TEXT) == 0)
+	start = index;
+
+	/* Values are kept at most (limit + 1) to detect the overflow */
+#ifdef PARSE_SWAR_DIGITS
+	while (digits == 8u && index + 8u <= length)
 	{
-		retState = SWITCH_PRESSED;
+		digits = Parse_GetEightDigits(text + index, &chunk);
+		value = value * powerOfTen[digits] + chunk;
+		value = (value > limit) ? limit + 1u : value;
+		index += digits;
 	}
-	else if (strcmp(text, RELEASED_TEXT) == 0)
+	if (digits == 8u)
+#endif
 	{
-		retState = SWITCH_RELEASED;
+		while (index < length && text[index] >= '0' && text[index] <= '9')
+		{
+			value = value * 10u + (unsigned int)(text[index] - '0');
+			value = (value > limit) ? limit + 1u : value;
+			index++;
+		}
 	}
-	else if (strcmp(text, PRE_RELEASED_TEXT) == 0)
+
+	if (index == start)	/* No digits */
 	{
-		retState = SWITCH_PRE_RELEASED;
+		retError = PARSE_ERROR_P_DURATION;
 	}
+	else if (value > limit)
+	{
+		retError = PARSE_ERROR_P_DURATION_OVERFLOW;
+		value = limit;
+	}
+	*duration = negative ? (int)(-(long long)value) : (int)value;
 
-	return retState;
+	return retError;
 }
 
 /* Public functions */
@@ -198,24 +279,111 @@ static Switches_States_t Parse_CheckText(char * text)
  *  		 \ref ParsePSwitch, or \ref ParsePDuaration to get the real state
  *  		 in \ref Switches_States_t type or duration in  integer form.
  */
-void ParseLine(char * Line, char * inc_txt, char * dec_txt, char * p_txt, char * p_time)
+void ParseLine(const char * Line, char * inc_txt, char * dec_txt, char * p_txt, char * p_time)
 {
+	/* Needed Variables */
+	unsigned int length = (unsigned int)strlen(Line);
+	unsigned int offset = 0;
+
 	/* Function Logic */
 	/* Remove all spaces "\t, while blanks, etc." */
-	Line += Parse_PrepareForSWState(Line);
-	Parse_GetText(inc_txt, Line);
-	
+	offset += ParseScan_SkipToState(Line + offset, length - offset);
+	offset += Parse_GetText(inc_txt, Line + offset, length - offset);
+
 	/* Remove all spaces "\t, while blanks, etc." */
-	Line += Parse_PrepareForSWState(Line + strlen(inc_txt)) + strlen(inc_txt);
-	Parse_GetText(dec_txt, Line);
-	
+	offset += ParseScan_SkipToState(Line + offset, length - offset);
+	offset += Parse_GetText(dec_txt, Line + offset, length - offset);
+
 	/* Remove all spaces "\t, while blanks, etc." */
-	Line += Parse_PrepareForSWState(Line + strlen(dec_txt)) + strlen(dec_txt);
-	Parse_GetText(p_txt, Line);
-	
+	offset += ParseScan_SkipToState(Line + offset, length - offset);
+	offset += Parse_GetText(p_txt, Line + offset, length - offset);
+
 	/* Remove all spaces "\t, while blanks, etc." */
-	Line += Parse_PrepareForDuration(Line + strlen(p_txt)) + strlen(p_txt);
-	Parse_GetText(p_time, Line);
+	offset += ParseScan_SkipToDuration(Line + offset, length - offset);
+	Parse_GetText(p_time, Line + offset, length - offset);
+}
+
+/**
+ *  \brief This function decodes all fields of a text line in one pass.
+ *  
+ *  \param [in] Line The line needed to be parsed
+ *  \param [in] Length The number of characters in \p Line
+ *  \param [out] Record The decoded \ref Parse_Record_t
+ *  \return \ref Parse_Error_t type data
+ *  
+ *  \details The line is scanned once from left to right and the
+ *  		 scanning never goes beyond \p Length characters. All fields
+ *  		 of \p Record are always assigned, a column that can't be
+ *  		 decoded is #SWITCH_ERROR or 0 duration and the error code
+ *  		 tells the first column that failed.
+ */
+Parse_Error_t ParseRecord(const char * Line, unsigned int Length, Parse_Record_t * Record)
+{
+	/* Needed Variables */
+	static const Parse_Error_t columnError[3] =
+	{
+		PARSE_ERROR_INC_SWITCH, PARSE_ERROR_DEC_SWITCH, PARSE_ERROR_P_SWITCH
+	};
+	Switches_States_t * column[3];
+	Parse_Error_t retError = PARSE_ERROR_OK;
+	Parse_Error_t durationError;
+	unsigned int offset = 0;
+	unsigned int textLength;
+	unsigned int index;
+
+	/* Function Logic */
+	PROFILE_BEGIN(PROFILE_STAGE_PARSE);
+	column[0] = &Record->Inc_Switch;
+	column[1] = &Record->Dec_Switch;
+	column[2] = &Record->P_Switch;
+	for (index = 0; index < 3u; index++)
+	{
+		/* Remove all spaces "\t, while blanks, etc." */
+		offset += ParseScan_SkipToState(Line + offset, Length - offset);
+		textLength = ParseScan_TextLength(Line + offset, Length - offset);
+		*column[index] = Parse_CheckText(Line + offset, textLength);
+		offset += textLength;
+		if (*column[index] == SWITCH_ERROR && retError == PARSE_ERROR_OK)
+		{
+			retError = columnError[index];
+		}
+	}
+
+	/* Remove all spaces "\t, while blanks, etc." */
+	offset += ParseScan_SkipToDuration(Line + offset, Length - offset);
+	durationError = Parse_GetDuration(Line + offset, Length - offset, &Record->P_Duration);
+	if (retError == PARSE_ERROR_OK)
+	{
+		retError = durationError;
+	}
+	PROFILE_END(PROFILE_STAGE_PARSE);
+
+	return retError;
+}
+
+/**
+ *  \brief To get the pressing duration of "P" switch from a text.
+ *  
+ *  \param [in] Text the text starting with the duration
+ *  \param [in] Length the number of characters in \p Text
+ *  \param [out] Duration the pressing duration
+ *  \return \ref Parse_Error_t type data.
+ */
+Parse_Error_t ParseDuration(const char * Text, unsigned int Length, int * Duration)
+{
+	return Parse_GetDuration(Text, Length, Duration);
+}
+
+/**
+ *  \brief To get the \ref Switches_States_t of a switch state text.
+ *  
+ *  \param [in] Text the switch state text
+ *  \param [in] Length the number of characters in \p Text
+ *  \return \ref Switches_States_t type data.
+ */
+Switches_States_t ParseSwitchState(const char * Text, unsigned int Length)
+{
+	return Parse_CheckText(Text, Length);
 }
 
 /**
@@ -225,19 +393,15 @@ void ParseLine(char * Line, char * inc_txt, char * dec_txt, char * p_txt, char *
  *  \param [in] Line "+ve" switch state as text
  *  \return \ref Switches_States_t type data.
  */
-Switches_States_t ParseIncSwitch(char * Line)
+Switches_States_t ParseIncSwitch(const char * Line)
 {
 	/* Needed Variables */
-	char temp_text[13];
-	Switches_States_t retState = SWITCH_ERROR;
+	Parse_Record_t record;
 
 	/* Function Logic */
-	/* Remove all spaces "\t, while blanks, etc." */
-	Line += Parse_PrepareForSWState(Line);
-	Parse_GetText(temp_text, Line);
-	retState = Parse_CheckText(temp_text);
+	ParseRecord(Line, (unsigned int)strlen(Line), &record);
 
-	return retState;
+	return record.Inc_Switch;
 }
 
 /**
@@ -247,23 +411,15 @@ Switches_States_t ParseIncSwitch(char * Line)
  *  \param [in] Line "-ve" switch state as text
  *  \return \ref Switches_States_t type data.
  */
-Switches_States_t ParseDecSwitch(char * Line)
+Switches_States_t ParseDecSwitch(const char * Line)
 {
 	/* Needed Variables */
-	char temp_text[13];
-	Switches_States_t retState = SWITCH_ERROR;
-
-	/* Function logic */
-	/* Remove all spaces "\t, while blanks, etc." */
-	Line += Parse_PrepareForSWState(Line);
-	Parse_GetText(temp_text, Line);
+	Parse_Record_t record;
 
-	/* Remove all spaces "\t, while blanks, etc." */
-	Line += Parse_PrepareForSWState(Line + strlen(temp_text)) + strlen(temp_text);
-	Parse_GetText(temp_text, Line);
-	retState = Parse_CheckText(temp_text);
+	/* Function Logic */
+	ParseRecord(Line, (unsigned int)strlen(Line), &record);
 
-	return retState;
+	return record.Dec_Switch;
 }
 
 /**
@@ -273,28 +429,15 @@ Switches_States_t ParseDecSwitch(char * Line)
  *  \param [in] Line "P" switch state as text
  *  \return \ref Switches_States_t type data.
  */
-Switches_States_t ParsePSwitch(char * Line)
+Switches_States_t ParsePSwitch(const char * Line)
 {
 	/* Needed Variables */
-	char temp_text[13];
-	Switches_States_t retState = SWITCH_ERROR;
+	Parse_Record_t record;
 
 	/* Function Logic */
-	/* Remove all spaces "\t, while blanks, etc." */
-	Line += Parse_PrepareForSWState(Line);
-	Parse_GetText(temp_text, Line);
+	ParseRecord(Line, (unsigned int)strlen(Line), &record);
 
-	/* Remove all spaces "\t, while blanks, etc." */
-	Line += Parse_PrepareForSWState(Line + strlen(temp_text)) + strlen(temp_text);
-	Parse_GetText(temp_text, Line);
-
-	/* Remove all spaces "\t, while blanks, etc." */
-	Line += Parse_PrepareForSWState(Line + strlen(temp_text)) + strlen(temp_text);
-	Parse_GetText(temp_text, Line);
-
-	retState = Parse_CheckText(temp_text);
-
-	return retState;
+	return record.P_Switch;
 }
 
 /**
@@ -304,29 +447,13 @@ Switches_States_t ParsePSwitch(char * Line)
  *  \param [in] Line duration of "P" switch as text
  *  \return The duration of pressing.
  */
-int ParsePDuaration(char * Line)
+int ParsePDuaration(const char * Line)
 {
 	/* Needed Variables */
-	char temp_text[13];
-	int retduration = 0;
+	Parse_Record_t record;
 
 	/* Function Logic */
-	/* Remove all spaces "\t, while blanks, etc." */
-	Line += Parse_PrepareForSWState(Line);
-	Parse_GetText(temp_text, Line);
+	ParseRecord(Line, (unsigned int)strlen(Line), &record);
 
-	/* Remove all spaces "\t, while blanks, etc." */
-	Line += Parse_PrepareForSWState(Line + strlen(temp_text)) + strlen(temp_text);
-	Parse_GetText(temp_text, Line);
-
-	/* Remove all spaces "\t, while blanks, etc." */
-	Line += Parse_PrepareForSWState(Line + strlen(temp_text)) + strlen(temp_text);
-	Parse_GetText(temp_text, Line);
-
-	/* Remove all spaces "\t, while blanks, etc." */
-	Line += Parse_PrepareForDuration(Line + strlen(temp_text)) + strlen(temp_text);
-
-	retduration = atoi(Line);
-
-	return retduration;
-}
\ No newline at end of file
+	return record.P_Duration;
+}
@@ -21,10 +21,36 @@ enum Parse_Error_t
 	/** Parsing done sucessfully */
 	PARSE_ERROR_OK = 0,
 	/** There is unexpected string in the text line */
-	PARSE_ERROR_UNEXPECTED_STRING = 1
+	PARSE_ERROR_UNEXPECTED_STRING = 1,
+	/** The "+ve" switch state column is missing or unexpected */
+	PARSE_ERROR_INC_SWITCH = 2,
+	/** The "-ve" switch state column is missing or unexpected */
+	PARSE_ERROR_DEC_SWITCH = 3,
+	/** The "P" switch state column is missing or unexpected */
+	PARSE_ERROR_P_SWITCH = 4,
+	/** The "P" switch duration column has no digits */
+	PARSE_ERROR_P_DURATION = 5,
+	/** The "P" switch duration is out of int range */
+	PARSE_ERROR_P_DURATION_OVERFLOW = 6
 };
 typedef enum Parse_Error_t Parse_Error_t;
 
+/**
+ *  This struct holds all decoded fields of one text line
+ */
+struct Parse_Record_t
+{
+	/** The \ref Switches_States_t of "+ve" switch */
+	Switches_States_t Inc_Switch;
+	/** The \ref Switches_States_t of "-ve" switch */
+	Switches_States_t Dec_Switch;
+	/** The \ref Switches_States_t of "P" switch */
+	Switches_States_t P_Switch;
+	/** The pressing duration of "P" switch */
+	int P_Duration;
+};
+typedef struct Parse_Record_t Parse_Record_t;
+
 /* Functions prototype */
 /**
  *  \brief This function for parsing any text line.
@@ -44,9 +70,57 @@ typedef enum Parse_Error_t Parse_Error_t;
  *  		 \ref ParsePSwitch, or \ref ParsePDuaration to get the real state
  *  		 in \ref Switches_States_t type or duration in  integer form.
  */
-void ParseLine(char * Line, char * inc_txt, char * dec_txt, 
+void ParseLine(const char * Line, char * inc_txt, char * dec_txt, 
 			char * p_txt, char * p_time);
 
+/**
+ *  \brief This function decodes all fields of a text line in one pass.
+ *  
+ *  \param [in] Line The line needed to be parsed
+ *  \param [in] Length The number of characters in \p Line
+ *  \param [out] Record The decoded \ref Parse_Record_t
+ *  \return \ref Parse_Error_t type data
+ *  
+ *  \details The line is scanned once from left to right and the
+ *  		 scanning never goes beyond \p Length characters. All fields
+ *  		 of \p Record are always assigned, a column that can't be
+ *  		 decoded is #SWITCH_ERROR or 0 duration and the error code
+ *  		 tells the first column that failed:
+ *  		 - #PARSE_ERROR_INC_SWITCH, #PARSE_ERROR_DEC_SWITCH or
+ *  		   #PARSE_ERROR_P_SWITCH for a switch state column.
+ *  		 - #PARSE_ERROR_P_DURATION or #PARSE_ERROR_P_DURATION_OVERFLOW
+ *  		   for the duration column.
+ */
+Parse_Error_t ParseRecord(const char * Line, unsigned int Length, Parse_Record_t * Record);
+
+/**
+ *  \brief To get the pressing duration of "P" switch from a text.
+ *  
+ *  \param [in] Text the text starting with the duration
+ *  \param [in] Length the number of characters in \p Text
+ *  \param [out] Duration the pressing duration
+ *  \return \ref Parse_Error_t type data.
+ *  
+ *  \details The duration is an optional "-" followed by decimal digits,
+ *  		 the decoding stops at the first other character. It returns:
+ *  		 - #PARSE_ERROR_P_DURATION and 0 \p Duration if there are no digits.
+ *  		 - #PARSE_ERROR_P_DURATION_OVERFLOW and INT_MAX or INT_MIN
+ *  		   \p Duration if the value is out of int range.
+ */
+Parse_Error_t ParseDuration(const char * Text, unsigned int Length, int * Duration);
+
+/**
+ *  \brief To get the \ref Switches_States_t of a switch state text.
+ *  
+ *  \param [in] Text the switch state text
+ *  \param [in] Length the number of characters in \p Text
+ *  \return \ref Switches_States_t type data.
+ *  
+ *  \details It returns #SWITCH_ERROR if \p Text isn't exactly one of
+ *  		 \ref Switches_text, so "pressedx" is an error.
+ */
+Switches_States_t ParseSwitchState(const char * Text, unsigned int Length);
+
 /**
  *  \brief To get the real \ref Switches_States_t of "+ve" switch
  *  	   from input text file.
@@ -54,7 +128,7 @@ void ParseLine(char * Line, char * inc_txt, char * dec_txt,
  *  \param [in] Line "+ve" switch state as text
  *  \return \ref Switches_States_t type data.
  */
-Switches_States_t ParseIncSwitch(char * Line);
+Switches_States_t ParseIncSwitch(const char * Line);
 
 /**
  *  \brief To get the real \ref Switches_States_t of "-ve" switch
@@ -63,7 +137,7 @@ Switches_States_t ParseIncSwitch(char * Line);
  *  \param [in] Line "-ve" switch state as text
  *  \return \ref Switches_States_t type data.
  */
-Switches_States_t ParseDecSwitch(char * Line);
+Switches_States_t ParseDecSwitch(const char * Line);
 
 /**
  *  \brief To get the real \ref Switches_States_t of "P" switch
@@ -72,7 +146,7 @@ Switches_States_t ParseDecSwitch(char * Line);
  *  \param [in] Line "P" switch state as text
  *  \return \ref Switches_States_t type data.
  */
-Switches_States_t ParsePSwitch(char * Line);
+Switches_States_t ParsePSwitch(const char * Line);
 
 /**
  *  \brief To get the real pressing duration of "P" switch from 
@@ -81,6 +155,6 @@ Switches_States_t ParsePSwitch(char * Line);
  *  \param [in] Line duration of "P" switch as text
  *  \return The duration of pressing.
  */
-int ParsePDuaration(char * Line);
+int ParsePDuaration(const char * Line);
 
 #endif // !PARSE_H_
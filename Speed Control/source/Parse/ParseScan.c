@@ -0,0 +1,383 @@
+/**
+ *  \file	ParseScan.c
+ *  \brief	This file includes the implementation of scanning the
+ *  		text line for field boundaries.
+ *  \author Ahmed Wageh.
+ *  \details	Every scan has a scalar version and, on x86 with GCC,
+ *  			SSE2 and AVX2 versions. The vector versions load only
+ *  			whole blocks that are inside the given length and finish
+ *  			the rest of the text with the scalar version.
+ */
+/* Inclusion */
+#include "ParseScan.h"
+
+/* Macros */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+/** The SSE2 and AVX2 versions are built */
+#define PARSE_SCAN_X86
+#include <immintrin.h>
+#endif
+
+/* Private functions proto-type */
+/**
+ *  \brief Byte by byte version of \ref ParseScan_SkipToState.
+ */
+static unsigned int ParseScan_SkipToStateScalar(const char * text, unsigned int length);
+
+/**
+ *  \brief Byte by byte version of \ref ParseScan_SkipToDuration.
+ */
+static unsigned int ParseScan_SkipToDurationScalar(const char * text, unsigned int length);
+
+/**
+ *  \brief Byte by byte version of \ref ParseScan_TextLength.
+ */
+static unsigned int ParseScan_TextLengthScalar(const char * text, unsigned int length);
+
+/* Public variables */
+/** The current scanning to the switch state text */
+unsigned int (*ParseScan_SkipToState)(const char * text, unsigned int length) = ParseScan_SkipToStateScalar;
+/** The current scanning to the pressing duration */
+unsigned int (*ParseScan_SkipToDuration)(const char * text, unsigned int length) = ParseScan_SkipToDurationScalar;
+/** The current scanning to the end of pure text */
+unsigned int (*ParseScan_TextLength)(const char * text, unsigned int length) = ParseScan_TextLengthScalar;
+
+/* Functions definition */
+/* Private functions */
+/**
+ *  \brief Byte by byte version of \ref ParseScan_SkipToState.
+ */
+static unsigned int ParseScan_SkipToStateScalar(const char * text, unsigned int length)
+{
+	/* Needed Variables */
+	unsigned int offset = 0;
+
+	/* Function logic */
+	while (offset < length && text[offset] != 'p' && text[offset] != 'r')
+	{
+		offset++;
+	}
+
+	return offset;
+}
+
+/**
+ *  \brief Byte by byte version of \ref ParseScan_SkipToDuration.
+ */
+static unsigned int ParseScan_SkipToDurationScalar(const char * text, unsigned int length)
+{
+	/* Needed Variables */
+	unsigned int offset = 0;
+
+	/* Function logic */
+	while (offset < length && (text[offset] < '0' || text[offset] > '9') && text[offset] != '-')
+	{
+		offset++;
+	}
+
+	return offset;
+}
+
+/**
+ *  \brief Byte by byte version of \ref ParseScan_TextLength.
+ */
+static unsigned int ParseScan_TextLengthScalar(const char * text, unsigned int length)
+{
+	/* Needed Variables */
+	unsigned int index = 0;
+
+	/* Function Logic */
+	while (index < length && ((text[index] >= 'a' && text[index] <= 'z') || text[index] == '_' ||
+		(text[index] >= '0' && text[index] <= '9')))
+	{
+		index++;
+	}
+
+	return index;
+}
+
+#ifdef PARSE_SCAN_X86
+/**
+ *  \brief SSE2 version of \ref ParseScan_SkipToState.
+ */
+__attribute__((target("sse2")))
+static unsigned int ParseScan_SkipToStateSse2(const char * text, unsigned int length)
+{
+	/* Needed Variables */
+	const __m128i pChar = _mm_set1_epi8('p');
+	const __m128i rChar = _mm_set1_epi8('r');
+	__m128i block;
+	unsigned int offset = 0;
+	unsigned int mask = 0;
+
+	/* Function logic */
+	while (mask == 0 && offset + 16u <= length)
+	{
+		block = _mm_loadu_si128((const __m128i *)(text + offset));
+		mask = (unsigned int)_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(block, pChar),
+			_mm_cmpeq_epi8(block, rChar)));
+		offset += (mask == 0) ? 16u : (unsigned int)__builtin_ctz(mask);
+	}
+	if (mask == 0)
+	{
+		offset += ParseScan_SkipToStateScalar(text + offset, length - offset);
+	}
+
+	return offset;
+}
+
+/**
+ *  \brief SSE2 version of \ref ParseScan_SkipToDuration.
+ */
+__attribute__((target("sse2")))
+static unsigned int ParseScan_SkipToDurationSse2(const char * text, unsigned int length)
+{
+	/* Needed Variables */
+	const __m128i zeroChar = _mm_set1_epi8('0');
+	const __m128i nine = _mm_set1_epi8(9);
+	const __m128i minusChar = _mm_set1_epi8('-');
+	__m128i block;
+	__m128i digit;
+	unsigned int offset = 0;
+	unsigned int mask = 0;
+
+	/* Function logic */
+	while (mask == 0 && offset + 16u <= length)
+	{
+		block = _mm_loadu_si128((const __m128i *)(text + offset));
+		/* "0" to "9" are the bytes with (byte - "0") <= 9 as unsigned */
+		digit = _mm_sub_epi8(block, zeroChar);
+		digit = _mm_cmpeq_epi8(_mm_min_epu8(digit, nine), digit);
+		mask = (unsigned int)_mm_movemask_epi8(_mm_or_si128(digit, _mm_cmpeq_epi8(block, minusChar)));
+		offset += (mask == 0) ? 16u : (unsigned int)__builtin_ctz(mask);
+	}
+	if (mask == 0)
+	{
+		offset += ParseScan_SkipToDurationScalar(text + offset, length - offset);
+	}
+
+	return offset;
+}
+
+/**
+ *  \brief SSE2 version of \ref ParseScan_TextLength.
+ */
+__attribute__((target("sse2")))
+static unsigned int ParseScan_TextLengthSse2(const char * text, unsigned int length)
+{
+	/* Needed Variables */
+	const __m128i aChar = _mm_set1_epi8('a');
+	const __m128i zeroChar = _mm_set1_epi8('0');
+	const __m128i underscore = _mm_set1_epi8('_');
+	const __m128i letters = _mm_set1_epi8('z' - 'a');
+	const __m128i nine = _mm_set1_epi8(9);
+	__m128i block;
+	__m128i letter;
+	__m128i digit;
+	unsigned int offset = 0;
+	unsigned int mask = 0;
+
+	/* Function logic */
+	while (mask == 0 && offset + 16u <= length)
+	{
+		block = _mm_loadu_si128((const __m128i *)(text + offset));
+		letter = _mm_sub_epi8(block, aChar);
+		letter = _mm_cmpeq_epi8(_mm_min_epu8(letter, letters), letter);
+		digit = _mm_sub_epi8(block, zeroChar);
+		digit = _mm_cmpeq_epi8(_mm_min_epu8(digit, nine), digit);
+		/* Bits of the characters that end the pure text */
+		mask = 0xFFFFu ^ (unsigned int)_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(letter, digit),
+			_mm_cmpeq_epi8(block, underscore)));
+		offset += (mask == 0) ? 16u : (unsigned int)__builtin_ctz(mask);
+	}
+	if (mask == 0)
+	{
+		offset += ParseScan_TextLengthScalar(text + offset, length - offset);
+	}
+
+	return offset;
+}
+
+/**
+ *  \brief AVX2 version of \ref ParseScan_SkipToState.
+ */
+__attribute__((target("avx2")))
+static unsigned int ParseScan_SkipToStateAvx2(const char * text, unsigned int length)
+{
+	/* Needed Variables */
+	const __m256i pChar = _mm256_set1_epi8('p');
+	const __m256i rChar = _mm256_set1_epi8('r');
+	__m256i block;
+	unsigned int offset = 0;
+	unsigned int mask = 0;
+
+	/* Function logic */
+	while (mask == 0 && offset + 32u <= length)
+	{
+		block = _mm256_loadu_si256((const __m256i *)(text + offset));
+		mask = (unsigned int)_mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(block, pChar),
+			_mm256_cmpeq_epi8(block, rChar)));
+		offset += (mask == 0) ? 32u : (unsigned int)__builtin_ctz(mask);
+	}
+	if (mask == 0)
+	{
+		offset += ParseScan_SkipToStateSse2(text + offset, length - offset);
+	}
+
+	return offset;
+}
+
+/**
+ *  \brief AVX2 version of \ref ParseScan_SkipToDuration.
+ */
+__attribute__((target("avx2")))
+static unsigned int ParseScan_SkipToDurationAvx2(const char * text, unsigned int length)
+{
+	/* Needed Variables */
+	const __m256i zeroChar = _mm256_set1_epi8('0');
+	const __m256i nine = _mm256_set1_epi8(9);
+	const __m256i minusChar = _mm256_set1_epi8('-');
+	__m256i block;
+	__m256i digit;
+	unsigned int offset = 0;
+	unsigned int mask = 0;
+
+	/* Function logic */
+	while (mask == 0 && offset + 32u <= length)
+	{
+		block = _mm256_loadu_si256((const __m256i *)(text + offset));
+		digit = _mm256_sub_epi8(block, zeroChar);
+		digit = _mm256_cmpeq_epi8(_mm256_min_epu8(digit, nine), digit);
+		mask = (unsigned int)_mm256_movemask_epi8(_mm256_or_si256(digit, _mm256_cmpeq_epi8(block, minusChar)));
+		offset += (mask == 0) ? 32u : (unsigned int)__builtin_ctz(mask);
+	}
+	if (mask == 0)
+	{
+		offset += ParseScan_SkipToDurationSse2(text + offset, length - offset);
+	}
+
+	return offset;
+}
+
+/**
+ *  \brief AVX2 version of \ref ParseScan_TextLength.
+ */
+__attribute__((target("avx2")))
+static unsigned int ParseScan_TextLengthAvx2(const char * text, unsigned int length)
+{
+	/* Needed Variables */
+	const __m256i aChar = _mm256_set1_epi8('a');
+	const __m256i zeroChar = _mm256_set1_epi8('0');
+	const __m256i underscore = _mm256_set1_epi8('_');
+	const __m256i letters = _mm256_set1_epi8('z' - 'a');
+	const __m256i nine = _mm256_set1_epi8(9);
+	__m256i block;
+	__m256i letter;
+	__m256i digit;
+	unsigned int offset = 0;
+	unsigned int mask = 0;
+
+	/* Function logic */
+	while (mask == 0 && offset + 32u <= length)
+	{
+		block = _mm256_loadu_si256((const __m256i *)(text + offset));
+		letter = _mm256_sub_epi8(block, aChar);
+		letter = _mm256_cmpeq_epi8(_mm256_min_epu8(letter, letters), letter);
+		digit = _mm256_sub_epi8(block, zeroChar);
+		digit = _mm256_cmpeq_epi8(_mm256_min_epu8(digit, nine), digit);
+		mask = ~(unsigned int)_mm256_movemask_epi8(_mm256_or_si256(_mm256_or_si256(letter, digit),
+			_mm256_cmpeq_epi8(block, underscore)));
+		offset += (mask == 0) ? 32u : (unsigned int)__builtin_ctz(mask);
+	}
+	if (mask == 0)
+	{
+		offset += ParseScan_TextLengthSse2(text + offset, length - offset);
+	}
+
+	return offset;
+}
+#endif
+
+#ifdef PARSE_SCAN_X86
+/**
+ *  \brief Selects the best level before main, so the scans never
+ *  		change while threads are parsing.
+ */
+__attribute__((constructor))
+static void ParseScan_SelectBestLevel(void)
+{
+	ParseScan_SelectLevel(ParseScan_GetBestLevel());
+}
+#endif
+
+/* Public functions */
+/**
+ *  \brief To get the best instruction set supported by the CPU.
+ *  
+ *  \return \ref ParseScan_Level_t type data.
+ */
+ParseScan_Level_t ParseScan_GetBestLevel(void)
+{
+	/* Needed Variables */
+	ParseScan_Level_t retLevel = PARSE_SCAN_LEVEL_SCALAR;
+
+	/* Function Logic */
+#ifdef PARSE_SCAN_X86
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2"))
+	{
+		retLevel = PARSE_SCAN_LEVEL_AVX2;
+	}
+	else if (__builtin_cpu_supports("sse2"))
+	{
+		retLevel = PARSE_SCAN_LEVEL_SSE2;
+	}
+#endif
+
+	return retLevel;
+}
+
+/**
+ *  \brief To select the instruction set used in scanning.
+ *  
+ *  \param [in] Level The needed \ref ParseScan_Level_t.
+ *  \return The selected \ref ParseScan_Level_t.
+ *  
+ *  \details If the CPU doesn't support \p Level, the best supported
+ *  		 level below it is selected.
+ */
+ParseScan_Level_t ParseScan_SelectLevel(ParseScan_Level_t Level)
+{
+	/* Needed Variables */
+	ParseScan_Level_t retLevel = ParseScan_GetBestLevel();
+
+	/* Function Logic */
+	if (Level < retLevel)
+	{
+		retLevel = Level;
+	}
+
+	switch (retLevel)
+	{
+#ifdef PARSE_SCAN_X86
+		case PARSE_SCAN_LEVEL_AVX2:
+			ParseScan_SkipToState = ParseScan_SkipToStateAvx2;
+			ParseScan_SkipToDuration = ParseScan_SkipToDurationAvx2;
+			ParseScan_TextLength = ParseScan_TextLengthAvx2;
+		break;
+
+		case PARSE_SCAN_LEVEL_SSE2:
+			ParseScan_SkipToState = ParseScan_SkipToStateSse2;
+			ParseScan_SkipToDuration = ParseScan_SkipToDurationSse2;
+			ParseScan_TextLength = ParseScan_TextLengthSse2;
+		break;
+#endif
+
+		default:
+			ParseScan_SkipToState = ParseScan_SkipToStateScalar;
+			ParseScan_SkipToDuration = ParseScan_SkipToDurationScalar;
+			ParseScan_TextLength = ParseScan_TextLengthScalar;
+	}
+
+	return retLevel;
+}
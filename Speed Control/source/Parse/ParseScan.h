@@ -0,0 +1,79 @@
+/**
+ *  \file	ParseScan.h
+ *  \brief	This file handles scanning the text line for field boundaries.
+ *  \author Ahmed Wageh.
+ *  \details	It finds where every field of the text line starts and
+ *  			ends. The scanning uses SSE2 or AVX2 instructions when
+ *  			the CPU supports them and it's selected at run time.
+ */
+#ifndef PARSE_SCAN_H_
+#define PARSE_SCAN_H_
+
+/* User-defined data types */
+/**
+ *  This enum is for the instruction sets used in scanning.
+ */
+enum ParseScan_Level_t
+{
+	/** Byte by byte scanning, it works on any CPU */
+	PARSE_SCAN_LEVEL_SCALAR = 0,
+	/** 16 bytes are checked at once */
+	PARSE_SCAN_LEVEL_SSE2 = 1,
+	/** 32 bytes are checked at once */
+	PARSE_SCAN_LEVEL_AVX2 = 2
+};
+typedef enum ParseScan_Level_t ParseScan_Level_t;
+
+/* Functions proto-type */
+/**
+ *  \brief To select the instruction set used in scanning.
+ *  
+ *  \param [in] Level The needed \ref ParseScan_Level_t.
+ *  \return The selected \ref ParseScan_Level_t.
+ *  
+ *  \details If the CPU doesn't support \p Level, the best supported
+ *  		 level below it is selected. The best level of the CPU is
+ *  		 selected before main, it must not be changed while other
+ *  		 threads are parsing.
+ */
+ParseScan_Level_t ParseScan_SelectLevel(ParseScan_Level_t Level);
+
+/**
+ *  \brief To get the best instruction set supported by the CPU.
+ *  
+ *  \return \ref ParseScan_Level_t type data.
+ */
+ParseScan_Level_t ParseScan_GetBestLevel(void);
+
+/**
+ *  \brief To get the number of characters before a switch state text.
+ *  
+ *  \param [in] text the text line
+ *  \param [in] length the number of characters in \p text
+ *  \return the offset of the first "p" or "r", or \p length if there
+ *  		isn't any.
+ */
+extern unsigned int (*ParseScan_SkipToState)(const char * text, unsigned int length);
+
+/**
+ *  \brief To get the number of characters before the pressing duration.
+ *  
+ *  \param [in] text the text line
+ *  \param [in] length the number of characters in \p text
+ *  \return the offset of the first digit or "-", or \p length if there
+ *  		isn't any.
+ */
+extern unsigned int (*ParseScan_SkipToDuration)(const char * text, unsigned int length);
+
+/**
+ *  \brief To get the length of the pure text at the start of the text line.
+ *  
+ *  \param [in] text the text line
+ *  \param [in] length the number of characters in \p text
+ *  \return the number of characters of the pure text
+ *  
+ *  \details The pure text is made of "a" to "z", "_" and "0" to "9".
+ */
+extern unsigned int (*ParseScan_TextLength)(const char * text, unsigned int length);
+
+#endif // !PARSE_SCAN_H_
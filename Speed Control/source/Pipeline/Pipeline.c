@@ -0,0 +1,552 @@
+/**
+ *  \file	Pipeline.c
+ *  \brief	This file is the implementation of replaying one
+ *  		device by pipelined stages.
+ *  \author Ahmed Wageh.
+ */
+/* Inclusion */
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include "Pipeline.h"
+#include "../File If/FileIf.h"
+#include "../Parse/Parse.h"
+#include "../Speed Control/SpeedControl.h"
+
+/* Macros */
+/** The size of a cache line, the two ends of a ring are kept in two lines */
+#define PIPELINE_CACHE_LINE		64u
+/** The number of checks of a ring before giving the CPU to another thread */
+#define PIPELINE_SPINS			64u
+/** The number of stages that run on their own threads */
+#define PIPELINE_THREADS		3u
+
+/* User-defined data types */
+/**
+ *  This struct is a bounded single producer single consumer ring.
+ *  It holds only the counters, the batches are in arrays of
+ *  #PIPELINE_RING_SIZE batches next to the ring.
+ */
+struct Pipeline_Ring_t
+{
+	/** The number of pushed batches, it's written only by the producer */
+	atomic_uint Head;
+	/** Keeps \p Tail out of the cache line of \p Head */
+	char Head_Padding[PIPELINE_CACHE_LINE - sizeof(atomic_uint)];
+	/** The number of popped batches, it's written only by the consumer */
+	atomic_uint Tail;
+	/** Keeps the batches out of the cache line of \p Tail */
+	char Tail_Padding[PIPELINE_CACHE_LINE - sizeof(atomic_uint)];
+};
+typedef struct Pipeline_Ring_t Pipeline_Ring_t;
+
+/**
+ *  This struct is a batch of input lines.
+ */
+struct Pipeline_Lines_t
+{
+	/** The text of the lines */
+	char * Text;
+	/** The size of \p Text in bytes */
+	unsigned int Size;
+	/** The number of used bytes of \p Text */
+	unsigned int Used;
+	/** The number of lines */
+	unsigned int Count;
+	/** Not 0 if it's the last batch */
+	int Last;
+	/** The offset of every line in \p Text */
+	unsigned int Start[PIPELINE_BATCH_LINES];
+	/** The length of every line */
+	unsigned int Length[PIPELINE_BATCH_LINES];
+};
+typedef struct Pipeline_Lines_t Pipeline_Lines_t;
+
+/**
+ *  This struct is a batch of parsed lines.
+ */
+struct Pipeline_Records_t
+{
+	/** The number of records */
+	unsigned int Count;
+	/** Not 0 if it's the last batch */
+	int Last;
+	/** The records of the lines */
+	Parse_Record_t Records[PIPELINE_BATCH_LINES];
+};
+typedef struct Pipeline_Records_t Pipeline_Records_t;
+
+/**
+ *  This struct is a batch of new motor speeds.
+ */
+struct Pipeline_Speeds_t
+{
+	/** The number of speeds */
+	unsigned int Count;
+	/** Not 0 if it's the last batch */
+	int Last;
+	/** The new speeds */
+	int Speeds[PIPELINE_BATCH_LINES];
+};
+typedef struct Pipeline_Speeds_t Pipeline_Speeds_t;
+
+/**
+ *  This struct holds the rings and the batches between the stages.
+ */
+struct Pipeline_t
+{
+	/** The ring from the reader to the parser */
+	Pipeline_Ring_t Lines_Ring;
+	/** The ring from the parser to the controller */
+	Pipeline_Ring_t Records_Ring;
+	/** The ring from the controller to the writer */
+	Pipeline_Ring_t Speeds_Ring;
+	/** The batches of \p Lines_Ring */
+	Pipeline_Lines_t Lines[PIPELINE_RING_SIZE];
+	/** The batches of \p Records_Ring */
+	Pipeline_Records_t Records[PIPELINE_RING_SIZE];
+	/** The batches of \p Speeds_Ring */
+	Pipeline_Speeds_t Speeds[PIPELINE_RING_SIZE];
+	/** The switches of the replayed device */
+	Switches_Context_t * Switches;
+	/** The motor of the replayed device */
+	Motor_Context_t * Motor;
+	/** Not 0 if the reader couldn't allocate the text of a line */
+	int No_Resources;
+};
+typedef struct Pipeline_t Pipeline_t;
+
+/* Private functions prototype */
+/**
+ *  \brief Waits for the other end of a ring.
+ *
+ *  \param [in,out] Spins The number of waits of this stage.
+ */
+static void Pipeline_Wait(unsigned int * Spins);
+
+/**
+ *  \brief Waits until a ring has a free batch.
+ *
+ *  \param [in] Ring The ring.
+ *  \return The index of the free batch.
+ */
+static unsigned int Pipeline_RingWaitFree(Pipeline_Ring_t * Ring);
+
+/**
+ *  \brief Passes the batch got by \ref Pipeline_RingWaitFree to the consumer.
+ *
+ *  \param [in] Ring The ring.
+ */
+static void Pipeline_RingPush(Pipeline_Ring_t * Ring);
+
+/**
+ *  \brief Waits until a ring has a pushed batch.
+ *
+ *  \param [in] Ring The ring.
+ *  \return The index of the oldest pushed batch.
+ */
+static unsigned int Pipeline_RingWaitPushed(Pipeline_Ring_t * Ring);
+
+/**
+ *  \brief Gives the batch got by \ref Pipeline_RingWaitPushed back to the producer.
+ *
+ *  \param [in] Ring The ring.
+ */
+static void Pipeline_RingPop(Pipeline_Ring_t * Ring);
+
+/**
+ *  \brief The reader stage, it reads the input lines of the device.
+ *
+ *  \param [in] Argument The \ref Pipeline_t.
+ *  \return NULL.
+ */
+static void * Pipeline_ReaderMain(void * Argument);
+
+/**
+ *  \brief The parser stage, it parses the batches of the reader.
+ *
+ *  \param [in] Argument The \ref Pipeline_t.
+ *  \return NULL.
+ */
+static void * Pipeline_ParserMain(void * Argument);
+
+/**
+ *  \brief The controller stage, it calculates the new speed of every line.
+ *
+ *  \param [in] Argument The \ref Pipeline_t.
+ *  \return NULL.
+ */
+static void * Pipeline_ControllerMain(void * Argument);
+
+/**
+ *  \brief The writer stage, it writes the speeds to the motor.
+ *
+ *  \param [in] Pipeline The \ref Pipeline_t.
+ */
+static void Pipeline_Writer(Pipeline_t * Pipeline);
+
+/* Functions definition */
+/* Private functions */
+/**
+ *  \brief Waits for the other end of a ring.
+ *
+ *  \param [in,out] Spins The number of waits of this stage.
+ *
+ *  \details It checks the ring again for #PIPELINE_SPINS times then
+ *  		 it gives the CPU to the other stages.
+ */
+static void Pipeline_Wait(unsigned int * Spins)
+{
+	if (*Spins < PIPELINE_SPINS)
+	{
+		(*Spins)++;
+	}
+	else
+	{
+		sched_yield();
+	}
+}
+
+/**
+ *  \brief Waits until a ring has a free batch.
+ *
+ *  \param [in] Ring The ring.
+ *  \return The index of the free batch.
+ */
+static unsigned int Pipeline_RingWaitFree(Pipeline_Ring_t * Ring)
+{
+	/* Needed variables */
+	unsigned int head = atomic_load_explicit(&Ring->Head, memory_order_relaxed);
+	unsigned int spins = 0;
+
+	/* Function Logic */
+	while (head - atomic_load_explicit(&Ring->Tail, memory_order_acquire) >= PIPELINE_RING_SIZE)
+	{
+		Pipeline_Wait(&spins);
+	}
+
+	return head % PIPELINE_RING_SIZE;
+}
+
+/**
+ *  \brief Passes the batch got by \ref Pipeline_RingWaitFree to the consumer.
+ *
+ *  \param [in] Ring The ring.
+ */
+static void Pipeline_RingPush(Pipeline_Ring_t * Ring)
+{
+	atomic_store_explicit(&Ring->Head, atomic_load_explicit(&Ring->Head, memory_order_relaxed) + 1u,
+		memory_order_release);
+}
+
+/**
+ *  \brief Waits until a ring has a pushed batch.
+ *
+ *  \param [in] Ring The ring.
+ *  \return The index of the oldest pushed batch.
+ */
+static unsigned int Pipeline_RingWaitPushed(Pipeline_Ring_t * Ring)
+{
+	/* Needed variables */
+	unsigned int tail = atomic_load_explicit(&Ring->Tail, memory_order_relaxed);
+	unsigned int spins = 0;
+
+	/* Function Logic */
+	while (atomic_load_explicit(&Ring->Head, memory_order_acquire) == tail)
+	{
+		Pipeline_Wait(&spins);
+	}
+
+	return tail % PIPELINE_RING_SIZE;
+}
+
+/**
+ *  \brief Gives the batch got by \ref Pipeline_RingWaitPushed back to the producer.
+ *
+ *  \param [in] Ring The ring.
+ */
+static void Pipeline_RingPop(Pipeline_Ring_t * Ring)
+{
+	atomic_store_explicit(&Ring->Tail, atomic_load_explicit(&Ring->Tail, memory_order_relaxed) + 1u,
+		memory_order_release);
+}
+
+/**
+ *  \brief The reader stage, it reads the input lines of the device.
+ *
+ *  \param [in] Argument The \ref Pipeline_t.
+ *  \return NULL.
+ *
+ *  \details The lines are copied to the text of the batch because the
+ *  		 read block is reused by the next read. A batch is pushed
+ *  		 when it's full and a line longer than the text of an empty
+ *  		 batch makes the text bigger.
+ */
+static void * Pipeline_ReaderMain(void * Argument)
+{
+	/* Needed variables */
+	Pipeline_t * pipeline = Argument;
+	Pipeline_Lines_t * batch;
+	FileIf_Error_t readError = FILE_IF_ERROR_OK;
+	const char * line;
+	unsigned int length;
+	char * text;
+
+	/* Function Logic */
+	batch = &pipeline->Lines[Pipeline_RingWaitFree(&pipeline->Lines_Ring)];
+	batch->Count = 0;
+	batch->Used = 0;
+	while (readError == FILE_IF_ERROR_OK)
+	{
+		if (pipeline->Switches->Reader == NULL)
+		{
+			readError = File_ReadLineView(&line, &length);
+		}
+		else
+		{
+			readError = File_ReaderNextLine(pipeline->Switches->Reader, &line, &length);
+		}
+
+		if (readError == FILE_IF_ERROR_OK && (batch->Count == PIPELINE_BATCH_LINES ||
+			length > batch->Size - batch->Used) && batch->Count != 0u)	/* Full batch */
+		{
+			batch->Last = 0;
+			Pipeline_RingPush(&pipeline->Lines_Ring);
+			batch = &pipeline->Lines[Pipeline_RingWaitFree(&pipeline->Lines_Ring)];
+			batch->Count = 0;
+			batch->Used = 0;
+		}
+
+		if (readError == FILE_IF_ERROR_OK && length > batch->Size)	/* Long line */
+		{
+			text = realloc(batch->Text, length);
+			if (text == NULL)
+			{
+				pipeline->No_Resources = 1;
+				readError = FILE_IF_ERROR_CAN_NOT_READ;
+			}
+			else
+			{
+				batch->Text = text;
+				batch->Size = length;
+			}
+		}
+
+		if (readError == FILE_IF_ERROR_OK)
+		{
+			memcpy(batch->Text + batch->Used, line, length);
+			batch->Start[batch->Count] = batch->Used;
+			batch->Length[batch->Count] = length;
+			batch->Used += length;
+			batch->Count++;
+		}
+	}
+	batch->Last = 1;
+	Pipeline_RingPush(&pipeline->Lines_Ring);
+
+	return NULL;
+}
+
+/**
+ *  \brief The parser stage, it parses the batches of the reader.
+ *
+ *  \param [in] Argument The \ref Pipeline_t.
+ *  \return NULL.
+ */
+static void * Pipeline_ParserMain(void * Argument)
+{
+	/* Needed variables */
+	Pipeline_t * pipeline = Argument;
+	Pipeline_Lines_t * lines;
+	Pipeline_Records_t * records;
+	unsigned int index;
+	int last = 0;
+
+	/* Function Logic */
+	while (!last)
+	{
+		lines = &pipeline->Lines[Pipeline_RingWaitPushed(&pipeline->Lines_Ring)];
+		records = &pipeline->Records[Pipeline_RingWaitFree(&pipeline->Records_Ring)];
+		for (index = 0; index < lines->Count; index++)
+		{
+			ParseRecord(lines->Text + lines->Start[index], lines->Length[index], &records->Records[index]);
+		}
+		records->Count = lines->Count;
+		records->Last = lines->Last;
+		last = lines->Last;
+		Pipeline_RingPop(&pipeline->Lines_Ring);
+		Pipeline_RingPush(&pipeline->Records_Ring);
+	}
+
+	return NULL;
+}
+
+/**
+ *  \brief The controller stage, it calculates the new speed of every line.
+ *
+ *  \param [in] Argument The \ref Pipeline_t.
+ *  \return NULL.
+ *
+ *  \details It keeps its own copy of the motor speed because the writer
+ *  		 updates the motor of the device later.
+ */
+static void * Pipeline_ControllerMain(void * Argument)
+{
+	/* Needed variables */
+	Pipeline_t * pipeline = Argument;
+	Switches_Context_t * switches = pipeline->Switches;
+	Motor_Context_t motor = *pipeline->Motor;
+	Pipeline_Records_t * records;
+	Pipeline_Speeds_t * speeds;
+	Parse_Record_t * record;
+	unsigned int index;
+	int last = 0;
+
+	/* Function Logic */
+	while (!last)
+	{
+		records = &pipeline->Records[Pipeline_RingWaitPushed(&pipeline->Records_Ring)];
+		speeds = &pipeline->Speeds[Pipeline_RingWaitFree(&pipeline->Speeds_Ring)];
+		for (index = 0; index < records->Count; index++)
+		{
+			record = &records->Records[index];
+			switches->Snapshot.Inc_Switch = record->Inc_Switch;
+			switches->Snapshot.Dec_Switch = record->Dec_Switch;
+			switches->Snapshot.P_Switch = record->P_Switch;
+			switches->Snapshot.P_Duration = record->P_Duration;
+			Motor_ContextSetSpeed(&motor, SpeedControl_ContextCalcNewSpeed(switches, &motor));
+			speeds->Speeds[index] = Motor_ContextGetSpeed(&motor);
+		}
+		speeds->Count = records->Count;
+		speeds->Last = records->Last;
+		last = records->Last;
+		Pipeline_RingPop(&pipeline->Records_Ring);
+		Pipeline_RingPush(&pipeline->Speeds_Ring);
+	}
+
+	return NULL;
+}
+
+/**
+ *  \brief The writer stage, it writes the speeds to the motor.
+ *
+ *  \param [in] Pipeline The \ref Pipeline_t.
+ */
+static void Pipeline_Writer(Pipeline_t * Pipeline)
+{
+	/* Needed variables */
+	Pipeline_Speeds_t * speeds;
+	unsigned int index;
+	int last = 0;
+
+	/* Function Logic */
+	while (!last)
+	{
+		speeds = &Pipeline->Speeds[Pipeline_RingWaitPushed(&Pipeline->Speeds_Ring)];
+		for (index = 0; index < speeds->Count; index++)
+		{
+			Motor_ContextUpdateSpeed(Pipeline->Motor, speeds->Speeds[index]);
+		}
+		last = speeds->Last;
+		Pipeline_RingPop(&Pipeline->Speeds_Ring);
+	}
+}
+
+/* Public functions */
+/**
+ *  \brief This function replays all lines of one device by the pipeline.
+ *
+ *  \param [in] Switches The \ref Switches_Context_t of the device, it
+ *  			has the last read states at the end.
+ *  \param [in] Motor The \ref Motor_Context_t of the device, it has the
+ *  			last speed at the end.
+ *  \return \ref Pipeline_Error_t type data
+ */
+Pipeline_Error_t Pipeline_Run(Switches_Context_t * Switches, Motor_Context_t * Motor)
+{
+	/* Needed variables */
+	static void * (* const stages[PIPELINE_THREADS])(void *) =
+	{
+		Pipeline_ControllerMain, Pipeline_ParserMain, Pipeline_ReaderMain
+	};
+	Pipeline_Error_t retError = PIPELINE_ERROR_OK;
+	pthread_t threads[PIPELINE_THREADS];
+	FileIf_InputFormat_t format;
+	Pipeline_t * pipeline;
+	unsigned int prepared = 0;
+	unsigned int started = 0;
+	unsigned int index;
+
+	/* Function Logic */
+	format = (Switches->Reader == NULL) ? File_GetInputFormat() : Switches->Reader->Format;
+	pipeline = (format == FILE_IF_INPUT_FORMAT_TEXT) ? calloc(1, sizeof(Pipeline_t)) : NULL;
+	retError = (pipeline == NULL) ? PIPELINE_ERROR_NO_RESOURCES : PIPELINE_ERROR_OK;
+	for (; retError == PIPELINE_ERROR_OK && prepared < PIPELINE_RING_SIZE; prepared++)
+	{
+		pipeline->Lines[prepared].Text = malloc(PIPELINE_TEXT_SIZE);
+		pipeline->Lines[prepared].Size = PIPELINE_TEXT_SIZE;
+		if (pipeline->Lines[prepared].Text == NULL)
+		{
+			retError = PIPELINE_ERROR_NO_RESOURCES;
+		}
+	}
+
+	if (retError == PIPELINE_ERROR_OK)
+	{
+		atomic_init(&pipeline->Lines_Ring.Head, 0u);
+		atomic_init(&pipeline->Lines_Ring.Tail, 0u);
+		atomic_init(&pipeline->Records_Ring.Head, 0u);
+		atomic_init(&pipeline->Records_Ring.Tail, 0u);
+		atomic_init(&pipeline->Speeds_Ring.Head, 0u);
+		atomic_init(&pipeline->Speeds_Ring.Tail, 0u);
+		pipeline->Switches = Switches;
+		pipeline->Motor = Motor;
+
+		/* The stages are started from the last one, so nothing is read
+		   until all of them are started */
+		while (started < PIPELINE_THREADS && pthread_create(&threads[started], NULL,
+			stages[started], pipeline) == 0)
+		{
+			started++;
+		}
+		if (started == 1u)	/* Only the controller, stop it */
+		{
+			pipeline->Records[Pipeline_RingWaitFree(&pipeline->Records_Ring)].Last = 1;
+			Pipeline_RingPush(&pipeline->Records_Ring);
+		}
+		else if (started == 2u)	/* No reader, stop the parser */
+		{
+			pipeline->Lines[Pipeline_RingWaitFree(&pipeline->Lines_Ring)].Last = 1;
+			Pipeline_RingPush(&pipeline->Lines_Ring);
+		}
+		if (started != 0u)
+		{
+			Pipeline_Writer(pipeline);
+		}
+		for (index = 0; index < started; index++)
+		{
+			pthread_join(threads[index], NULL);
+		}
+		retError = pipeline->No_Resources ? PIPELINE_ERROR_NO_RESOURCES : PIPELINE_ERROR_OK;
+	}
+
+	if (started != PIPELINE_THREADS)	/* Nothing is read, replay the lines one by one */
+	{
+		while (Switches_ContextUpdateState(Switches) == SWITCH_UPDATE_OK)
+		{
+			Motor_ContextUpdateSpeed(Motor, SpeedControl_ContextCalcNewSpeed(Switches, Motor));
+		}
+		retError = PIPELINE_ERROR_OK;
+	}
+
+	/* Free all resources */
+	for (index = 0; index < prepared; index++)
+	{
+		free(pipeline->Lines[index].Text);
+	}
+	free(pipeline);
+
+	return retError;
+}
@@ -0,0 +1,57 @@
+/**
+ *  \file	Pipeline.h
+ *  \brief	This file handles replaying one device by pipelined stages.
+ *  \author Ahmed Wageh.
+ *  \details	Reading the input lines, parsing them, calculating the
+ *  			new speeds and writing the output lines are done by four
+ *  			threads. Every stage passes batches of lines to the next
+ *  			one through a bounded single producer single consumer ring.
+ */
+#ifndef PIPELINE_H_
+#define PIPELINE_H_
+/* Inclusion */
+#include "../Switches/Switches.h"
+#include "../Motor/Motor.h"
+
+/* Macros */
+/** The maximum number of lines in one batch */
+#define PIPELINE_BATCH_LINES	1024u
+/** The number of batches in every ring, it must be a power of 2 */
+#define PIPELINE_RING_SIZE		8u
+/** The initial size of the text of a batch of input lines */
+#define PIPELINE_TEXT_SIZE		(64u * 1024u)
+
+/* User-defined data types */
+/**
+ *  This enum for error types that could happens when
+ *  replaying by the pipeline
+ */
+enum Pipeline_Error_t
+{
+	/** All lines are replayed */
+	PIPELINE_ERROR_OK = 0,
+	/** Can't allocate memory, the lines after the error aren't replayed */
+	PIPELINE_ERROR_NO_RESOURCES = 1
+};
+typedef enum Pipeline_Error_t Pipeline_Error_t;
+
+/* Functions prototypes */
+/**
+ *  \brief This function replays all lines of one device by the pipeline.
+ *
+ *  \param [in] Switches The \ref Switches_Context_t of the device, it
+ *  			has the last read states at the end.
+ *  \param [in] Motor The \ref Motor_Context_t of the device, it has the
+ *  			last speed at the end.
+ *  \return \ref Pipeline_Error_t type data
+ *
+ *  \details The output is the same as calling \ref Switches_ContextUpdateState,
+ *  		 \ref SpeedControl_ContextCalcNewSpeed and \ref Motor_ContextUpdateSpeed
+ *  		 for every line. The calling thread writes the output lines. A full
+ *  		 ring stops the stage before it until the next stage takes a batch.
+ *  		 If the pipeline can't be allocated or its threads can't be started
+ *  		 the lines are replayed one by one by the calling thread. A binary
+ *  		 trace input has no lines to parse, so it's replayed one by one too.
+ */
+Pipeline_Error_t Pipeline_Run(Switches_Context_t * Switches, Motor_Context_t * Motor);
+#endif // !PIPELINE_H_
@@ -0,0 +1,296 @@
+/**
+ *  \file	Profile.c
+ *  \brief	This file is the implementation of the latency
+ *  		instrumentation of the hot path.
+ *  \author Ahmed Wageh.
+ */
+/* Inclusion */
+#include <stdatomic.h>
+#include "Profile.h"
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+/* User-defined data types */
+/**
+ *  This struct is the histogram of the latencies of one stage.
+ */
+struct Profile_Histogram_t
+{
+	/** The number of latencies in every bucket */
+	atomic_ullong Buckets[PROFILE_BUCKETS];
+	/** The number of latencies */
+	atomic_ullong Count;
+	/** The sum of latencies */
+	atomic_ullong Sum;
+	/** The maximum latency */
+	atomic_ullong Max;
+};
+typedef struct Profile_Histogram_t Profile_Histogram_t;
+
+/* Private variables */
+/** The histograms of all stages */
+static Profile_Histogram_t Profile_Histograms[PROFILE_STAGE_COUNT];
+/** The start time of every stage on every thread */
+static _Thread_local unsigned long long Profile_Starts[PROFILE_STAGE_COUNT];
+/** The names of the stages in the summary */
+static const char * const Profile_Names[PROFILE_STAGE_COUNT] = {"Read", "Parse", "Calc", "Write"};
+
+/* Private functions prototype */
+/**
+ *  \brief Gets the bucket of a latency.
+ *
+ *  \param [in] Ns The latency in nanoseconds.
+ *  \return The index of the bucket.
+ */
+static unsigned int Profile_GetBucket(unsigned long long Ns);
+
+/**
+ *  \brief Gets the highest latency of a bucket.
+ *
+ *  \param [in] Bucket The index of the bucket.
+ *  \return The highest latency in nanoseconds.
+ */
+static unsigned long long Profile_GetBucketTop(unsigned int Bucket);
+
+/* Functions definition */
+/* Private functions */
+/**
+ *  \brief Gets the bucket of a latency.
+ *
+ *  \param [in] Ns The latency in nanoseconds.
+ *  \return The index of the bucket.
+ *
+ *  \details The bucket of a latency of the power of 2 "e" is selected by
+ *  		 its #PROFILE_SUB_BUCKET_BITS bits after the highest set bit.
+ */
+static unsigned int Profile_GetBucket(unsigned long long Ns)
+{
+	/* Needed variables */
+	unsigned int retBucket = (unsigned int)Ns;
+	unsigned int power = PROFILE_SUB_BUCKET_BITS;
+
+	/* Function Logic */
+	if (Ns >= PROFILE_SUB_BUCKETS)
+	{
+#ifdef __GNUC__
+		power = 63u - (unsigned int)__builtin_clzll(Ns);
+#else
+		while ((Ns >> power) > 1u)
+		{
+			power++;
+		}
+#endif
+		retBucket = (power - PROFILE_SUB_BUCKET_BITS + 1u) * PROFILE_SUB_BUCKETS +
+			(unsigned int)((Ns >> (power - PROFILE_SUB_BUCKET_BITS)) & (PROFILE_SUB_BUCKETS - 1u));
+	}
+
+	return retBucket;
+}
+
+/**
+ *  \brief Gets the highest latency of a bucket.
+ *
+ *  \param [in] Bucket The index of the bucket.
+ *  \return The highest latency in nanoseconds.
+ */
+static unsigned long long Profile_GetBucketTop(unsigned int Bucket)
+{
+	/* Needed variables */
+	unsigned long long retTop = Bucket;
+	unsigned int shift;
+
+	/* Function Logic */
+	if (Bucket >= PROFILE_SUB_BUCKETS)
+	{
+		shift = Bucket / PROFILE_SUB_BUCKETS - 1u;
+		retTop = ((unsigned long long)(PROFILE_SUB_BUCKETS + Bucket % PROFILE_SUB_BUCKETS) << shift) +
+			((1ull << shift) - 1u);
+	}
+
+	return retTop;
+}
+
+/* Public functions */
+/**
+ *  \brief Gets a monotonic time stamp in nanoseconds.
+ *
+ *  \return The time stamp in nanoseconds.
+ */
+unsigned long long Profile_GetTimeNs(void)
+{
+#ifdef _WIN32
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+
+	QueryPerformanceCounter(&counter);
+	QueryPerformanceFrequency(&frequency);
+	return (unsigned long long)((double)counter.QuadPart * 1e9 / (double)frequency.QuadPart);
+#else
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (unsigned long long)now.tv_sec * 1000000000ull + (unsigned long long)now.tv_nsec;
+#endif
+}
+
+/**
+ *  \brief This function starts timing a stage on the calling thread.
+ *
+ *  \param [in] Stage The \ref Profile_Stage_t.
+ *  \return None.
+ */
+void Profile_Begin(Profile_Stage_t Stage)
+{
+	Profile_Starts[Stage] = Profile_GetTimeNs();
+}
+
+/**
+ *  \brief This function records the time since \ref Profile_Begin of a
+ *  		stage on the calling thread.
+ *
+ *  \param [in] Stage The \ref Profile_Stage_t.
+ *  \return None.
+ */
+void Profile_End(Profile_Stage_t Stage)
+{
+	Profile_Record(Stage, Profile_GetTimeNs() - Profile_Starts[Stage]);
+}
+
+/**
+ *  \brief This function records one latency of a stage.
+ *
+ *  \param [in] Stage The \ref Profile_Stage_t.
+ *  \param [in] Ns The latency in nanoseconds.
+ *  \return None.
+ */
+void Profile_Record(Profile_Stage_t Stage, unsigned long long Ns)
+{
+	/* Needed variables */
+	Profile_Histogram_t * histogram = &Profile_Histograms[Stage];
+	unsigned long long max = atomic_load_explicit(&histogram->Max, memory_order_relaxed);
+
+	/* Function Logic */
+	atomic_fetch_add_explicit(&histogram->Buckets[Profile_GetBucket(Ns)], 1u, memory_order_relaxed);
+	atomic_fetch_add_explicit(&histogram->Count, 1u, memory_order_relaxed);
+	atomic_fetch_add_explicit(&histogram->Sum, Ns, memory_order_relaxed);
+	while (Ns > max && !atomic_compare_exchange_weak_explicit(&histogram->Max, &max, Ns,
+		memory_order_relaxed, memory_order_relaxed))
+	{
+		/* max is updated by the failed exchange */
+	}
+}
+
+/**
+ *  \brief This function gets the number of recorded latencies of a stage.
+ *
+ *  \param [in] Stage The \ref Profile_Stage_t.
+ *  \return The number of latencies.
+ */
+unsigned long long Profile_GetCount(Profile_Stage_t Stage)
+{
+	return atomic_load_explicit(&Profile_Histograms[Stage].Count, memory_order_relaxed);
+}
+
+/**
+ *  \brief This function gets a percentile of the latencies of a stage.
+ *
+ *  \param [in] Stage The \ref Profile_Stage_t.
+ *  \param [in] Percentile The percentile from 0 to 100, like 99.9.
+ *  \return The highest latency of the bucket of the percentile.
+ */
+unsigned long long Profile_GetPercentile(Profile_Stage_t Stage, double Percentile)
+{
+	/* Needed variables */
+	Profile_Histogram_t * histogram = &Profile_Histograms[Stage];
+	unsigned long long count = Profile_GetCount(Stage);
+	unsigned long long max = Profile_GetMax(Stage);
+	unsigned long long target;
+	unsigned long long seen = 0;
+	unsigned long long retNs = 0;
+	unsigned int bucket;
+
+	/* Function Logic */
+	if (count != 0u)
+	{
+		/* The rank of the percentile, at least the first latency */
+		target = (unsigned long long)((double)count * Percentile / 100.0);
+		if ((double)target < (double)count * Percentile / 100.0 || target == 0u)
+		{
+			target++;
+		}
+		for (bucket = 0; bucket < PROFILE_BUCKETS && seen < target; bucket++)
+		{
+			seen += atomic_load_explicit(&histogram->Buckets[bucket], memory_order_relaxed);
+			retNs = Profile_GetBucketTop(bucket);
+		}
+		if (retNs > max)
+		{
+			retNs = max;
+		}
+	}
+
+	return retNs;
+}
+
+/**
+ *  \brief This function gets the maximum latency of a stage.
+ *
+ *  \param [in] Stage The \ref Profile_Stage_t.
+ *  \return The maximum latency.
+ */
+unsigned long long Profile_GetMax(Profile_Stage_t Stage)
+{
+	return atomic_load_explicit(&Profile_Histograms[Stage].Max, memory_order_relaxed);
+}
+
+/**
+ *  \brief This function clears the histograms of all stages.
+ *
+ *  \return None.
+ */
+void Profile_Reset(void)
+{
+	/* Needed variables */
+	unsigned int stage;
+	unsigned int bucket;
+
+	/* Function Logic */
+	for (stage = 0; stage < PROFILE_STAGE_COUNT; stage++)
+	{
+		for (bucket = 0; bucket < PROFILE_BUCKETS; bucket++)
+		{
+			atomic_store_explicit(&Profile_Histograms[stage].Buckets[bucket], 0u, memory_order_relaxed);
+		}
+		atomic_store_explicit(&Profile_Histograms[stage].Count, 0u, memory_order_relaxed);
+		atomic_store_explicit(&Profile_Histograms[stage].Sum, 0u, memory_order_relaxed);
+		atomic_store_explicit(&Profile_Histograms[stage].Max, 0u, memory_order_relaxed);
+	}
+}
+
+/**
+ *  \brief This function prints the summary of all stages.
+ *
+ *  \param [in] Handler The opened file to print to.
+ *  \return None.
+ */
+void Profile_PrintSummary(FILE * Handler)
+{
+	/* Needed variables */
+	Profile_Stage_t stage;
+	unsigned long long count;
+
+	/* Function Logic */
+	fprintf(Handler, "%-6s %12s %10s %10s %10s %10s %12s\n", "Stage", "Count", "Mean(ns)", "p50(ns)",
+		"p99(ns)", "p999(ns)", "Max(ns)");
+	for (stage = PROFILE_STAGE_READ; stage < PROFILE_STAGE_COUNT; stage++)
+	{
+		count = Profile_GetCount(stage);
+		fprintf(Handler, "%-6s %12llu %10.1f %10llu %10llu %10llu %12llu\n", Profile_Names[stage], count,
+			(count != 0u) ? (double)atomic_load_explicit(&Profile_Histograms[stage].Sum, memory_order_relaxed) /
+			(double)count : 0.0, Profile_GetPercentile(stage, 50.0), Profile_GetPercentile(stage, 99.0),
+			Profile_GetPercentile(stage, 99.9), Profile_GetMax(stage));
+	}
+}
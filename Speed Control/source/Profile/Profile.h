@@ -0,0 +1,139 @@
+/**
+ *  \file	Profile.h
+ *  \brief	This file handles the latency instrumentation of the hot path.
+ *  \author Ahmed Wageh.
+ *  \details	Every stage of a tick records its latencies in nanoseconds
+ *  			into a fixed-size log-linear histogram: the values less than
+ *  			#PROFILE_SUB_BUCKETS have their own bucket and every power of 2
+ *  			above them is split into #PROFILE_SUB_BUCKETS buckets, so a
+ *  			percentile is at most 1 / #PROFILE_SUB_BUCKETS more than the
+ *  			exact one. The hot path uses #PROFILE_BEGIN and #PROFILE_END,
+ *  			they are compiled out unless PROFILE_ENABLED is defined as
+ *  			in Profile target.
+ */
+#ifndef PROFILE_H_
+#define PROFILE_H_
+/* Inclusion */
+#include <stdio.h>
+
+/* Macros */
+/** The number of bits of the sub-buckets of every power of 2 */
+#define PROFILE_SUB_BUCKET_BITS	3u
+/** The number of sub-buckets of every power of 2 */
+#define PROFILE_SUB_BUCKETS		(1u << PROFILE_SUB_BUCKET_BITS)
+/** The number of buckets of a histogram, it covers all 64-bit values */
+#define PROFILE_BUCKETS			((64u - PROFILE_SUB_BUCKET_BITS + 1u) * PROFILE_SUB_BUCKETS)
+
+#ifdef PROFILE_ENABLED
+/** Starts timing \p Stage on the calling thread */
+#define PROFILE_BEGIN(Stage)	Profile_Begin(Stage)
+/** Records the time since #PROFILE_BEGIN of \p Stage on the calling thread */
+#define PROFILE_END(Stage)		Profile_End(Stage)
+/** Prints the summary of all stages to the opened file \p Handler */
+#define PROFILE_PRINT_SUMMARY(Handler)	Profile_PrintSummary(Handler)
+#else
+#define PROFILE_BEGIN(Stage)	((void)0)
+#define PROFILE_END(Stage)		((void)0)
+#define PROFILE_PRINT_SUMMARY(Handler)	((void)0)
+#endif
+
+/* User-defined data types */
+/**
+ *  This enum is for the instrumented stages of a tick.
+ */
+enum Profile_Stage_t
+{
+	/** Reading the next line or record of the input file */
+	PROFILE_STAGE_READ = 0,
+	/** Parsing the text line */
+	PROFILE_STAGE_PARSE = 1,
+	/** Calculating the new speed */
+	PROFILE_STAGE_CALC = 2,
+	/** Writing the speed to the output file */
+	PROFILE_STAGE_WRITE = 3,
+	/** The number of stages */
+	PROFILE_STAGE_COUNT = 4
+};
+typedef enum Profile_Stage_t Profile_Stage_t;
+
+/* Functions prototypes */
+/**
+ *  \brief Gets a monotonic time stamp in nanoseconds.
+ *
+ *  \return The time stamp in nanoseconds.
+ */
+unsigned long long Profile_GetTimeNs(void);
+
+/**
+ *  \brief This function starts timing a stage on the calling thread.
+ *
+ *  \param [in] Stage The \ref Profile_Stage_t.
+ *  \return None.
+ */
+void Profile_Begin(Profile_Stage_t Stage);
+
+/**
+ *  \brief This function records the time since \ref Profile_Begin of a
+ *  		stage on the calling thread.
+ *
+ *  \param [in] Stage The \ref Profile_Stage_t.
+ *  \return None.
+ *
+ *  \details The time includes reading the clock once.
+ */
+void Profile_End(Profile_Stage_t Stage);
+
+/**
+ *  \brief This function records one latency of a stage.
+ *
+ *  \param [in] Stage The \ref Profile_Stage_t.
+ *  \param [in] Ns The latency in nanoseconds.
+ *  \return None.
+ *
+ *  \details Many threads can record at once.
+ */
+void Profile_Record(Profile_Stage_t Stage, unsigned long long Ns);
+
+/**
+ *  \brief This function gets the number of recorded latencies of a stage.
+ *
+ *  \param [in] Stage The \ref Profile_Stage_t.
+ *  \return The number of latencies.
+ */
+unsigned long long Profile_GetCount(Profile_Stage_t Stage);
+
+/**
+ *  \brief This function gets a percentile of the latencies of a stage.
+ *
+ *  \param [in] Stage The \ref Profile_Stage_t.
+ *  \param [in] Percentile The percentile from 0 to 100, like 99.9.
+ *  \return The highest latency of the bucket of the percentile, it's
+ *  		never more than the maximum latency. It's 0 without latencies.
+ */
+unsigned long long Profile_GetPercentile(Profile_Stage_t Stage, double Percentile);
+
+/**
+ *  \brief This function gets the maximum latency of a stage.
+ *
+ *  \param [in] Stage The \ref Profile_Stage_t.
+ *  \return The maximum latency.
+ */
+unsigned long long Profile_GetMax(Profile_Stage_t Stage);
+
+/**
+ *  \brief This function clears the histograms of all stages.
+ *
+ *  \return None.
+ */
+void Profile_Reset(void);
+
+/**
+ *  \brief This function prints the summary of all stages.
+ *
+ *  \param [in] Handler The opened file to print to.
+ *  \return None.
+ *
+ *  \details Every stage has its count, mean, p50, p99, p999 and maximum.
+ */
+void Profile_PrintSummary(FILE * Handler);
+#endif // !PROFILE_H_
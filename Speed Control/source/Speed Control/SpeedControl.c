@@ -7,9 +7,269 @@
  *  		 of "P" switch.
  */
 /* Inclusion */
+#include <limits.h>
 #include "../Switches/Switches.h"
 #include "../Motor/Motor.h"
 #include "SpeedControl.h"
+#include "../Profile/Profile.h"
+
+/* Macros */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+/** The AVX2 version of the batch calculation is built */
+#define SPEED_CONTROL_X86
+#endif
+
+#if defined(__GNUC__) && !defined(__clang__)
+/** The batch loop is vectorized even if the build doesn't vectorize loops,
+ *  clang doesn't support the optimize attribute */
+#define SPEED_CONTROL_VECTORIZE	__attribute__((optimize("tree-vectorize", "vect-cost-model=dynamic")))
+#else
+#define SPEED_CONTROL_VECTORIZE
+#endif
+
+#ifdef __GNUC__
+/** The batch loop is copied into every version of the batch calculation */
+#define SPEED_CONTROL_INLINE	static inline __attribute__((always_inline))
+/** The pointers of the batch arrays don't overlap */
+#define SPEED_CONTROL_RESTRICT	__restrict__
+#else
+#define SPEED_CONTROL_INLINE	static
+#define SPEED_CONTROL_RESTRICT
+#endif
+
+#ifdef SPEED_CONTROL_TABLE_ENABLED
+/** The new speed of the device is calculated by the tables */
+#define SPEED_CONTROL_CALC_SPEED	SpeedControl_TableCalcSpeed
+#else
+/** The new speed of the device is calculated by the rules */
+#define SPEED_CONTROL_CALC_SPEED	SpeedControl_CalcSpeed
+#endif
+
+/** The number of switch states in the tables, from #SWITCH_ERROR to #SWITCH_PRE_RELEASED */
+#define SPEED_CONTROL_TABLE_STATES		(SWITCH_PRE_RELEASED + 1)
+/** The number of speeds between the motor limits */
+#define SPEED_CONTROL_TABLE_SPEEDS		(MOTOR_MAXIMUM_SPEED - MOTOR_MINIMUM_SPEED + 1)
+/** The number of "P" steps which take any speed between the motor limits below the minimum */
+#define SPEED_CONTROL_TABLE_MAX_STEPS	SPEED_CONTROL_TABLE_SPEEDS
+/** The number of the "P" duration buckets, no steps and every step count */
+#define SPEED_CONTROL_TABLE_DURATIONS	(SPEED_CONTROL_TABLE_MAX_STEPS + 1)
+/** The number of steps of one tick, every "P" step count, no step and "+ve" step */
+#define SPEED_CONTROL_TABLE_STEPS		(SPEED_CONTROL_TABLE_MAX_STEPS + 2)
+
+/* Private variables */
+/** The step of the speed for every switches states and "P" duration bucket,
+ *  it's the row of \ref SpeedControl_Table_Speeds */
+static unsigned char SpeedControl_Table_Steps[SPEED_CONTROL_TABLE_STATES][SPEED_CONTROL_TABLE_STATES]
+	[SPEED_CONTROL_TABLE_STATES][SPEED_CONTROL_TABLE_DURATIONS];
+/** The new speed for every step and speed between the motor limits */
+static unsigned char SpeedControl_Table_Speeds[SPEED_CONTROL_TABLE_STEPS][SPEED_CONTROL_TABLE_SPEEDS];
+/** Not 0 if the tables are generated by \ref SpeedControl_TableInit */
+static int SpeedControl_Table_Ready = 0;
+
+/* Private functions */
+/**
+ *  \brief 	The branchless loop of \ref SpeedControl_CalcSpeedBatch.
+ *  
+ *  \details Every rule is calculated for every device and the result is
+ *  		 selected by the priority of the rules, so the loop has no
+ *  		 branches and it can be vectorized.
+ */
+SPEED_CONTROL_INLINE void SpeedControl_CalcSpeedLoop(const Switches_States_t * SPEED_CONTROL_RESTRICT IncSwitch,
+	const Switches_States_t * SPEED_CONTROL_RESTRICT DecSwitch, const Switches_States_t * SPEED_CONTROL_RESTRICT PSwitch,
+	const int * SPEED_CONTROL_RESTRICT PDuration, const int * SPEED_CONTROL_RESTRICT MotorSpeed,
+	int * SPEED_CONTROL_RESTRICT NewSpeed, unsigned int Count)
+{
+	/* Needed variables */
+	unsigned int index;
+	int speed;
+	int pressed;
+	int steps;
+	int limit;
+	int step;
+
+	/* Function Logic */
+	for (index = 0; index < Count; index++)
+	{
+		speed = MotorSpeed[index];
+		/* "P" switch: one step down for every full step duration */
+		pressed = (PSwitch[index] == SWITCH_PRESSED) & (PDuration[index] >= SPEED_CONTROL_P_STEP_DURATION);
+		steps = pressed ? PDuration[index] / SPEED_CONTROL_P_STEP_DURATION : 0;
+		limit = (speed >= MOTOR_MINIMUM_SPEED) ? speed - MOTOR_MINIMUM_SPEED + 1 : 0;
+		steps = (steps < limit) ? steps : limit;
+		/* "-ve" switch has a higher priority than "+ve" switch */
+		step = (DecSwitch[index] == SWITCH_PRE_PRESSED) ? -(speed >= MOTOR_MINIMUM_SPEED) :
+			((IncSwitch[index] == SWITCH_PRE_PRESSED) & (speed <= MOTOR_MAXIMUM_SPEED));
+		NewSpeed[index] = pressed ? speed - steps : speed + step;
+	}
+}
+
+/**
+ *  \brief 	The version of \ref SpeedControl_CalcSpeedBatch for any CPU.
+ */
+SPEED_CONTROL_VECTORIZE
+static void SpeedControl_CalcSpeedBatchDefault(const Switches_States_t * IncSwitch, const Switches_States_t * DecSwitch,
+	const Switches_States_t * PSwitch, const int * PDuration, const int * MotorSpeed,
+	int * NewSpeed, unsigned int Count)
+{
+	SpeedControl_CalcSpeedLoop(IncSwitch, DecSwitch, PSwitch, PDuration, MotorSpeed, NewSpeed, Count);
+}
+
+#ifdef SPEED_CONTROL_X86
+/**
+ *  \brief 	The AVX2 version of \ref SpeedControl_CalcSpeedBatch.
+ */
+SPEED_CONTROL_VECTORIZE __attribute__((target("avx2")))
+static void SpeedControl_CalcSpeedBatchAvx2(const Switches_States_t * IncSwitch, const Switches_States_t * DecSwitch,
+	const Switches_States_t * PSwitch, const int * PDuration, const int * MotorSpeed,
+	int * NewSpeed, unsigned int Count)
+{
+	SpeedControl_CalcSpeedLoop(IncSwitch, DecSwitch, PSwitch, PDuration, MotorSpeed, NewSpeed, Count);
+}
+#endif
+
+/**
+ *  \brief 	Calculates the change of the motor speed in one tick.
+ *  \param [in] IncSwitch The state of "+ve" switch.
+ *  \param [in] DecSwitch The state of "-ve" switch.
+ *  \param [in] PSwitch The state of "P" switch.
+ *  \param [in] PDuration The pressing duration of "P" switch.
+ *  \return The step of the speed every tick until it's limited.
+ *  
+ *  \details The rules are the same as \ref SpeedControl_CalcSpeed for a
+ *  		 speed between the limits. The "P" steps which go below the
+ *  		 minimum are limited by the motor.
+ */
+static int SpeedControl_CalcStep(Switches_States_t IncSwitch, Switches_States_t DecSwitch,
+	Switches_States_t PSwitch, int PDuration)
+{
+	/* Needed variables */
+	int retStep = 0;
+
+	/* Function Logic */
+	if (PSwitch == SWITCH_PRESSED && PDuration >= SPEED_CONTROL_P_STEP_DURATION)
+	{
+		retStep = -(PDuration / SPEED_CONTROL_P_STEP_DURATION);
+	}
+	else if (DecSwitch == SWITCH_PRE_PRESSED)
+	{
+		retStep = -1;
+	}
+	else if (IncSwitch == SWITCH_PRE_PRESSED)
+	{
+		retStep = 1;
+	}
+
+	return retStep;
+}
+
+/**
+ *  \brief 	Calculates the number of ticks which change the motor speed.
+ *  \param [in] Step The step of the speed every tick.
+ *  \param [in] MotorSpeed The speed before the first tick.
+ *  \return The number of ticks until the speed is limited.
+ */
+static unsigned int SpeedControl_CalcChangingTicks(int Step, int MotorSpeed)
+{
+	/* Needed variables */
+	unsigned int retTicks = 0;
+
+	/* Function Logic */
+	if (Step < 0 && MotorSpeed > MOTOR_MINIMUM_SPEED)
+	{
+		/* The last step may go below the minimum */
+		retTicks = (unsigned int)((MotorSpeed - MOTOR_MINIMUM_SPEED - Step - 1) / -Step);
+	}
+	else if (Step > 0 && MotorSpeed < MOTOR_MAXIMUM_SPEED)
+	{
+		retTicks = (unsigned int)((MOTOR_MAXIMUM_SPEED - MotorSpeed + Step - 1) / Step);
+	}
+
+	return retTicks;
+}
+
+/**
+ *  \brief 	Calculates the motor speed after many ticks of the same step.
+ *  \param [in] Step The step of the speed every tick.
+ *  \param [in] MotorSpeed The speed before the first tick.
+ *  \param [in] Ticks The number of ticks.
+ *  \return The motor speed after \p Ticks ticks.
+ */
+static int SpeedControl_CalcStepRun(int Step, int MotorSpeed, unsigned int Ticks)
+{
+	/* Needed variables */
+	int retSpeed = MotorSpeed;
+
+	/* Function Logic */
+	if (Ticks < SpeedControl_CalcChangingTicks(Step, MotorSpeed))
+	{
+		retSpeed = MotorSpeed + Step * (int)Ticks;
+	}
+	else if (Step < 0)
+	{
+		retSpeed = MOTOR_MINIMUM_SPEED;
+	}
+	else if (Step > 0)
+	{
+		retSpeed = MOTOR_MAXIMUM_SPEED;
+	}
+
+	return retSpeed;
+}
+
+/**
+ *  \brief 	Limits a value between two limits.
+ *  \param [in] Value The value.
+ *  \param [in] Low The lowest value.
+ *  \param [in] High The highest value, it isn't less than \p Low.
+ *  \return The limited value.
+ */
+static int SpeedControl_Limit(int Value, int Low, int High)
+{
+	/* Needed variables */
+	int retValue = Value;
+
+	/* Function Logic */
+	if (retValue < Low)
+	{
+		retValue = Low;
+	}
+	else if (retValue > High)
+	{
+		retValue = High;
+	}
+
+	return retValue;
+}
+
+/**
+ *  \brief 	Updates the motor of one device for a run of ticks.
+ *  \param [in] Motor The \ref Motor_Context_t of the device.
+ *  \param [in] Step The step of the speed every tick.
+ *  \param [in] Ticks The number of ticks of the run.
+ *  \return The number of ticks written as a repeat of the limited speed.
+ */
+static unsigned int SpeedControl_ContextUpdateRun(Motor_Context_t * Motor, int Step, unsigned int Ticks)
+{
+	/* Needed variables */
+	int speed = Motor_ContextGetSpeed(Motor);
+	unsigned int changing = SpeedControl_CalcChangingTicks(Step, speed);
+	unsigned int tick;
+
+	/* Function Logic */
+	if (changing > Ticks)
+	{
+		changing = Ticks;
+	}
+	for (tick = 1; tick <= changing; tick++)
+	{
+		Motor_ContextUpdateSpeed(Motor, SpeedControl_CalcStepRun(Step, speed, tick));
+	}
+	Motor_ContextRepeatSpeed(Motor, Ticks - changing);
+
+	return Ticks - changing;
+}
+
+/* Public functions */
 
 /**
  *  \brief 	This function calculates the target new speed that
@@ -21,31 +281,83 @@
 int SpeedControl_CalcNewSpeed(void)
 {
 	/* Needed variables */
-	Switches_States_t IncSwitch = SWITCH_RELEASED;
-	Switches_States_t DecSwitch = SWITCH_RELEASED;
-	Switches_States_t PSwitch = SWITCH_RELEASED;
-	int PDuration = 0;
 	int MotorSpeed = MOTOR_MEDIUM_SPEED;
 
 	/* Function Logic */
-	/* Get switches states */
-	IncSwitch = Switches_GetState(SWITCH_INCREMENT);
-	DecSwitch = Switches_GetState(SWITCH_DECREMENT);
-	PSwitch = Switches_GetState(SWITCH_P);
-	PDuration = Switches_GetPDuration();
-
+	PROFILE_BEGIN(PROFILE_STAGE_CALC);
 	/* Get current motor speed */
 	MotorSpeed = Motor_GetSpeed();
 
-	/* Calculating new speed */
-	if (PSwitch == SWITCH_PRESSED && PDuration >= 30000)
+	/* Calculating new speed from the switches states of this tick */
+	MotorSpeed = SpeedControl_CalcSnapshotSpeed(Switches_Snapshot, MotorSpeed);
+	PROFILE_END(PROFILE_STAGE_CALC);
+
+	/* Return new calculated speed */
+	return MotorSpeed;
+}
+
+/**
+ *  \brief 	This function calculates the new speed from the readings
+ *  		of the switches at one tick and the motor speed.
+ *  \param [in] Snapshot The \ref Switches_Snapshot_t of the switches.
+ *  \param [in] MotorSpeed The current motor speed.
+ *  \return The new calculated speed.
+ */
+int SpeedControl_CalcSnapshotSpeed(const Switches_Snapshot_t * Snapshot, int MotorSpeed)
+{
+	return SPEED_CONTROL_CALC_SPEED(Snapshot->Inc_Switch, Snapshot->Dec_Switch, Snapshot->P_Switch,
+		Snapshot->P_Duration, MotorSpeed);
+}
+
+/**
+ *  \brief 	This function calculates the target new speed of one
+ *  		device depend on its switches states.
+ *  \param [in] Switches The \ref Switches_Context_t of the device.
+ *  \param [in] Motor The \ref Motor_Context_t of the device.
+ *  \return The new calculated speed.
+ */
+int SpeedControl_ContextCalcNewSpeed(const Switches_Context_t * Switches, const Motor_Context_t * Motor)
+{
+	/* Needed variables */
+	int retSpeed;
+
+	/* Function Logic */
+	PROFILE_BEGIN(PROFILE_STAGE_CALC);
+	retSpeed = SpeedControl_CalcSnapshotSpeed(&Switches->Snapshot, Motor->Speed);
+	PROFILE_END(PROFILE_STAGE_CALC);
+
+	return retSpeed;
+}
+
+/**
+ *  \brief 	This function calculates the new speed from given
+ *  		switches states and motor speed.
+ *  \param [in] IncSwitch The state of "+ve" switch.
+ *  \param [in] DecSwitch The state of "-ve" switch.
+ *  \param [in] PSwitch The state of "P" switch.
+ *  \param [in] PDuration The pressing duration of "P" switch.
+ *  \param [in] MotorSpeed The current motor speed.
+ *  \return The new calculated speed.
+ */
+int SpeedControl_CalcSpeed(Switches_States_t IncSwitch, Switches_States_t DecSwitch,
+	Switches_States_t PSwitch, int PDuration, int MotorSpeed)
+{
+	/* Needed variables */
+	int steps;
+
+	/* Function Logic */
+	if (PSwitch == SWITCH_PRESSED && PDuration >= SPEED_CONTROL_P_STEP_DURATION)
 	{
 		if (MotorSpeed >= MOTOR_MINIMUM_SPEED)
 		{
-			do{
-                MotorSpeed--;
-                PDuration -= 30000;
-			}while(PDuration >= 30000 && MotorSpeed >= MOTOR_MINIMUM_SPEED);
+			/* One step for every full step duration while the speed isn't
+			   less than the minimum, so the last step may go below it */
+			steps = PDuration / SPEED_CONTROL_P_STEP_DURATION;
+			if (steps > MotorSpeed - MOTOR_MINIMUM_SPEED + 1)
+			{
+				steps = MotorSpeed - MOTOR_MINIMUM_SPEED + 1;
+			}
+			MotorSpeed -= steps;
 		}
 	}
 	else if(DecSwitch == SWITCH_PRE_PRESSED)
@@ -63,6 +375,306 @@ int SpeedControl_CalcNewSpeed(void)
 		}
 	}
 
-	/* Return new calculated speed */
 	return MotorSpeed;
 }
+
+/**
+ *  \brief 	This function calculates the new speeds of many devices.
+ *  \param [in] IncSwitch The states of "+ve" switch of every device.
+ *  \param [in] DecSwitch The states of "-ve" switch of every device.
+ *  \param [in] PSwitch The states of "P" switch of every device.
+ *  \param [in] PDuration The pressing durations of "P" switch of every device.
+ *  \param [in] MotorSpeed The current motor speeds of every device.
+ *  \param [out] NewSpeed The new calculated speeds of every device.
+ *  \param [in] Count The number of devices.
+ *  \return None.
+ */
+void SpeedControl_CalcSpeedBatch(const Switches_States_t * IncSwitch, const Switches_States_t * DecSwitch,
+	const Switches_States_t * PSwitch, const int * PDuration, const int * MotorSpeed,
+	int * NewSpeed, unsigned int Count)
+{
+#ifdef SPEED_CONTROL_X86
+	if (__builtin_cpu_supports("avx2"))
+	{
+		SpeedControl_CalcSpeedBatchAvx2(IncSwitch, DecSwitch, PSwitch, PDuration, MotorSpeed, NewSpeed, Count);
+	}
+	else
+#endif
+	{
+		SpeedControl_CalcSpeedBatchDefault(IncSwitch, DecSwitch, PSwitch, PDuration, MotorSpeed, NewSpeed, Count);
+	}
+}
+
+/**
+ *  \brief 	This function calculates the motor speed after many ticks
+ *  		of the same switches states.
+ *  \param [in] IncSwitch The state of "+ve" switch.
+ *  \param [in] DecSwitch The state of "-ve" switch.
+ *  \param [in] PSwitch The state of "P" switch.
+ *  \param [in] PDuration The pressing duration of "P" switch.
+ *  \param [in] MotorSpeed The current motor speed.
+ *  \param [in] Ticks The number of ticks.
+ *  \return The motor speed after \p Ticks ticks.
+ */
+int SpeedControl_CalcSpeedRun(Switches_States_t IncSwitch, Switches_States_t DecSwitch,
+	Switches_States_t PSwitch, int PDuration, int MotorSpeed, unsigned int Ticks)
+{
+	return SpeedControl_CalcStepRun(SpeedControl_CalcStep(IncSwitch, DecSwitch, PSwitch, PDuration),
+		MotorSpeed, Ticks);
+}
+
+/**
+ *  \brief 	This function replays all lines of one device by runs.
+ *  \param [in] Switches The \ref Switches_Context_t of the device.
+ *  \param [in] Motor The \ref Motor_Context_t of the device.
+ *  \param [out] Skipped The number of ticks that are written as a
+ *  			repeat of the limited speed.
+ *  \return The number of replayed lines.
+ */
+unsigned long long SpeedControl_ContextReplay(Switches_Context_t * Switches, Motor_Context_t * Motor,
+	unsigned long long * Skipped)
+{
+	/* Needed variables */
+	unsigned long long retLines = 0;
+	unsigned int ticks = 0;
+	int step = 0;
+	int next;
+
+	/* Function Logic */
+	*Skipped = 0;
+	while (Switches_ContextUpdateState(Switches) == SWITCH_UPDATE_OK)
+	{
+		next = SpeedControl_CalcStep(Switches->Snapshot.Inc_Switch, Switches->Snapshot.Dec_Switch,
+			Switches->Snapshot.P_Switch, Switches->Snapshot.P_Duration);
+		if (ticks != 0u && (next != step || ticks == ~0u))	/* The run ends */
+		{
+			*Skipped += SpeedControl_ContextUpdateRun(Motor, step, ticks);
+			ticks = 0;
+		}
+		step = next;
+		ticks++;
+		retLines++;
+	}
+	if (ticks != 0u)
+	{
+		*Skipped += SpeedControl_ContextUpdateRun(Motor, step, ticks);
+	}
+
+	return retLines;
+}
+
+/**
+ *  \brief 	This function initializes the change of the motor speed
+ *  		over no ticks.
+ *  \param [out] Transfer The \ref SpeedControl_Transfer_t which keeps
+ *  			every speed.
+ *  \return None.
+ */
+void SpeedControl_TransferInit(SpeedControl_Transfer_t * Transfer)
+{
+	Transfer->Offset = 0;
+	Transfer->Low = MOTOR_MINIMUM_SPEED;
+	Transfer->High = MOTOR_MAXIMUM_SPEED;
+}
+
+/**
+ *  \brief 	This function calculates the change of the motor speed in
+ *  		one tick.
+ *  \param [in] IncSwitch The state of "+ve" switch.
+ *  \param [in] DecSwitch The state of "-ve" switch.
+ *  \param [in] PSwitch The state of "P" switch.
+ *  \param [in] PDuration The pressing duration of "P" switch.
+ *  \param [out] Transfer The \ref SpeedControl_Transfer_t of the tick.
+ *  \return None.
+ *  
+ *  \details The tick changes the speed by its step and the motor limits it.
+ */
+void SpeedControl_CalcTransfer(Switches_States_t IncSwitch, Switches_States_t DecSwitch,
+	Switches_States_t PSwitch, int PDuration, SpeedControl_Transfer_t * Transfer)
+{
+	Transfer->Offset = SpeedControl_Limit(SpeedControl_CalcStep(IncSwitch, DecSwitch, PSwitch, PDuration),
+		MOTOR_MINIMUM_SPEED - MOTOR_MAXIMUM_SPEED, MOTOR_MAXIMUM_SPEED - MOTOR_MINIMUM_SPEED);
+	Transfer->Low = MOTOR_MINIMUM_SPEED;
+	Transfer->High = MOTOR_MAXIMUM_SPEED;
+}
+
+/**
+ *  \brief 	This function appends the ticks of a change of the motor
+ *  		speed to another change.
+ *  \param [in,out] Transfer The \ref SpeedControl_Transfer_t of the first
+ *  			ticks, it becomes the change over all ticks.
+ *  \param [in] Next The \ref SpeedControl_Transfer_t of the ticks after them.
+ *  \return None.
+ *  
+ *  \details Limiting s + Offset between Low and High then adding the next
+ *  		 offset and limiting it between the next limits is the same as
+ *  		 limiting s + both offsets between the first limits moved by the
+ *  		 next offset and limited by the next limits. The limits are never
+ *  		 out of the motor limits, so an offset which moves every speed out
+ *  		 of them gives the same speeds as the largest motor step.
+ */
+void SpeedControl_TransferAppend(SpeedControl_Transfer_t * Transfer, const SpeedControl_Transfer_t * Next)
+{
+	Transfer->Offset = SpeedControl_Limit(Transfer->Offset + Next->Offset,
+		MOTOR_MINIMUM_SPEED - MOTOR_MAXIMUM_SPEED, MOTOR_MAXIMUM_SPEED - MOTOR_MINIMUM_SPEED);
+	Transfer->Low = SpeedControl_Limit(Transfer->Low + Next->Offset, Next->Low, Next->High);
+	Transfer->High = SpeedControl_Limit(Transfer->High + Next->Offset, Next->Low, Next->High);
+}
+
+/**
+ *  \brief 	This function applies a change of the motor speed.
+ *  \param [in] Transfer The \ref SpeedControl_Transfer_t of the ticks.
+ *  \param [in] MotorSpeed The speed before the ticks.
+ *  \return The motor speed after the ticks.
+ */
+int SpeedControl_TransferApply(const SpeedControl_Transfer_t * Transfer, int MotorSpeed)
+{
+	return SpeedControl_Limit(MotorSpeed + Transfer->Offset, Transfer->Low, Transfer->High);
+}
+
+/**
+ *  \brief 	This function generates the tables of the new speed.
+ *  \return None.
+ *  
+ *  \details Every step is found by \ref SpeedControl_CalcSpeed from the
+ *  		 maximum speed, which no step can take below the lowest new
+ *  		 speed. Every row of the speeds is the new speed by
+ *  		 \ref SpeedControl_CalcSpeed of switches states with this step.
+ */
+void SpeedControl_TableInit(void)
+{
+	/* Needed variables */
+	Switches_States_t inc;
+	Switches_States_t dec;
+	Switches_States_t p;
+	int duration;
+	int step;
+	int speed;
+
+	/* Function Logic */
+	for (inc = SWITCH_ERROR; inc < SPEED_CONTROL_TABLE_STATES; inc++)
+	{
+		for (dec = SWITCH_ERROR; dec < SPEED_CONTROL_TABLE_STATES; dec++)
+		{
+			for (p = SWITCH_ERROR; p < SPEED_CONTROL_TABLE_STATES; p++)
+			{
+				for (duration = 0; duration < SPEED_CONTROL_TABLE_DURATIONS; duration++)
+				{
+					step = SpeedControl_CalcSpeed(inc, dec, p, duration * SPEED_CONTROL_P_STEP_DURATION,
+						MOTOR_MAXIMUM_SPEED) - MOTOR_MAXIMUM_SPEED;
+					SpeedControl_Table_Steps[inc][dec][p][duration] =
+						(unsigned char)(step + SPEED_CONTROL_TABLE_MAX_STEPS);
+				}
+			}
+		}
+	}
+
+	for (step = 0; step < SPEED_CONTROL_TABLE_STEPS; step++)
+	{
+		for (speed = MOTOR_MINIMUM_SPEED; speed <= MOTOR_MAXIMUM_SPEED; speed++)
+		{
+			if (step < SPEED_CONTROL_TABLE_MAX_STEPS)	/* "P" steps */
+			{
+				SpeedControl_Table_Speeds[step][speed - MOTOR_MINIMUM_SPEED] = (unsigned char)SpeedControl_CalcSpeed(
+					SWITCH_RELEASED, SWITCH_RELEASED, SWITCH_PRESSED,
+					(SPEED_CONTROL_TABLE_MAX_STEPS - step) * SPEED_CONTROL_P_STEP_DURATION, speed);
+			}
+			else
+			{
+				SpeedControl_Table_Speeds[step][speed - MOTOR_MINIMUM_SPEED] = (unsigned char)SpeedControl_CalcSpeed(
+					(step == SPEED_CONTROL_TABLE_MAX_STEPS) ? SWITCH_RELEASED : SWITCH_PRE_PRESSED,
+					SWITCH_RELEASED, SWITCH_RELEASED, 0, speed);
+			}
+		}
+	}
+	SpeedControl_Table_Ready = 1;
+}
+
+/**
+ *  \brief 	This function calculates the new speed by the tables.
+ *  \param [in] IncSwitch The state of "+ve" switch.
+ *  \param [in] DecSwitch The state of "-ve" switch.
+ *  \param [in] PSwitch The state of "P" switch.
+ *  \param [in] PDuration The pressing duration of "P" switch.
+ *  \param [in] MotorSpeed The current motor speed.
+ *  \return The new calculated speed.
+ */
+int SpeedControl_TableCalcSpeed(Switches_States_t IncSwitch, Switches_States_t DecSwitch,
+	Switches_States_t PSwitch, int PDuration, int MotorSpeed)
+{
+	/* Needed variables */
+	unsigned int duration;
+	int retSpeed;
+
+	/* Function Logic */
+	if (SpeedControl_Table_Ready && (unsigned int)(MotorSpeed - MOTOR_MINIMUM_SPEED) < SPEED_CONTROL_TABLE_SPEEDS &&
+		(unsigned int)IncSwitch < SPEED_CONTROL_TABLE_STATES && (unsigned int)DecSwitch < SPEED_CONTROL_TABLE_STATES &&
+		(unsigned int)PSwitch < SPEED_CONTROL_TABLE_STATES)
+	{
+		duration = (PDuration < SPEED_CONTROL_P_STEP_DURATION) ? 0u :
+			(unsigned int)(PDuration / SPEED_CONTROL_P_STEP_DURATION);
+		if (duration > SPEED_CONTROL_TABLE_MAX_STEPS)
+		{
+			duration = SPEED_CONTROL_TABLE_MAX_STEPS;
+		}
+		retSpeed = SpeedControl_Table_Speeds[SpeedControl_Table_Steps[IncSwitch][DecSwitch][PSwitch][duration]]
+			[MotorSpeed - MOTOR_MINIMUM_SPEED];
+	}
+	else
+	{
+		retSpeed = SpeedControl_CalcSpeed(IncSwitch, DecSwitch, PSwitch, PDuration, MotorSpeed);
+	}
+
+	return retSpeed;
+}
+
+/**
+ *  \brief 	This function compares the tables with the rules.
+ *  \return The number of inputs whose new speeds are different.
+ *  
+ *  \details The durations are 0, -1, the boundaries of int and one less,
+ *  		 equal and one more than the duration of every bucket.
+ */
+unsigned long SpeedControl_TableCheck(void)
+{
+	/* Needed variables */
+	int durations[3 * (SPEED_CONTROL_TABLE_DURATIONS + 1) + 3];
+	unsigned int durationsCount = 0;
+	unsigned long retMismatches = 0;
+	Switches_States_t inc;
+	Switches_States_t dec;
+	Switches_States_t p;
+	unsigned int index;
+	int speed;
+
+	/* Function Logic */
+	durations[durationsCount++] = INT_MIN;
+	durations[durationsCount++] = -1;
+	durations[durationsCount++] = INT_MAX;
+	for (index = 0; index <= SPEED_CONTROL_TABLE_DURATIONS; index++)
+	{
+		durations[durationsCount++] = (int)index * SPEED_CONTROL_P_STEP_DURATION - 1;
+		durations[durationsCount++] = (int)index * SPEED_CONTROL_P_STEP_DURATION;
+		durations[durationsCount++] = (int)index * SPEED_CONTROL_P_STEP_DURATION + 1;
+	}
+
+	for (inc = SWITCH_ERROR; inc < SPEED_CONTROL_TABLE_STATES; inc++)
+	{
+		for (dec = SWITCH_ERROR; dec < SPEED_CONTROL_TABLE_STATES; dec++)
+		{
+			for (p = SWITCH_ERROR; p < SPEED_CONTROL_TABLE_STATES; p++)
+			{
+				for (index = 0; index < durationsCount; index++)
+				{
+					for (speed = MOTOR_MINIMUM_SPEED - 1; speed <= MOTOR_MAXIMUM_SPEED + 1; speed++)
+					{
+						retMismatches += (SpeedControl_TableCalcSpeed(inc, dec, p, durations[index], speed) !=
+							SpeedControl_CalcSpeed(inc, dec, p, durations[index], speed));
+					}
+				}
+			}
+		}
+	}
+
+	return retMismatches;
+}
@@ -4,10 +4,37 @@
  *  \author Ahmed Wageh.
  *  \details This module controls the speed of the motor depends 
  *  		 on the states of switches and the pressing duration
- *  		 of "P" switch.
+ *  		 of "P" switch. If SPEED_CONTROL_TABLE_ENABLED is defined as
+ *  		 in Fleet target, \ref SpeedControl_CalcNewSpeed and
+ *  		 \ref SpeedControl_ContextCalcNewSpeed calculate the new speed
+ *  		 by \ref SpeedControl_TableCalcSpeed.
  */
 #ifndef SPEED_CONTROL_H_
 #define SPEED_CONTROL_H_
+/* Inclusion */
+#include "../Switches/Switches.h"
+#include "../Motor/Motor.h"
+
+/* Macros */
+/** The pressing duration of "P" switch for every speed step down */
+#define SPEED_CONTROL_P_STEP_DURATION	30000
+
+/* User-defined data types */
+/**
+ *  This struct is the change of the motor speed over some ticks. The
+ *  motor speed s becomes min(max(s + Offset, Low), High), so the change
+ *  of two runs of ticks one after the other has the same form.
+ */
+struct SpeedControl_Transfer_t
+{
+	/** The step of the speed before it's limited */
+	int Offset;
+	/** The lowest speed after the ticks */
+	int Low;
+	/** The highest speed after the ticks */
+	int High;
+};
+typedef struct SpeedControl_Transfer_t SpeedControl_Transfer_t;
 
 /* Functions proto type */
 /**
@@ -16,6 +43,201 @@
  *  		states.
  *  \param	None.
  *  \return The new calculated speed.
+ *
+ *  \details The switches states are read from \ref Switches_Snapshot.
  */
 int SpeedControl_CalcNewSpeed(void);
+
+/**
+ *  \brief 	This function calculates the new speed from the readings
+ *  		of the switches at one tick and the motor speed.
+ *  \param [in] Snapshot The \ref Switches_Snapshot_t of the switches.
+ *  \param [in] MotorSpeed The current motor speed.
+ *  \return The new calculated speed.
+ */
+int SpeedControl_CalcSnapshotSpeed(const Switches_Snapshot_t * Snapshot, int MotorSpeed);
+
+/**
+ *  \brief 	This function calculates the target new speed of one
+ *  		device depend on its switches states.
+ *  \param [in] Switches The \ref Switches_Context_t of the device.
+ *  \param [in] Motor The \ref Motor_Context_t of the device.
+ *  \return The new calculated speed.
+ */
+int SpeedControl_ContextCalcNewSpeed(const Switches_Context_t * Switches, const Motor_Context_t * Motor);
+
+/**
+ *  \brief 	This function calculates the new speed from given
+ *  		switches states and motor speed.
+ *  \param [in] IncSwitch The state of "+ve" switch.
+ *  \param [in] DecSwitch The state of "-ve" switch.
+ *  \param [in] PSwitch The state of "P" switch.
+ *  \param [in] PDuration The pressing duration of "P" switch.
+ *  \param [in] MotorSpeed The current motor speed.
+ *  \return The new calculated speed.
+ *  
+ *  \details It doesn't read the switches or the motor, so it gives
+ *  		 the same result for the same inputs. A "P" press steps the
+ *  		 speed down once for every #SPEED_CONTROL_P_STEP_DURATION
+ *  		 while the speed isn't less than #MOTOR_MINIMUM_SPEED, so the
+ *  		 last step could make it #MOTOR_MINIMUM_SPEED - 1.
+ */
+int SpeedControl_CalcSpeed(Switches_States_t IncSwitch, Switches_States_t DecSwitch,
+	Switches_States_t PSwitch, int PDuration, int MotorSpeed);
+
+/**
+ *  \brief 	This function calculates the new speeds of many devices.
+ *  \param [in] IncSwitch The states of "+ve" switch of every device.
+ *  \param [in] DecSwitch The states of "-ve" switch of every device.
+ *  \param [in] PSwitch The states of "P" switch of every device.
+ *  \param [in] PDuration The pressing durations of "P" switch of every device.
+ *  \param [in] MotorSpeed The current motor speeds of every device.
+ *  \param [out] NewSpeed The new calculated speeds of every device.
+ *  \param [in] Count The number of devices.
+ *  \return None.
+ *  
+ *  \details NewSpeed[i] is the same as \ref SpeedControl_CalcSpeed of the
+ *  		 device i. The arrays must not overlap \p NewSpeed. The rules are
+ *  		 done without branches, so many devices are calculated at once
+ *  		 with SSE2 or AVX2 on x86 with GCC.
+ */
+void SpeedControl_CalcSpeedBatch(const Switches_States_t * IncSwitch, const Switches_States_t * DecSwitch,
+	const Switches_States_t * PSwitch, const int * PDuration, const int * MotorSpeed,
+	int * NewSpeed, unsigned int Count);
+
+/**
+ *  \brief 	This function calculates the motor speed after many ticks
+ *  		of the same switches states.
+ *  \param [in] IncSwitch The state of "+ve" switch.
+ *  \param [in] DecSwitch The state of "-ve" switch.
+ *  \param [in] PSwitch The state of "P" switch.
+ *  \param [in] PDuration The pressing duration of "P" switch.
+ *  \param [in] MotorSpeed The current motor speed, it's between
+ *  			#MOTOR_MINIMUM_SPEED and #MOTOR_MAXIMUM_SPEED as the
+ *  			motor keeps it.
+ *  \param [in] Ticks The number of ticks.
+ *  \return The motor speed after \p Ticks ticks.
+ *  
+ *  \details It's the same as calling \ref SpeedControl_CalcSpeed and
+ *  		 limiting the speed as the motor does \p Ticks times, but
+ *  		 it's calculated at once. The speed changes by the same step
+ *  		 every tick until it's limited.
+ */
+int SpeedControl_CalcSpeedRun(Switches_States_t IncSwitch, Switches_States_t DecSwitch,
+	Switches_States_t PSwitch, int PDuration, int MotorSpeed, unsigned int Ticks);
+/**
+ *  \brief 	This function replays all lines of one device by runs.
+ *  \param [in] Switches The \ref Switches_Context_t of the device, it
+ *  			has the last read states at the end.
+ *  \param [in] Motor The \ref Motor_Context_t of the device, it has the
+ *  			last speed at the end.
+ *  \param [out] Skipped The number of ticks that are written as a
+ *  			repeat of the limited speed.
+ *  \return The number of replayed lines.
+ *  
+ *  \details The output is the same as calling \ref Switches_ContextUpdateState,
+ *  		 \ref SpeedControl_ContextCalcNewSpeed and \ref Motor_ContextUpdateSpeed
+ *  		 for every line. The consecutive lines which change the speed
+ *  		 by the same step are one run, like the same line repeated or
+ *  		 released switches with any duration. The speeds of a run are
+ *  		 calculated as \ref SpeedControl_CalcSpeedRun and the ticks after
+ *  		 the speed is limited are written by \ref Motor_ContextRepeatSpeed.
+ *  		 A run is written when the next run starts, so a flush policy
+ *  		 by time is applied later than the line is read.
+ */
+unsigned long long SpeedControl_ContextReplay(Switches_Context_t * Switches, Motor_Context_t * Motor,
+	unsigned long long * Skipped);
+
+/**
+ *  \brief 	This function initializes the change of the motor speed
+ *  		over no ticks.
+ *  \param [out] Transfer The \ref SpeedControl_Transfer_t which keeps
+ *  			every speed.
+ *  \return None.
+ */
+void SpeedControl_TransferInit(SpeedControl_Transfer_t * Transfer);
+
+/**
+ *  \brief 	This function calculates the change of the motor speed in
+ *  		one tick.
+ *  \param [in] IncSwitch The state of "+ve" switch.
+ *  \param [in] DecSwitch The state of "-ve" switch.
+ *  \param [in] PSwitch The state of "P" switch.
+ *  \param [in] PDuration The pressing duration of "P" switch.
+ *  \param [out] Transfer The \ref SpeedControl_Transfer_t of the tick.
+ *  \return None.
+ *  
+ *  \details Applying \p Transfer to a speed between #MOTOR_MINIMUM_SPEED
+ *  		 and #MOTOR_MAXIMUM_SPEED is the same as \ref SpeedControl_CalcSpeed
+ *  		 and limiting the speed as the motor does.
+ */
+void SpeedControl_CalcTransfer(Switches_States_t IncSwitch, Switches_States_t DecSwitch,
+	Switches_States_t PSwitch, int PDuration, SpeedControl_Transfer_t * Transfer);
+
+/**
+ *  \brief 	This function appends the ticks of a change of the motor
+ *  		speed to another change.
+ *  \param [in,out] Transfer The \ref SpeedControl_Transfer_t of the first
+ *  			ticks, it becomes the change over all ticks.
+ *  \param [in] Next The \ref SpeedControl_Transfer_t of the ticks after them.
+ *  \return None.
+ *  
+ *  \details The changes of any ticks are appended in order in any groups,
+ *  		 so the changes of the chunks of a file are calculated in
+ *  		 parallel and only they are appended one after the other.
+ *  		 \p Offset is kept between the limits, so any number of ticks
+ *  		 are appended without overflow.
+ */
+void SpeedControl_TransferAppend(SpeedControl_Transfer_t * Transfer, const SpeedControl_Transfer_t * Next);
+
+/**
+ *  \brief 	This function applies a change of the motor speed.
+ *  \param [in] Transfer The \ref SpeedControl_Transfer_t of the ticks.
+ *  \param [in] MotorSpeed The speed before the ticks, it's between
+ *  			#MOTOR_MINIMUM_SPEED and #MOTOR_MAXIMUM_SPEED as the
+ *  			motor keeps it.
+ *  \return The motor speed after the ticks.
+ */
+int SpeedControl_TransferApply(const SpeedControl_Transfer_t * Transfer, int MotorSpeed);
+
+/**
+ *  \brief 	This function generates the tables of the new speed.
+ *  \param	None.
+ *  \return None.
+ *  
+ *  \details The tables are generated from \ref SpeedControl_CalcSpeed.
+ *  		 It must be called before the threads that calculate the
+ *  		 speeds are started.
+ */
+void SpeedControl_TableInit(void);
+
+/**
+ *  \brief 	This function calculates the new speed by the tables.
+ *  \param [in] IncSwitch The state of "+ve" switch.
+ *  \param [in] DecSwitch The state of "-ve" switch.
+ *  \param [in] PSwitch The state of "P" switch.
+ *  \param [in] PDuration The pressing duration of "P" switch.
+ *  \param [in] MotorSpeed The current motor speed.
+ *  \return The new calculated speed.
+ *  
+ *  \details It's the same as \ref SpeedControl_CalcSpeed. The step of the
+ *  		 switches states and the "P" duration bucket of every 30 seconds
+ *  		 is loaded, then the new speed of the step and \p MotorSpeed.
+ *  		 A speed out of the motor limits or tables which aren't generated
+ *  		 by \ref SpeedControl_TableInit use \ref SpeedControl_CalcSpeed.
+ */
+int SpeedControl_TableCalcSpeed(Switches_States_t IncSwitch, Switches_States_t DecSwitch,
+	Switches_States_t PSwitch, int PDuration, int MotorSpeed);
+
+/**
+ *  \brief 	This function compares the tables with the rules.
+ *  \param	None.
+ *  \return The number of inputs whose \ref SpeedControl_TableCalcSpeed is
+ *  		 different from \ref SpeedControl_CalcSpeed, 0 if the tables are right.
+ *  
+ *  \details It checks every switches states, every speed from one below
+ *  		 the minimum to one above the maximum and the durations around
+ *  		 the boundary of every bucket.
+ */
+unsigned long SpeedControl_TableCheck(void);
 #endif // !SPEED_CONTROL_H_
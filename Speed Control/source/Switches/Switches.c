@@ -12,14 +12,15 @@
 #include "../Parse/Parse.h"
 
 /* Private variables */
-/** The state of "+ve" switch, initially it's released */
-static Switches_States_t Switch_Inc = SWITCH_RELEASED;
-/** The state of "-ve" switch, initially it's released */
-static Switches_States_t Switch_Dec = SWITCH_RELEASED;
-/** The state of "P" switch, initially it's released */
-static Switches_States_t Switch_P = SWITCH_RELEASED;
-/** The pressing duration "p" switch, initially it's zero */
-static int Switch_P_Duration = 0;
+/** The switches of the default device, initially they are released
+ *  and it reads the input file prepared by \ref Switches_Init */
+static Switches_Context_t Switches_Default_Context =
+{
+	{SWITCH_RELEASED, SWITCH_RELEASED, SWITCH_RELEASED, 0}, NULL
+};
+
+/* Public variables */
+const Switches_Snapshot_t * Switches_Snapshot = &Switches_Default_Context.Snapshot;
 
 /* Private functions prototype */
 /**
@@ -28,43 +29,24 @@ static int Switch_P_Duration = 0;
  *  		text line.
  *
  *  \param [in] Input_Line input text line to be parsed
- *  \param [out] Inc_Switch the \ref Switches_States_t of "+ve" switch
- *  \param [out] Dec_Switch the \ref Switches_States_t of "-ve" switch
- *  \param [out] P_Switch the \ref Switches_States_t of "P" switch
- *  \param [out] P_Duaration The duration of "P" switch
+ *  \param [in] Length the number of characters in \p Input_Line
+ *  \param [out] Context the \ref Switches_Context_t that gets the states
  *  \return None
  *
- *  \details It parsed the input text line and assign the result to
- *  		 out parameter: \p Inc_Switch, \p Dec_Switch, \p P_Switch
- *  		 and \p P_Duaration.
- */
-static void Switches_GetSwitchesState(char * Input_Line, Switches_States_t * Inc_Switch,
-	Switches_States_t * Dec_Switch, Switches_States_t * P_Switch,
-	int * P_Duaration);
-
-/**
- *  \brief	The real function for getting the state from a
- *  		switch with \ref Switches_IDs_t = \p ID.
- *  
- *  \param ID :	The \ref Switches_IDs_t of switch you need to 
- *  			get state.
- *
- *  \return \ref Switches_States_t type data
+ *  \details It parsed the input text line in one pass and assign the
+ *  		 result to the switches of \p Context.
  */
-Switches_States_t Switches_GetSwitchState_real(Switches_IDs_t ID);
+static void Switches_GetSwitchesState(const char * Input_Line, unsigned int Length,
+	Switches_Context_t * Context);
 
 /**
- *  \brief  The real getting function of pressing duration of
- *  		"P" switch that gets the real duration from input
- *  		text file.
+ *  \brief	Assigns a decoded line to the switches of a device.
  *
- *  \return pressing duration
+ *  \param [in] Record the decoded line.
+ *  \param [out] Context the \ref Switches_Context_t that gets the states
+ *  \return None
  */
-int Switches_GetPDuration_real(void);
-
-Switches_States_t (*Switches_GetState)(Switches_IDs_t ID);
-int (*Switches_GetPDuration)(void);
-
+static void Switches_SetSwitchesState(const Parse_Record_t * Record, Switches_Context_t * Context);
 
 /* Functions definition */
 /* Private functions */
@@ -74,117 +56,209 @@ int (*Switches_GetPDuration)(void);
  *  		text line.
  *
  *  \param [in] Input_Line input text line to be parsed
- *  \param [out] Inc_Switch the \ref Switches_States_t of "+ve" switch
- *  \param [out] Dec_Switch the \ref Switches_States_t of "-ve" switch
- *  \param [out] P_Switch the \ref Switches_States_t of "P" switch
- *  \param [out] P_Duaration The duration of "P" switch
+ *  \param [in] Length the number of characters in \p Input_Line
+ *  \param [out] Context the \ref Switches_Context_t that gets the states
  *  \return None
  *
- *  \details It parsed the input text line and assign the result to
- *  		 out parameter: \p Inc_Switch, \p Dec_Switch, \p P_Switch
- *  		 and \p P_Duaration.
+ *  \details It parsed the input text line in one pass and assign the
+ *  		 result to the switches of \p Context.
  */
-static void Switches_GetSwitchesState(char * Input_Line, Switches_States_t * Inc_Switch,
-	Switches_States_t * Dec_Switch, Switches_States_t * P_Switch,
-	int * P_Duaration)
+static void Switches_GetSwitchesState(const char * Input_Line, unsigned int Length,
+	Switches_Context_t * Context)
 {
-	*Inc_Switch = ParseIncSwitch(Input_Line);
-	*Dec_Switch = ParseDecSwitch(Input_Line);
-	*P_Switch = ParsePSwitch(Input_Line);
-	*P_Duaration = ParsePDuaration(Input_Line);
+	Parse_Record_t record;
+
+	ParseRecord(Input_Line, Length, &record);
+	Switches_SetSwitchesState(&record, Context);
 }
 
 /**
- *  \brief	The real function for getting the state from a
- *  		switch with \ref Switches_IDs_t = \p ID.
- *  
- *  \param ID :	The \ref Switches_IDs_t of switch you need to 
- *  			get state.
+ *  \brief	Assigns a decoded line to the switches of a device.
  *
- *  \return \ref Switches_States_t type data
+ *  \param [in] Record the decoded line.
+ *  \param [out] Context the \ref Switches_Context_t that gets the states
+ *  \return None
  */
-Switches_States_t Switches_GetSwitchState_real(Switches_IDs_t ID)
+static void Switches_SetSwitchesState(const Parse_Record_t * Record, Switches_Context_t * Context)
 {
-	Switches_States_t retData = SWITCH_RELEASED;
-
-	switch(ID)
-	{
-		case SWITCH_INCREMENT:
-			retData = Switch_Inc;
-		break;
+	Context->Snapshot.Inc_Switch = Record->Inc_Switch;
+	Context->Snapshot.Dec_Switch = Record->Dec_Switch;
+	Context->Snapshot.P_Switch = Record->P_Switch;
+	Context->Snapshot.P_Duration = Record->P_Duration;
+}
 
-		case SWITCH_DECREMENT:
-			retData = Switch_Dec;
-		break;
+/* Public functions */
+/**
+ *  \brief This function for initializing all used switches.
+ *
+ *  \param	None.
+ *  \return #SWITCH_UPDATE_ERROR if the input file can't be opened or read.
+ *
+ *  \details This functions prepares the input file to be ready
+ *  		 for reading process, the readings of the input text file
+ *  		 are got from \ref Switches_Snapshot. The input file is
+ *  		 read in #SWITCH_INPUT_MODE_MAPPED mode.
+ */
+Switches_UpdateState_t Switches_Init(void)
+{
+	return Switches_InitMode(SWITCH_INPUT_MODE_MAPPED);
+}
 
-		case SWITCH_P:
-			retData = Switch_P;
-		break;
+/**
+ *  \brief This function for initializing all used switches with a
+ *  		selected input mode.
+ *
+ *  \param [in] Mode The \ref Switches_InputMode_t of the input file.
+ *  \return #SWITCH_UPDATE_ERROR if the input file can't be opened or read.
+ */
+Switches_UpdateState_t Switches_InitMode(Switches_InputMode_t Mode)
+{
+	/* Needed variables */
+	Switches_UpdateState_t retState = SWITCH_UPDATE_OK;
 
-		default:;
-			/* Error */
+	/* Function Logic */
+	if (File_PrepareInputFileMode((Mode == SWITCH_INPUT_MODE_MAPPED) ?
+		FILE_IF_INPUT_MODE_MAPPED : FILE_IF_INPUT_MODE_STREAM) != FILE_IF_ERROR_OK)
+	{
+		retState = SWITCH_UPDATE_ERROR;
 	}
 
-	return retData;
+	return retState;
 }
 
 /**
- *  \brief  The real getting function of pressing duration of
- *  		"P" switch that gets the real duration from input
- *  		text file.
+ *  \brief This function updates the redings of all used switches.
+ *
+ *  \return \ref Switches_UpdateState_t type data
  *
- *  \return pressing duration
+ *  \details This function reads the next line of the input text file
+ *  		 once and afterthat you can get the \ref Switches_States_t of
+ *  		 all switches and the duration of the pressing on "P" switch
+ *  		 from \ref Switches_Snapshot.
  */
-int Switches_GetPDuration_real(void)
+Switches_UpdateState_t Switches_UpdateState(void)
 {
-	return Switch_P_Duration;
+	return Switches_ContextUpdateState(&Switches_Default_Context);
 }
 
-/* Public functions */
 /**
- *  \brief This function for initializing all used switches.
- *
- *  \param	None.
+ *  \brief This function initializes the switches of one device.
+ *  
+ *  \param [out] Context The \ref Switches_Context_t of the device.
+ *  \param [in] Reader The opened reader of the device input text file.
  *  \return None.
- *
- *  \details This functions prepares the input file to be ready
- *  		 for reading process, setting \ref Switches_GetState,
- *  		 and \ref Switches_GetPDuration to the real functions 
- *  		 that reads the data from input text file.
  */
-void Switches_Init(void)
+void Switches_ContextInit(Switches_Context_t * Context, struct FileIf_Reader_t * Reader)
 {
-	File_PrepareInputFile();
-	Switches_GetState = Switches_GetSwitchState_real;
-	Switches_GetPDuration = Switches_GetPDuration_real;
+	Context->Snapshot.Inc_Switch = SWITCH_RELEASED;
+	Context->Snapshot.Dec_Switch = SWITCH_RELEASED;
+	Context->Snapshot.P_Switch = SWITCH_RELEASED;
+	Context->Snapshot.P_Duration = 0;
+	Context->Reader = Reader;
 }
 
 /**
- *  \brief This function updates the redings of all used switches.
- *
+ *  \brief This function updates the readings of the switches of one device.
+ *  
+ *  \param [in] Context The \ref Switches_Context_t of the device.
  *  \return \ref Switches_UpdateState_t type data
- *
- *  \details This function get the reading of the switches from its
- *  		 assigned getter(real or fake getter) and afterthat you
- *  		 can get the \ref Switches_States_t from \ref Switches_GetState and
- *  		 get the duration of the pressing on "P" switch from
- *  		 \ref Switches_GetPDuration.
+ *  
+ *  \details It reads the next line of \p Context reader or of the input
+ *  		 file prepared by \ref Switches_Init if it has no reader. A binary
+ *  		 trace input is read by records without the parser.
  */
-Switches_UpdateState_t Switches_UpdateState(void)
+Switches_UpdateState_t Switches_ContextUpdateState(Switches_Context_t * Context)
 {
 	/* Needed variables */
-	char txt[84];
+	const char * txt;
+	unsigned int length;
+	Parse_Record_t record;
+	FileIf_InputFormat_t format;
+	FileIf_Error_t readError;
 	Switches_UpdateState_t retState = SWITCH_UPDATE_OK;
 
 	/* Function logic */
-	if (File_ReadLine(txt) == FILE_IF_ERROR_OK)
+	format = (Context->Reader == NULL) ? File_GetInputFormat() : Context->Reader->Format;
+	if (format == FILE_IF_INPUT_FORMAT_TRACE)	/* The record is decoded without parsing */
 	{
-		Switches_GetSwitchesState(txt, &Switch_Inc, &Switch_Dec, &Switch_P, &Switch_P_Duration);
+		if (Context->Reader == NULL)
+		{
+			readError = File_ReadRecord(&record);
+		}
+		else
+		{
+			readError = File_ReaderNextRecord(Context->Reader, &record);
+		}
+
+		if (readError == FILE_IF_ERROR_OK)
+		{
+			Switches_SetSwitchesState(&record, Context);
+		}
 	}
 	else
+	{
+		if (Context->Reader == NULL)
+		{
+			readError = File_ReadLineView(&txt, &length);
+		}
+		else
+		{
+			readError = File_ReaderNextLine(Context->Reader, &txt, &length);
+		}
+
+		if (readError == FILE_IF_ERROR_OK)	/* Parse the line in place */
+		{
+			Switches_GetSwitchesState(txt, length, Context);
+		}
+	}
+
+	if (readError != FILE_IF_ERROR_OK)
 	{
 		retState = SWITCH_UPDATE_ERROR;
 	}
 
 	return retState;
 }
+
+/**
+ *  \brief For getting the \ref Switches_States_t of any switch of one device.
+ *  
+ *  \param [in] Context The \ref Switches_Context_t of the device.
+ *  \param [in] ID The \ref Switches_IDs_t of the needed switch.
+ *  \return \ref Switches_States_t type data.
+ */
+Switches_States_t Switches_ContextGetState(const Switches_Context_t * Context, Switches_IDs_t ID)
+{
+	Switches_States_t retData = SWITCH_RELEASED;
+
+	switch(ID)
+	{
+		case SWITCH_INCREMENT:
+			retData = Context->Snapshot.Inc_Switch;
+		break;
+
+		case SWITCH_DECREMENT:
+			retData = Context->Snapshot.Dec_Switch;
+		break;
+
+		case SWITCH_P:
+			retData = Context->Snapshot.P_Switch;
+		break;
+
+		default:;
+			/* Error */
+	}
+
+	return retData;
+}
+
+/**
+ *  \brief For getting the pressing duration of "P" switch of one device.
+ *  
+ *  \param [in] Context The \ref Switches_Context_t of the device.
+ *  \return integer type data represents the duration of pressing.
+ */
+int Switches_ContextGetPDuration(const Switches_Context_t * Context)
+{
+	return Context->Snapshot.P_Duration;
+}
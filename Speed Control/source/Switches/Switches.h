@@ -68,54 +68,135 @@ enum Switches_UpdateState_t
 };
 typedef enum Switches_UpdateState_t Switches_UpdateState_t;
 
+/**
+ *  This enum is for the ways of reading the input text file.
+ */
+enum Switches_InputMode_t
+{
+	/** The input file is read in blocks, it works with pipes */
+	SWITCH_INPUT_MODE_STREAM = 0,
+	/** The input file is memory-mapped and parsed in place, it falls
+	 *  back to #SWITCH_INPUT_MODE_STREAM if it can't be mapped */
+	SWITCH_INPUT_MODE_MAPPED = 1
+};
+typedef enum Switches_InputMode_t Switches_InputMode_t;
+
+/* The reader object of File Interface module */
+struct FileIf_Reader_t;
+
+/**
+ *  This struct holds the readings of all switches at one tick.
+ */
+struct Switches_Snapshot_t
+{
+	/** The state of "+ve" switch */
+	Switches_States_t Inc_Switch;
+	/** The state of "-ve" switch */
+	Switches_States_t Dec_Switch;
+	/** The state of "P" switch */
+	Switches_States_t P_Switch;
+	/** The pressing duration of "P" switch */
+	int P_Duration;
+};
+typedef struct Switches_Snapshot_t Switches_Snapshot_t;
+
+/**
+ *  This struct holds the switches of one device.
+ */
+struct Switches_Context_t
+{
+	/** The readings of the switches, filled by \ref Switches_ContextUpdateState */
+	Switches_Snapshot_t Snapshot;
+	/** The reader of the input text file, NULL for the input file
+	 *  prepared by \ref Switches_Init */
+	struct FileIf_Reader_t * Reader;
+};
+typedef struct Switches_Context_t Switches_Context_t;
+
 /* Fyunctions proto-type */
 /**
  *  \brief This function for initializing all used switches.
  *  
  *  \param	None.
- *  \return None.
+ *  \return #SWITCH_UPDATE_ERROR if the input file can't be opened or read.
  *  
  *  \details This functions prepares the input file to be ready 
- *  		 for reading process, setting \ref Switches_GetIncrementSwitchState,
- *  		 \ref Switches_GetDecrementSwitchState, \ref Switches_GetPSwitchState,
- *  		 and \ref Switches_GetPDuration to the real functions that reads the data 
- *  		 from input text file.
+ *  		 for reading process, the readings of the input text file
+ *  		 are got from \ref Switches_Snapshot. The input file is read in
+ *  		 #SWITCH_INPUT_MODE_MAPPED mode.
  */
-void Switches_Init(void);
+Switches_UpdateState_t Switches_Init(void);
+
+/**
+ *  \brief This function for initializing all used switches with a
+ *  		selected input mode.
+ *
+ *  \param [in] Mode The \ref Switches_InputMode_t of the input file.
+ *  \return #SWITCH_UPDATE_ERROR if the input file can't be opened or read.
+ *
+ *  \details It's the same as \ref Switches_Init but it selects how
+ *  		 the input text file is read.
+ */
+Switches_UpdateState_t Switches_InitMode(Switches_InputMode_t Mode);
 
 /**
  *  \brief This function updates the redings of all used switches.
  *  
  *  \return \ref Switches_UpdateState_t type data
  *  
- *  \details This function get the reading of the switches from its
- *  		 assigned getter(real or fake getter) and afterthat you
- *  		 can get the \ref Switches_States_t from \ref Switches_GetIncrementSwitchState,
- *  		 \ref Switches_GetDecrementSwitchState, and ref Switches_GetPSwitchState or 
- *  		 get the duration of the pressing on "P" switch from 
- *  		 \ref Switches_GetPDuration.  		 
+ *  \details This function reads the next line of the input text file
+ *  		 once and afterthat you can get the \ref Switches_States_t of
+ *  		 all switches and the duration of the pressing on "P" switch
+ *  		 from \ref Switches_Snapshot.
  */
 Switches_UpdateState_t Switches_UpdateState(void);
 
 /**
- *  \brief For getting the \ref Switches_States_t of any switch.
+ *  \brief The readings of all switches at the current tick.
+ *
+ *  \details It points to the readings filled by \ref Switches_UpdateState,
+ *  		 they are read by plain loads. Test code can point it to any
+ *  		 \ref Switches_Snapshot_t, for example by the fake switch module.
+ */
+extern const Switches_Snapshot_t * Switches_Snapshot;
+
+/**
+ *  \brief This function initializes the switches of one device.
  *  
- *  \param ID : The \ref Switches_IDs_t of the needed switch 
- *  			to get \ref Switches_States_t.
- *  \return \ref Switches_States_t type data.
+ *  \param [out] Context The \ref Switches_Context_t of the device.
+ *  \param [in] Reader The opened reader of the device input text file.
+ *  \return None.
  *  
- *  \details It must be called after \ref Switches_UpdateState function.
+ *  \details All switches are released and the duration is 0.
  */
-extern Switches_States_t (*Switches_GetState)(Switches_IDs_t ID);
+void Switches_ContextInit(Switches_Context_t * Context, struct FileIf_Reader_t * Reader);
 
 /**
- *  \brief For getting the pressing duration of "P" switch.
+ *  \brief This function updates the readings of the switches of one device.
  *  
- *  \param None.
- *  \return integer type data represents the duration of pressing.
+ *  \param [in] Context The \ref Switches_Context_t of the device.
+ *  \return \ref Switches_UpdateState_t type data
+ *  
+ *  \details It reads the next line of the device input text file. It
+ *  		 returns #SWITCH_UPDATE_ERROR at the end of the file.
+ */
+Switches_UpdateState_t Switches_ContextUpdateState(Switches_Context_t * Context);
+
+/**
+ *  \brief For getting the \ref Switches_States_t of any switch of one device.
  *  
- *  \details It must be called after \ref Switches_UpdateState function.
+ *  \param [in] Context The \ref Switches_Context_t of the device.
+ *  \param [in] ID The \ref Switches_IDs_t of the needed switch.
+ *  \return \ref Switches_States_t type data.
+ */
+Switches_States_t Switches_ContextGetState(const Switches_Context_t * Context, Switches_IDs_t ID);
+
+/**
+ *  \brief For getting the pressing duration of "P" switch of one device.
+ *  
+ *  \param [in] Context The \ref Switches_Context_t of the device.
+ *  \return integer type data represents the duration of pressing.
  */
-extern int (*Switches_GetPDuration)(void);
+int Switches_ContextGetPDuration(const Switches_Context_t * Context);
 
 #endif // !SWITCHES_H_
@@ -0,0 +1,284 @@
+/**
+ *  \file	Trace.c
+ *  \brief	This file is the implementation of the binary trace
+ *  		format of the input.
+ *  \author Ahmed Wageh.
+ */
+/* Inclusion */
+#include <string.h>
+#include "Trace.h"
+
+/* Macros */
+/** The record has an error byte */
+#define TRACE_FLAG_ERROR		0x40u
+/** The record has a duration */
+#define TRACE_FLAG_DURATION		0x80u
+/** The bits of the error byte */
+#define TRACE_ERROR_BITS		0x07u
+
+/* Private functions prototype */
+/**
+ *  \brief Encodes the state of one switch.
+ *
+ *  \param [in] State The \ref Switches_States_t of the switch.
+ *  \param [in] Shift The position of the switch bits in the first byte.
+ *  \param [in,out] Data The first byte of the record.
+ *  \param [in,out] Errors The error byte of the record.
+ */
+static void Trace_EncodeState(Switches_States_t State, unsigned int Shift,
+	unsigned char * Data, unsigned char * Errors);
+
+/**
+ *  \brief Decodes the state of one switch.
+ *
+ *  \param [in] Data The first byte of the record.
+ *  \param [in] Errors The error byte of the record.
+ *  \param [in] Shift The position of the switch bits in the first byte.
+ *  \return \ref Switches_States_t type data.
+ */
+static Switches_States_t Trace_DecodeState(unsigned char Data, unsigned char Errors, unsigned int Shift);
+
+/* Functions definition */
+/* Private functions */
+/**
+ *  \brief Encodes the state of one switch.
+ *
+ *  \param [in] State The \ref Switches_States_t of the switch.
+ *  \param [in] Shift The position of the switch bits in the first byte.
+ *  \param [in,out] Data The first byte of the record.
+ *  \param [in,out] Errors The error byte of the record.
+ *
+ *  \details The bit of the switch in the error byte is \p Shift / 2.
+ */
+static void Trace_EncodeState(Switches_States_t State, unsigned int Shift,
+	unsigned char * Data, unsigned char * Errors)
+{
+	if (State >= SWITCH_PRE_PRESSED && State <= SWITCH_PRE_RELEASED)
+	{
+		*Data |= (unsigned char)((State - SWITCH_PRE_PRESSED) << Shift);
+	}
+	else
+	{
+		*Errors |= (unsigned char)(1u << (Shift / 2u));
+	}
+}
+
+/**
+ *  \brief Decodes the state of one switch.
+ *
+ *  \param [in] Data The first byte of the record.
+ *  \param [in] Errors The error byte of the record.
+ *  \param [in] Shift The position of the switch bits in the first byte.
+ *  \return \ref Switches_States_t type data.
+ */
+static Switches_States_t Trace_DecodeState(unsigned char Data, unsigned char Errors, unsigned int Shift)
+{
+	return ((Errors >> (Shift / 2u)) & 1u) ? SWITCH_ERROR :
+		(Switches_States_t)(SWITCH_PRE_PRESSED + ((Data >> Shift) & 3u));
+}
+
+/* Public functions */
+/**
+ *  \brief This function writes the header of a trace file.
+ *
+ *  \param [out] Data At least #TRACE_HEADER_SIZE bytes.
+ *  \return The number of written bytes.
+ */
+unsigned int Trace_WriteHeader(unsigned char * Data)
+{
+	memcpy(Data, TRACE_MAGIC, TRACE_MAGIC_SIZE);
+	Data[TRACE_MAGIC_SIZE] = TRACE_VERSION;
+
+	return TRACE_HEADER_SIZE;
+}
+
+/**
+ *  \brief This function checks the header of a trace file.
+ *
+ *  \param [in] Data The first bytes of the file.
+ *  \param [in] Length The number of bytes of \p Data.
+ *  \return \ref Trace_Error_t type data.
+ */
+Trace_Error_t Trace_CheckHeader(const unsigned char * Data, unsigned int Length)
+{
+	/* Needed variables */
+	Trace_Error_t retError = TRACE_ERROR_OK;
+
+	/* Function Logic */
+	if (Length < TRACE_MAGIC_SIZE || memcmp(Data, TRACE_MAGIC, TRACE_MAGIC_SIZE) != 0)
+	{
+		retError = TRACE_ERROR_NOT_TRACE;
+	}
+	else if (Length < TRACE_HEADER_SIZE)
+	{
+		retError = TRACE_ERROR_TRUNCATED;
+	}
+	else if (Data[TRACE_MAGIC_SIZE] != TRACE_VERSION)
+	{
+		retError = TRACE_ERROR_VERSION;
+	}
+
+	return retError;
+}
+
+/**
+ *  \brief This function encodes one varint.
+ *
+ *  \param [in] Value The value to be encoded.
+ *  \param [out] Data At least #TRACE_VARINT_MAX_SIZE bytes.
+ *  \return The number of written bytes.
+ */
+unsigned int Trace_EncodeVarint(unsigned int Value, unsigned char * Data)
+{
+	/* Needed variables */
+	unsigned int retUsed = 0;
+
+	/* Function Logic */
+	while (Value >= 0x80u)
+	{
+		Data[retUsed++] = (unsigned char)(Value | 0x80u);
+		Value >>= 7;
+	}
+	Data[retUsed++] = (unsigned char)Value;
+
+	return retUsed;
+}
+
+/**
+ *  \brief This function decodes one varint.
+ *
+ *  \param [in] Data The encoded varint.
+ *  \param [in] Length The number of bytes of \p Data, it can be more
+ *  			than the varint.
+ *  \param [out] Value The decoded value.
+ *  \param [out] Used The number of bytes of the varint.
+ *  \return \ref Trace_Error_t type data.
+ */
+Trace_Error_t Trace_DecodeVarint(const unsigned char * Data, unsigned int Length,
+	unsigned int * Value, unsigned int * Used)
+{
+	/* Needed variables */
+	Trace_Error_t retError = TRACE_ERROR_OK;
+	unsigned int value = 0;
+	unsigned int shift = 0;
+	unsigned int used = 0;
+	int more;
+
+	/* Function Logic */
+	do
+	{
+		more = 0;
+		if (used == Length)
+		{
+			retError = TRACE_ERROR_TRUNCATED;
+		}
+		else if (used == TRACE_VARINT_MAX_SIZE - 1u && Data[used] > 0x0Fu)	/* More than 32 bits */
+		{
+			retError = TRACE_ERROR_CORRUPTED;
+		}
+		else
+		{
+			value |= (unsigned int)(Data[used] & 0x7Fu) << shift;
+			more = (Data[used] & 0x80u) != 0u;
+			shift += 7u;
+			used++;
+		}
+	}while (more);
+
+	*Value = value;
+	*Used = used;
+
+	return retError;
+}
+
+/**
+ *  \brief This function encodes one record.
+ *
+ *  \param [in] Record The parsed line.
+ *  \param [out] Data At least #TRACE_RECORD_MAX_SIZE bytes.
+ *  \return The number of written bytes.
+ */
+unsigned int Trace_EncodeRecord(const Parse_Record_t * Record, unsigned char * Data)
+{
+	/* Needed variables */
+	unsigned char errors = 0;
+	unsigned int retUsed = 1;
+
+	/* Function Logic */
+	Data[0] = 0;
+	Trace_EncodeState(Record->Inc_Switch, 0u, &Data[0], &errors);
+	Trace_EncodeState(Record->Dec_Switch, 2u, &Data[0], &errors);
+	Trace_EncodeState(Record->P_Switch, 4u, &Data[0], &errors);
+	if (errors != 0u)
+	{
+		Data[0] |= TRACE_FLAG_ERROR;
+		Data[retUsed++] = errors;
+	}
+
+	if (Record->P_Duration != 0)
+	{
+		Data[0] |= TRACE_FLAG_DURATION;
+		/* Zigzag keeps small negative durations short */
+		retUsed += Trace_EncodeVarint(((unsigned int)Record->P_Duration << 1) ^
+			(unsigned int)-(Record->P_Duration < 0), &Data[retUsed]);
+	}
+
+	return retUsed;
+}
+
+/**
+ *  \brief This function decodes one record.
+ *
+ *  \param [in] Data The encoded record.
+ *  \param [in] Length The number of bytes of \p Data, it can be more
+ *  			than the record.
+ *  \param [out] Record The decoded line.
+ *  \param [out] Used The number of bytes of the record.
+ *  \return \ref Trace_Error_t type data.
+ */
+Trace_Error_t Trace_DecodeRecord(const unsigned char * Data, unsigned int Length,
+	Parse_Record_t * Record, unsigned int * Used)
+{
+	/* Needed variables */
+	Trace_Error_t retError = TRACE_ERROR_OK;
+	unsigned char errors = 0;
+	unsigned int zigzag = 0;
+	unsigned int length;
+	unsigned int used = 1;
+
+	/* Function Logic */
+	if (Length == 0u)
+	{
+		retError = TRACE_ERROR_TRUNCATED;
+	}
+	else if (Data[0] & TRACE_FLAG_ERROR)
+	{
+		if (Length < 2u)
+		{
+			retError = TRACE_ERROR_TRUNCATED;
+		}
+		else
+		{
+			errors = Data[used++];
+			retError = (errors == 0u || (errors & ~TRACE_ERROR_BITS) != 0u) ?
+				TRACE_ERROR_CORRUPTED : TRACE_ERROR_OK;
+		}
+	}
+
+	if (retError == TRACE_ERROR_OK && (Data[0] & TRACE_FLAG_DURATION))
+	{
+		retError = Trace_DecodeVarint(&Data[used], Length - used, &zigzag, &length);
+		used += length;
+	}
+
+	if (retError == TRACE_ERROR_OK)
+	{
+		Record->Inc_Switch = Trace_DecodeState(Data[0], errors, 0u);
+		Record->Dec_Switch = Trace_DecodeState(Data[0], errors, 2u);
+		Record->P_Switch = Trace_DecodeState(Data[0], errors, 4u);
+		Record->P_Duration = (int)((zigzag >> 1) ^ (0u - (zigzag & 1u)));
+		*Used = used;
+	}
+
+	return retError;
+}
@@ -0,0 +1,129 @@
+/**
+ *  \file	Trace.h
+ *  \brief	This file handles the binary trace format of the input.
+ *  \author Ahmed Wageh.
+ *  \details	A trace file starts with #TRACE_MAGIC and the version
+ *  			byte #TRACE_VERSION. Every line of the input text file
+ *  			is one record:
+ *  			-	The first byte has 2 bits for every switch, "+ve" in
+ *  				bits 0-1, "-ve" in bits 2-3 and "P" in bits 4-5. They
+ *  				are the \ref Switches_States_t value minus
+ *  				#SWITCH_PRE_PRESSED.
+ *  			-	Bit 6 is set if one switch or more is #SWITCH_ERROR. Then
+ *  				an error byte follows with bit 0 for "+ve", bit 1 for
+ *  				"-ve" and bit 2 for "P", the 2 bits of these switches are 0.
+ *  			-	Bit 7 is set if the duration isn't 0. Then the duration
+ *  				follows as a zigzag varint, 7 bits in every byte with
+ *  				the least significant first and bit 7 set if more
+ *  				bytes follow.
+ */
+#ifndef TRACE_H_
+#define TRACE_H_
+/* Inclusion */
+#include "../Parse/Parse.h"
+
+/* Macros */
+/** The first bytes of a trace file, the first byte isn't a text character */
+#define TRACE_MAGIC				"\x89VCT"
+/** The number of bytes of #TRACE_MAGIC */
+#define TRACE_MAGIC_SIZE		4u
+/** The version of the trace format */
+#define TRACE_VERSION			1u
+/** The size of the trace file header, #TRACE_MAGIC and the version */
+#define TRACE_HEADER_SIZE		(TRACE_MAGIC_SIZE + 1u)
+/** The maximum number of bytes of one varint */
+#define TRACE_VARINT_MAX_SIZE	5u
+/** The maximum size of one record, the states, the error byte and 5 varint bytes */
+#define TRACE_RECORD_MAX_SIZE	(2u + TRACE_VARINT_MAX_SIZE)
+
+/* User-defined data types */
+/**
+ *  This enum for error types that could happens when
+ *  decoding a trace
+ */
+enum Trace_Error_t
+{
+	/** Decoding done successfully */
+	TRACE_ERROR_OK = 0,
+	/** The data doesn't start with #TRACE_MAGIC */
+	TRACE_ERROR_NOT_TRACE = 1,
+	/** The trace has a version other than #TRACE_VERSION */
+	TRACE_ERROR_VERSION = 2,
+	/** The data ends in the middle of a header or a record */
+	TRACE_ERROR_TRUNCATED = 3,
+	/** The record has bits that aren't used by the format */
+	TRACE_ERROR_CORRUPTED = 4
+};
+typedef enum Trace_Error_t Trace_Error_t;
+
+/* Functions prototypes */
+/**
+ *  \brief This function writes the header of a trace file.
+ *
+ *  \param [out] Data At least #TRACE_HEADER_SIZE bytes.
+ *  \return The number of written bytes.
+ */
+unsigned int Trace_WriteHeader(unsigned char * Data);
+
+/**
+ *  \brief This function checks the header of a trace file.
+ *
+ *  \param [in] Data The first bytes of the file.
+ *  \param [in] Length The number of bytes of \p Data.
+ *  \return \ref Trace_Error_t type data.
+ *
+ *  \details It returns #TRACE_ERROR_NOT_TRACE for a text file and for
+ *  		 a file shorter than #TRACE_MAGIC.
+ */
+Trace_Error_t Trace_CheckHeader(const unsigned char * Data, unsigned int Length);
+
+/**
+ *  \brief This function encodes one varint.
+ *
+ *  \param [in] Value The value to be encoded.
+ *  \param [out] Data At least #TRACE_VARINT_MAX_SIZE bytes.
+ *  \return The number of written bytes.
+ *
+ *  \details It's 7 bits in every byte with the least significant first
+ *  		 and bit 7 set if more bytes follow.
+ */
+unsigned int Trace_EncodeVarint(unsigned int Value, unsigned char * Data);
+
+/**
+ *  \brief This function decodes one varint.
+ *
+ *  \param [in] Data The encoded varint.
+ *  \param [in] Length The number of bytes of \p Data, it can be more
+ *  			than the varint.
+ *  \param [out] Value The decoded value.
+ *  \param [out] Used The number of bytes of the varint.
+ *  \return \ref Trace_Error_t type data.
+ *
+ *  \details It returns #TRACE_ERROR_CORRUPTED for a value of more
+ *  		 than 32 bits.
+ */
+Trace_Error_t Trace_DecodeVarint(const unsigned char * Data, unsigned int Length,
+	unsigned int * Value, unsigned int * Used);
+
+/**
+ *  \brief This function encodes one record.
+ *
+ *  \param [in] Record The parsed line.
+ *  \param [out] Data At least #TRACE_RECORD_MAX_SIZE bytes.
+ *  \return The number of written bytes.
+ */
+unsigned int Trace_EncodeRecord(const Parse_Record_t * Record, unsigned char * Data);
+
+/**
+ *  \brief This function decodes one record.
+ *
+ *  \param [in] Data The encoded record.
+ *  \param [in] Length The number of bytes of \p Data, it can be more
+ *  			than the record.
+ *  \param [out] Record The decoded line.
+ *  \param [out] Used The number of bytes of the record.
+ *  \return \ref Trace_Error_t type data.
+ */
+Trace_Error_t Trace_DecodeRecord(const unsigned char * Data, unsigned int Length,
+	Parse_Record_t * Record, unsigned int * Used);
+#endif // !TRACE_H_
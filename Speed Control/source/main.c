@@ -6,27 +6,48 @@
 /* Inclusion */
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include "File If/FileIf.h"
 #include "Motor/Motor.h"
 #include "Switches/Switches.h"
 #include "Speed Control/SpeedControl.h"
-/* Include Unity */
-#include "../test/unity/unity_fixture.h"
+#include "Pipeline/Pipeline.h"
+#include "Chunk/Chunk.h"
+#include "Profile/Profile.h"
+#ifdef MAIN_COLD_START_TIME
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+#endif
 
-#define MAKE_UNITY_VERBOSE	argc = 2; argv[1] = "-v"
-
-
-/* Test Groups Runner */
- /**
- *  \brief This is all needed test cases to test our modules.
+#ifdef MAIN_COLD_START_TIME
+/**
+ *  \brief Gets a monotonic time stamp in microseconds.
+ *
+ *  \return The time stamp in microseconds.
+ *
+ *  \details It's built only with #MAIN_COLD_START_TIME to measure the
+ *  		 time from the start of main to the first motor update.
  */
- void RunAllTests(void)
+static double Main_GetTimeUs(void)
 {
-    RUN_TEST_GROUP(parseing_test);
-    RUN_TEST_GROUP(FakeSwitch);
-    RUN_TEST_GROUP(motor_test);
-    RUN_TEST_GROUP(speed_control_test);
+#ifdef _WIN32
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+
+	QueryPerformanceCounter(&counter);
+	QueryPerformanceFrequency(&frequency);
+	return (double)counter.QuadPart * 1e6 / (double)frequency.QuadPart;
+#else
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (double)now.tv_sec * 1e6 + (double)now.tv_nsec / 1e3;
+#endif
 }
+#endif
 
 /** New speed to be applied to the motor */
 int newSpeed;
@@ -34,35 +55,148 @@ int newSpeed;
 /**
  *  \brief Main program body
  *
- *  \details This is the main code to run.
+ *  \param [in] argc The number of arguments.
+ *  \param [in] argv The arguments, "--pipeline" selects the pipelined mode,
+ *  			"--fast-forward" replays runs of lines at once,
+ *  			"--parallel-parse <workers>" parses chunks of the input
+ *  			file and calculates their speeds on worker threads and
+ *  			"--run-length" writes the output in run-length format.
+ *  			The first other argument is the input file and the second
+ *  			one is the output file, "-" is the standard input or output.
+ *  \return 0 if the input file is replayed, otherwise 1.
+ *
+ *  \details This is the main code to run. If the output file is the
+ *  		 standard output the messages are printed to the standard error.
  */
 int main(int argc, char * argv[])
 {
-    /* Manipulate argc & argv to make unity verbose*/
-    MAKE_UNITY_VERBOSE;
+#ifdef MAIN_COLD_START_TIME
+	double startTime = Main_GetTimeUs();
+	int firstUpdate = 1;
+#endif
+	Switches_Context_t switches;
+	Motor_Context_t motor;
+	unsigned long long ticks;
+	unsigned long long skipped;
+	FILE * console = stdout;
+	int paths = 0;
+	int pipelined = 0;
+	int fastForward = 0;
+	unsigned long workers = 0;
+	char * end;
+	int retCode = 0;
+	int index;
+
+	/* Program arguments */
+	for (index = 1; index < argc; index++)
+	{
+		if (strcmp(argv[index], "--pipeline") == 0)
+		{
+			pipelined = 1;
+		}
+		else if (strcmp(argv[index], "--fast-forward") == 0)
+		{
+			fastForward = 1;
+		}
+		else if (strcmp(argv[index], "--parallel-parse") == 0 && index + 1 < argc &&
+			(workers = strtoul(argv[index + 1], &end, 10)) > 0u && workers <= 1024u && *end == '\0')
+		{
+			index++;
+		}
+		else if (strcmp(argv[index], "--run-length") == 0)
+		{
+			File_SetOutputFormat(FILE_IF_OUTPUT_FORMAT_RUN_LENGTH);
+		}
+		else if (paths == 0 && (argv[index][0] != '-' || argv[index][1] == '\0'))
+		{
+			File_SetInputPath(argv[index]);
+			paths++;
+		}
+		else if (paths == 1 && (argv[index][0] != '-' || argv[index][1] == '\0'))
+		{
+			File_SetOutputPath(argv[index]);
+			console = (strcmp(argv[index], FILE_IF_STANDARD_STREAM_PATH) == 0) ? stderr : stdout;
+			paths++;
+		}
+		else
+		{
+			fprintf(stderr, "Usage: %s [--pipeline | --fast-forward | --parallel-parse <workers>] [--run-length] "
+				"[input file [output file]]\n",
+				argv[0]);
+			retCode = 1;
+		}
+	}
 
-    /* Call Unity Main */
-    UnityMain(argc, argv, RunAllTests);
+	if (retCode == 0)
+	{
+		fprintf(console, "App is running..\n");
 
-    printf("App is running..\n");
+		/* Program initialization */
+		Motor_Init();	/* Init the motor */
+#ifdef SPEED_CONTROL_TABLE_ENABLED
+		SpeedControl_TableInit();	/* Init the tables of the new speed */
+#endif
 
-	/* Program initialization */
-    Motor_Init();	/* Init the motor */
-	Switches_Init();	/* Init the Switches */
+		if (Switches_Init() != SWITCH_UPDATE_OK)	/* Init the Switches */
+		{
+			fprintf(stderr, "Can't read the input file, it's missing or its compression isn't built in\n");
+			retCode = 1;
+		}
+		else if (pipelined)
+		{
+			/* Read, parse, calculate and write on their own threads */
+			Switches_ContextInit(&switches, NULL);
+			Motor_ContextInit(&motor, NULL);
+			retCode = (Pipeline_Run(&switches, &motor) == PIPELINE_ERROR_OK) ? 0 : 1;
+		}
+		else if (fastForward)
+		{
+			/* The speeds of a run of lines are calculated at once */
+			Switches_ContextInit(&switches, NULL);
+			Motor_ContextInit(&motor, NULL);
+			ticks = SpeedControl_ContextReplay(&switches, &motor, &skipped);
+			fprintf(console, "Fast-forwarded %llu of %llu ticks\n", skipped, ticks);
+		}
+		else if (workers != 0u)
+		{
+			/* The lines are parsed in chunks on the workers and replayed in order */
+			Switches_ContextInit(&switches, NULL);
+			Motor_ContextInit(&motor, NULL);
+			if (Chunk_Run(&switches, &motor, (unsigned int)workers, 0u) != CHUNK_ERROR_OK)
+			{
+				fprintf(console, "Can't start the workers, the lines are replayed one by one\n");
+			}
+		}
 
-	/* 	Continue updating the state of switches until it's not
-		available (Until the end of file here)*/
-	while (Switches_UpdateState() == SWITCH_UPDATE_OK)
-	{
-		/* Calculate new speed depend on switchs state and current speed */
-		newSpeed = SpeedControl_CalcNewSpeed();
-		/* Assign new speed to the motor */
-		Motor_UpdateSpeed(newSpeed);
+		/* 	Continue updating the state of switches until it's not
+			available (Until the end of file here)*/
+		while (retCode == 0 && !pipelined && !fastForward && workers == 0u && Switches_UpdateState() == SWITCH_UPDATE_OK)
+		{
+			/* Calculate new speed depend on switchs state and current speed */
+			newSpeed = SpeedControl_CalcNewSpeed();
+			/* Assign new speed to the motor */
+			Motor_UpdateSpeed(newSpeed);
+#ifdef MAIN_COLD_START_TIME
+			if (firstUpdate)
+			{
+				fprintf(stderr, "First motor update after %.0f us\n", Main_GetTimeUs() - startTime);
+				firstUpdate = 0;
+			}
+#endif
+		}
+
+		if (retCode == 0 && File_GetInputError() != FILE_IF_ERROR_OK)	/* Stopped before the end of file */
+		{
+			fprintf(stderr, "Can't read the input file to its end, it's broken or truncated\n");
+			retCode = 1;
+		}
+
+		/* End of project */
+		PROFILE_PRINT_SUMMARY(console);
+		fprintf(console, "Done\n");
 	}
 
-	/* End of project */
-	printf("Done\n");
-    return 0;
+    return retCode;
 }
 /**
  *  \mainpage Vacuum Cleaner  Project
@@ -90,6 +224,22 @@ int main(int argc, char * argv[])
  *  -	\b File \b Interface \b Module: It interacts with I/P "switch.txt" and O/P "motor.txt" files.
  *  -	\b Parse \b Module: It parses the text from input file and passed it to \b switch \b module
  *  	to simulate the switches hardware on PC.
+ *  -	\b Device \b Module: It holds the switches, motor and files of one device, so many devices
+ *  	can be simulated in one process. The functions without a context work on a default device.
+ *  -	\b Pipeline \b Module: It replays the input file by reading, parsing, calculating and
+ *  	writing on their own threads. It's selected by running the project with "--pipeline".
+ *  -	\b Chunk \b Module: It replays the input file by parsing chunks of its lines and
+ *  	calculating their speeds on worker threads, only the change of the speed over every chunk
+ *  	is applied in order. It's selected by running the project with "--parallel-parse <workers>".
+ *  -	\b Fleet \b Module: It replays a directory of devices on worker threads that steal devices
+ *  	from each other. It's built by Fleet target as "speedcontrol_fleet <input directory> [workers]".
+ *  -	\b Generate \b Module: It generates input files of any size whose switches go through
+ *  	the states of real buttons. It's built by Generate target as
+ *  	"speedcontrol_generate <output file> <lines> [options]".
+ *  -	\b Profile \b Module: It records the latencies of reading, parsing, calculating and writing
+ *  	into histograms when the project is built by Profile target.
+ *  -	\b Trace \b Module: It encodes the input lines as a binary trace which can be used as
+ *  	"switches.txt". It's built by Trace target as "speedcontrol_trace <input text file> <output trace file>".
  *  
  *  \section assumptions_section Assumptions section
  *  We have made some assumptions:
@@ -121,8 +271,35 @@ int main(int argc, char * argv[])
  *  	EP + BVA (pressing duration of "P" switch).
  *  
  *  \section project_operation	Project Operation
- *  The project first runs the selected test cases of each module and shows the result
- *  of all test cases in console window, then runs the project itself(reading the states of 
- *  switches "switches.txt" from text file, calculates the new speed, update motor angle, 
- *  and output it to text file "motor.txt").
+ *  The project reads the states of switches "switches.txt" from text file, calculates
+ *  the new speed, update motor angle, and output it to text file "motor.txt". It's
+ *  built by Debug and Release targets.
+ *  
+ *  The test cases of each module are built by Test target in a separated binary, 
+ *  it shows the result of all test cases in console window.
+ *  
+ *  The input and output files can be given after the options, "-" is the standard input or
+ *  output, so a trace can be piped through the project as "gzip -dc trace.gz | speedcontrol - -".
+ *  The messages are printed to stderr when the motor angles are written to the standard output.
+ *  
+ *  Compressed input files are detected by their first bytes and decompressed while they are
+ *  read, so "speedcontrol switches.txt.gz motor.txt.gz" never expands them on disk. The output
+ *  file is compressed if its path ends with ".gz" or ".zst". Compression is built in only by
+ *  Compress and Test targets, they define FILE_IF_COMPRESS_ENABLED and link zlib for gzip, so the
+ *  other targets need no compression library and reject compressed files. zstd is built in too if
+ *  "-DFILE_IF_ZSTD_ENABLED" is added and libzstd is linked.
+ *  
+ *  Running the project with "--fast-forward" calculates the speeds of the lines that change
+ *  the speed by the same step at once and writes the ticks after the speed is limited
+ *  together, it prints how many ticks were written that way.
+ *  
+ *  Running the project with "--run-length" writes the motor angles as runs of the same
+ *  angle to "motor.rle" instead of "motor.txt". It's decoded back to the same text file
+ *  by MotorDecode target as "speedcontrol_motor_decode <input run-length file> <output text file>".
+ *  
+ *  Profile target is built with PROFILE_ENABLED defined, it prints the count, mean, p50,
+ *  p99, p999 and maximum latency of reading, parsing, calculating and writing before "Done".
+ *  
+ *  Building with MAIN_COLD_START_TIME defined prints the time from the start of
+ *  main to the first motor update to stderr.
  */
\ No newline at end of file
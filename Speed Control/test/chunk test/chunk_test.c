@@ -0,0 +1,181 @@
+/**
+ *  \file	chunk_test.c
+ *  \brief	This file includes test cases for testing Chunk module.
+ *  \author Ahmed Wageh
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../../source/Chunk/Chunk.h"
+#include "../replay helper/replay_helper.h"
+#include "../unity/unity_fixture.h"
+
+/** The input file used by the test cases */
+#define CHUNK_TEST_INPUT		"chunk_test_switches.txt"
+/** The output file of replaying line by line */
+#define CHUNK_TEST_SERIAL		"chunk_test_motor_serial.txt"
+/** The output file of replaying by chunks */
+#define CHUNK_TEST_CHUNKS		"chunk_test_motor_chunks.txt"
+/** The number of input lines */
+#define CHUNK_TEST_LINES		3000u
+/** The number of lines after which an empty line is written */
+#define CHUNK_TEST_BLANK_EVERY	11u
+/** The size of the small chunks, a few lines */
+#define CHUNK_TEST_SMALL_SIZE	100u
+/** The number of workers */
+#define CHUNK_TEST_WORKERS		4u
+
+/* Test group declaration */
+TEST_GROUP(chunk_test);
+
+/**
+ *  \brief Checks that replaying by chunks writes the same output file
+ *  		as replaying line by line.
+ *
+ *  \param [in] Mode the \ref FileIf_InputMode_t of the input file.
+ *  \param [in] Workers the number of workers of \ref Chunk_Run.
+ *  \param [in] Size the size of the chunks.
+ */
+static void CheckSameAsSerial(FileIf_InputMode_t Mode, unsigned int Workers, unsigned int Size)
+{
+	REPLAY_Config_t config = {Mode, REPLAY_CHUNKS, Workers, Size};
+
+	REPLAY_CheckSameAsSerial(CHUNK_TEST_INPUT, CHUNK_TEST_SERIAL, CHUNK_TEST_CHUNKS, &config);
+}
+
+/* chunk_test group setup and tear_down function */
+TEST_SETUP(chunk_test)
+{
+	FILE * handler;
+
+	REPLAY_WriteInput(CHUNK_TEST_INPUT, CHUNK_TEST_LINES, CHUNK_TEST_BLANK_EVERY);
+	handler = fopen(CHUNK_TEST_INPUT, "ab");
+	fputs("pressed released pre_pressed 0", handler);	/* The last line without "\n" */
+	fclose(handler);
+}
+
+TEST_TEAR_DOWN(chunk_test)
+{
+	remove(CHUNK_TEST_INPUT);
+	remove(CHUNK_TEST_SERIAL);
+	remove(CHUNK_TEST_CHUNKS);
+}
+
+/**
+ *  \defgroup chunk_test_cases Chunk module test cases
+ *  This is for testing the functionality of Chunk module
+ *
+ *  \details It tests the following test cases:
+ *  	-	ChunksEndAtLines: Every chunk read by \ref File_ReaderReadChunk
+ *  		ends with "\n" but the last one, and the chunks are the file.
+ *  	-	ChunksAreTheSameAsSerial: The output file and the last speed
+ *  		are the same as replaying line by line for one and many
+ *  		workers, small and default chunks and both input modes.
+ *  	-	ChunksSplitLongLines: A line longer than a read block is split
+ *  		the same as replaying line by line in stream mode.
+ *  	-	ChunksReplayEmptyFile: A file with only a header writes only
+ *  		the output header.
+ *  @{
+ */
+
+/**
+ *  \brief Test case for reading the input file by chunks.
+ */
+TEST(chunk_test, ChunksEndAtLines)
+{
+	static char readBuffer[REPLAY_READ_SIZE + 1];
+	static char chunk[CHUNK_TEST_SMALL_SIZE];
+	FileIf_Reader_t reader;
+	FileIf_Error_t readError;
+	unsigned int length;
+	unsigned int chunks = 0;
+	long size;
+	long position;
+	char * text = REPLAY_ReadFile(CHUNK_TEST_INPUT, &size);
+
+	position = (long)(strchr(text, '\n') - text) + 1;	/* After the header */
+	LONGS_EQUAL(FILE_IF_ERROR_OK, File_ReaderOpenMode(&reader, CHUNK_TEST_INPUT, readBuffer,
+		REPLAY_READ_SIZE, FILE_IF_INPUT_MODE_STREAM));
+	readError = File_ReaderReadChunk(&reader, chunk, sizeof(chunk), &length);
+	while (readError == FILE_IF_ERROR_OK)
+	{
+		CHECK(length != 0u && length <= sizeof(chunk));
+		CHECK(position + (long)length == size || chunk[length - 1u] == '\n');
+		LONGS_EQUAL(0, memcmp(text + position, chunk, length));
+		position += (long)length;
+		chunks++;
+		readError = File_ReaderReadChunk(&reader, chunk, sizeof(chunk), &length);
+	}
+	LONGS_EQUAL(FILE_IF_ERROR_END_OF_FILE, readError);
+	LONGS_EQUAL(size, position);
+	CHECK(chunks > (unsigned int)(size / (long)sizeof(chunk)));
+	File_ReaderClose(&reader);
+	free(text);
+}
+
+/**
+ *  \brief Test case for the output of replaying by chunks.
+ */
+TEST(chunk_test, ChunksAreTheSameAsSerial)
+{
+	CheckSameAsSerial(FILE_IF_INPUT_MODE_STREAM, 1u, CHUNK_TEST_SMALL_SIZE);
+	CheckSameAsSerial(FILE_IF_INPUT_MODE_STREAM, CHUNK_TEST_WORKERS, CHUNK_TEST_SMALL_SIZE);
+	CheckSameAsSerial(FILE_IF_INPUT_MODE_STREAM, CHUNK_TEST_WORKERS, 0u);
+	CheckSameAsSerial(FILE_IF_INPUT_MODE_MAPPED, CHUNK_TEST_WORKERS, CHUNK_TEST_SMALL_SIZE);
+	CheckSameAsSerial(FILE_IF_INPUT_MODE_MAPPED, CHUNK_TEST_WORKERS, 0u);
+}
+
+/**
+ *  \brief Test case for a line longer than #REPLAY_READ_SIZE.
+ */
+TEST(chunk_test, ChunksSplitLongLines)
+{
+	FILE * handler = fopen(CHUNK_TEST_INPUT, "ab");
+	unsigned int index;
+
+	fputs("\npre_pressed", handler);
+	for (index = 0; index < 2u * REPLAY_READ_SIZE; index++)
+	{
+		fputc('\t', handler);
+	}
+	fputs("released released 0\nreleased released pressed 60000\n", handler);
+	fclose(handler);
+
+	CheckSameAsSerial(FILE_IF_INPUT_MODE_STREAM, CHUNK_TEST_WORKERS, 0u);
+}
+
+/**
+ *  \brief Test case for an input file without lines.
+ */
+TEST(chunk_test, ChunksReplayEmptyFile)
+{
+	static const REPLAY_Config_t config = {FILE_IF_INPUT_MODE_MAPPED, REPLAY_CHUNKS, CHUNK_TEST_WORKERS, 0u};
+	FILE * handler = fopen(CHUNK_TEST_INPUT, "wb");
+	long size;
+	char * text;
+
+	fputs("header\n", handler);
+	fclose(handler);
+
+	LONGS_EQUAL(MOTOR_MEDIUM_SPEED, REPLAY_Run(CHUNK_TEST_INPUT, CHUNK_TEST_CHUNKS, &config, NULL));
+	text = REPLAY_ReadFile(CHUNK_TEST_CHUNKS, &size);
+	text[size] = 0;
+	STRCMP_EQUAL(FILE_IF_OUTPUT_FILE_HEADER, text);
+	free(text);
+}
+/**
+ *  @}
+ */
+
+/**
+ *  \brief Test code runner for all test cases of Chunk module.
+ */
+TEST_GROUP_RUNNER(chunk_test)
+{
+    printf("======================== Testing Chunk Module =========================\n\n");
+    RUN_TEST_CASE(chunk_test, ChunksEndAtLines);
+    RUN_TEST_CASE(chunk_test, ChunksAreTheSameAsSerial);
+    RUN_TEST_CASE(chunk_test, ChunksSplitLongLines);
+    RUN_TEST_CASE(chunk_test, ChunksReplayEmptyFile);
+    printf("\n===================== Testing Chunk  Module Done ======================\n\n\n");
+}
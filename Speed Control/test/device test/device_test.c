@@ -0,0 +1,222 @@
+/**
+ *  \file	device_test.c
+ *  \brief	This file includes test cases for testing Device module.
+ *  \author Ahmed Wageh
+ */
+#include <stdio.h>
+#include <string.h>
+#include "../../source/Device/Device.h"
+#include "../../source/Motor/Motor.h"
+#include "../unity/unity_fixture.h"
+
+/** The number of devices used by the test cases */
+#define DEVICE_TEST_DEVICES	2
+
+/* Test group declaration */
+TEST_GROUP(device_test);
+
+/** The input files of the devices under test */
+static const char * Test_Input_Path[DEVICE_TEST_DEVICES] =
+{
+	"device_test_switches_0.txt", "device_test_switches_1.txt"
+};
+/** The output files of the devices under test */
+static const char * Test_Output_Path[DEVICE_TEST_DEVICES] =
+{
+	"device_test_motor_0.txt", "device_test_motor_1.txt"
+};
+/** Devices under test */
+static Device_t Test_Device[DEVICE_TEST_DEVICES];
+/** Read buffers of the devices under test */
+static char Test_Read_Buffer[DEVICE_TEST_DEVICES][32 + 1];
+/** Write buffers of the devices under test */
+static char Test_Write_Buffer[DEVICE_TEST_DEVICES][64];
+
+/**
+ *  \brief Creates the input file of a device and opens the device.
+ *
+ *  \param [in] Index the index of the device under test.
+ *  \param [in] Text the input file content.
+ *  \return \ref FileIf_Error_t of opening the device.
+ */
+static FileIf_Error_t OpenDevice(int Index, const char * Text)
+{
+	FILE * handler = fopen(Test_Input_Path[Index], "wb");
+
+	fputs(Text, handler);
+	fclose(handler);
+	return Device_Open(&Test_Device[Index], Test_Input_Path[Index], Test_Output_Path[Index],
+		Test_Read_Buffer[Index], sizeof(Test_Read_Buffer[Index]) - 1,
+		Test_Write_Buffer[Index], sizeof(Test_Write_Buffer[Index]));
+}
+
+/**
+ *  \brief Reads the whole output file of a device.
+ *
+ *  \param [in] Index the index of the device under test.
+ *  \param [out] Text the file content as a string.
+ *  \param [in] Size the size of \p Text.
+ */
+static void ReadOutputFile(int Index, char * Text, unsigned int Size)
+{
+	FILE * handler = fopen(Test_Output_Path[Index], "rb");
+	size_t length = 0;
+
+	if (handler != NULL)
+	{
+		length = fread(Text, 1, Size - 1, handler);
+		fclose(handler);
+	}
+	Text[length] = 0;
+}
+
+/* device_test group setup and tear_down function */
+TEST_SETUP(device_test)
+{
+
+}
+
+TEST_TEAR_DOWN(device_test)
+{
+	int index;
+
+	for (index = 0; index < DEVICE_TEST_DEVICES; index++)
+	{
+		Device_Close(&Test_Device[index]);
+		remove(Test_Input_Path[index]);
+		remove(Test_Output_Path[index]);
+	}
+}
+
+/**
+ *  \defgroup device_test_cases Device module test cases
+ *  This is for testing the functionality of Device module
+ *
+ *  \details It tests the following test cases:
+ *  	-	DeviceStartsAtMediumSpeed: A new device has released switches
+ *  		and #MOTOR_MEDIUM_SPEED.
+ *  	-	DevicesAreIndependent: Two devices stepped one after the other
+ *  		don't change the switches, motor or files of each other.
+ *  	-	DefaultDeviceIsNotChanged: Stepping a device doesn't change
+ *  		the motor of the global API.
+ *  	-	DeviceCanNotOpenMissingFile: Opening a device with a missing
+ *  		input file returns #FILE_IF_ERROR_CAN_NOT_OPEN.
+ *  	-	FailedDeviceCanBeClosed: A device that isn't zero-filled is
+ *  		closed safely after it failed to open.
+ *  @{
+ */
+
+/**
+ *  \brief Test case for the initial state of a device.
+ */
+TEST(device_test, DeviceStartsAtMediumSpeed)
+{
+	LONGS_EQUAL(FILE_IF_ERROR_OK, OpenDevice(0, "header\n"));
+	LONGS_EQUAL(MOTOR_MEDIUM_SPEED, Motor_ContextGetSpeed(&Test_Device[0].Motor));
+	LONGS_EQUAL(SWITCH_RELEASED, Switches_ContextGetState(&Test_Device[0].Switches, SWITCH_INCREMENT));
+	LONGS_EQUAL(SWITCH_RELEASED, Switches_ContextGetState(&Test_Device[0].Switches, SWITCH_DECREMENT));
+	LONGS_EQUAL(SWITCH_RELEASED, Switches_ContextGetState(&Test_Device[0].Switches, SWITCH_P));
+	LONGS_EQUAL(0, Switches_ContextGetPDuration(&Test_Device[0].Switches));
+	LONGS_EQUAL(SWITCH_UPDATE_ERROR, Device_Step(&Test_Device[0]));
+}
+
+/**
+ *  \brief Test case for stepping two devices one after the other.
+ *
+ *  \details The first device speeds up and the second one slows
+ *  		 down, every output file has only its device speeds.
+ */
+TEST(device_test, DevicesAreIndependent)
+{
+	char text[128];
+
+	LONGS_EQUAL(FILE_IF_ERROR_OK, OpenDevice(0, "header\n"
+		"pre_pressed released released 0\n"
+		"pre_pressed released released 0\n"));
+	LONGS_EQUAL(FILE_IF_ERROR_OK, OpenDevice(1, "header\n"
+		"released pre_pressed released 0\n"
+		"released released pressed 60000\n"
+		"released released released 0\n"));
+
+	LONGS_EQUAL(SWITCH_UPDATE_OK, Device_Step(&Test_Device[0]));
+	LONGS_EQUAL(SWITCH_UPDATE_OK, Device_Step(&Test_Device[1]));
+	LONGS_EQUAL(SWITCH_PRE_PRESSED, Switches_ContextGetState(&Test_Device[0].Switches, SWITCH_INCREMENT));
+	LONGS_EQUAL(SWITCH_PRE_PRESSED, Switches_ContextGetState(&Test_Device[1].Switches, SWITCH_DECREMENT));
+	LONGS_EQUAL(SWITCH_UPDATE_OK, Device_Step(&Test_Device[0]));
+	LONGS_EQUAL(SWITCH_UPDATE_OK, Device_Step(&Test_Device[1]));
+	LONGS_EQUAL(SWITCH_UPDATE_ERROR, Device_Step(&Test_Device[0]));
+	LONGS_EQUAL(SWITCH_UPDATE_OK, Device_Step(&Test_Device[1]));
+	LONGS_EQUAL(SWITCH_UPDATE_ERROR, Device_Step(&Test_Device[1]));
+
+	LONGS_EQUAL(MOTOR_MEDIUM_SPEED + 2, Motor_ContextGetSpeed(&Test_Device[0].Motor));
+	LONGS_EQUAL(MOTOR_MEDIUM_SPEED - 3, Motor_ContextGetSpeed(&Test_Device[1].Motor));
+
+	LONGS_EQUAL(FILE_IF_ERROR_OK, Device_Close(&Test_Device[0]));
+	LONGS_EQUAL(FILE_IF_ERROR_OK, Device_Close(&Test_Device[1]));
+	ReadOutputFile(0, text, sizeof(text));
+	STRCMP_EQUAL(FILE_IF_OUTPUT_FILE_HEADER "91\n92\n", text);
+	ReadOutputFile(1, text, sizeof(text));
+	STRCMP_EQUAL(FILE_IF_OUTPUT_FILE_HEADER "89\n87\n87\n", text);
+}
+
+/**
+ *  \brief Test case for the motor of the global API while stepping a device.
+ */
+TEST(device_test, DefaultDeviceIsNotChanged)
+{
+	int speed = Motor_GetSpeed();
+
+	LONGS_EQUAL(FILE_IF_ERROR_OK, OpenDevice(0, "header\n"
+		"released pre_pressed released 0\n"));
+	LONGS_EQUAL(SWITCH_UPDATE_OK, Device_Step(&Test_Device[0]));
+	LONGS_EQUAL(MOTOR_MEDIUM_SPEED - 1, Motor_ContextGetSpeed(&Test_Device[0].Motor));
+	LONGS_EQUAL(speed, Motor_GetSpeed());
+}
+
+/**
+ *  \brief Test case for opening a device without input file.
+ */
+TEST(device_test, DeviceCanNotOpenMissingFile)
+{
+	remove(Test_Input_Path[0]);
+	LONGS_EQUAL(FILE_IF_ERROR_CAN_NOT_OPEN, Device_Open(&Test_Device[0], Test_Input_Path[0],
+		Test_Output_Path[0], Test_Read_Buffer[0], sizeof(Test_Read_Buffer[0]) - 1,
+		Test_Write_Buffer[0], sizeof(Test_Write_Buffer[0])));
+}
+
+/**
+ *  \brief Test case for closing a device that failed to open.
+ *
+ *  \details The device isn't zero-filled, so closing it must only use
+ *  		 the fields set by \ref Device_Open.
+ */
+TEST(device_test, FailedDeviceCanBeClosed)
+{
+	Device_t device;
+
+	memset(&device, 0xA5, sizeof(device));
+	remove(Test_Input_Path[0]);
+	LONGS_EQUAL(FILE_IF_ERROR_CAN_NOT_OPEN, Device_Open(&device, Test_Input_Path[0],
+		Test_Output_Path[0], Test_Read_Buffer[0], sizeof(Test_Read_Buffer[0]) - 1,
+		Test_Write_Buffer[0], sizeof(Test_Write_Buffer[0])));
+	LONGS_EQUAL(FILE_IF_ERROR_CAN_NOT_OPEN, Device_Close(&device));
+	CHECK(device.Reader.Handler == NULL && device.Reader.Map == NULL);
+	CHECK(device.Writer.Handler == NULL && device.Writer.Compress_Stream == NULL);
+}
+/**
+ *  @}
+ */
+
+/**
+ *  \brief Test code runner for all test cases of Device module.
+ */
+TEST_GROUP_RUNNER(device_test)
+{
+    printf("======================= Testing Device Module =======================\n\n");
+    RUN_TEST_CASE(device_test, DeviceStartsAtMediumSpeed);
+    RUN_TEST_CASE(device_test, DevicesAreIndependent);
+    RUN_TEST_CASE(device_test, DefaultDeviceIsNotChanged);
+    RUN_TEST_CASE(device_test, DeviceCanNotOpenMissingFile);
+    RUN_TEST_CASE(device_test, FailedDeviceCanBeClosed);
+    printf("\n==================== Testing Device  Module Done ====================\n\n\n");
+}
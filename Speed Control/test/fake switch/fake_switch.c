@@ -14,21 +14,9 @@
 
 /* Switches States */
 /**
- *  Fake "+ve" switch state.
+ *  Fake states of all switches and pressing durarion of "P" switch.
  */
-static Switches_States_t IncSwitchState;
-/**
- *  Fake "-ve" switch state.
- */
-static Switches_States_t DecSwitchState;
-/**
- *  Fake "p" switch state.
- */
-static Switches_States_t PSwitchState;
-/**
- *  Fake pressing durarion of "P" switch.
- */
-static int P_Switch_Duration;
+static Switches_Snapshot_t FakeSnapshot;
 
 /* Functions definition */
 /**
@@ -43,10 +31,10 @@ static int P_Switch_Duration;
  */
 void FAKE_SW_init(void)
 {
-    IncSwitchState = SWITCH_RELEASED;
-    DecSwitchState = SWITCH_RELEASED;
-    PSwitchState = SWITCH_RELEASED;
-    P_Switch_Duration = 0;
+    FakeSnapshot.Inc_Switch = SWITCH_RELEASED;
+    FakeSnapshot.Dec_Switch = SWITCH_RELEASED;
+    FakeSnapshot.P_Switch = SWITCH_RELEASED;
+    FakeSnapshot.P_Duration = 0;
 }
 
 /**
@@ -62,10 +50,10 @@ void FAKE_SW_init(void)
 void FAKE_SW_destroy(void)
 {
     /* Nothing to destroy, Just Initialize everything again */
-    IncSwitchState = SWITCH_RELEASED;
-    DecSwitchState = SWITCH_RELEASED;
-    PSwitchState = SWITCH_RELEASED;
-    P_Switch_Duration = 0;
+    FakeSnapshot.Inc_Switch = SWITCH_RELEASED;
+    FakeSnapshot.Dec_Switch = SWITCH_RELEASED;
+    FakeSnapshot.P_Switch = SWITCH_RELEASED;
+    FakeSnapshot.P_Duration = 0;
 }
 
 /**
@@ -87,15 +75,15 @@ Switches_States_t FAKE_SW_getSwState(Switches_IDs_t ID)
 	switch(ID)
 	{
 		case SWITCH_INCREMENT:
-			retData = IncSwitchState;
+			retData = FakeSnapshot.Inc_Switch;
 		break;
 
 		case SWITCH_DECREMENT:
-			retData = DecSwitchState;
+			retData = FakeSnapshot.Dec_Switch;
 		break;
 
 		case SWITCH_P:
-			retData = PSwitchState;
+			retData = FakeSnapshot.P_Switch;
 		break;
 		
 		default:;
@@ -115,7 +103,21 @@ Switches_States_t FAKE_SW_getSwState(Switches_IDs_t ID)
  */
 int FAKE_SW_getSwDuration(void)
 {
-    return P_Switch_Duration;
+    return FakeSnapshot.P_Duration;
+}
+
+/**
+ *  \brief Getting the readings of all fake switches.
+ *  
+ *  \param None
+ *  \return The \ref Switches_Snapshot_t of the fake switches.
+ *  
+ *  \details The returned snapshot follows the fake switches setters,
+ *  		 it can be assigned to \ref Switches_Snapshot.
+ */
+const Switches_Snapshot_t * FAKE_SW_getSnapshot(void)
+{
+    return &FakeSnapshot;
 }
 
 /**
@@ -136,15 +138,15 @@ void FAKE_SW_setSwState(Switches_IDs_t ID, Switches_States_t state)
 	switch(ID)
 	{
 		case SWITCH_INCREMENT:
-			IncSwitchState = state;
+			FakeSnapshot.Inc_Switch = state;
 		break;
 
 		case SWITCH_DECREMENT:
-			DecSwitchState = state;
+			FakeSnapshot.Dec_Switch = state;
 		break;
 
 		case SWITCH_P:
-			PSwitchState = state;
+			FakeSnapshot.P_Switch = state;
 		break;
 			
 		default:;
@@ -163,5 +165,5 @@ void FAKE_SW_setSwState(Switches_IDs_t ID, Switches_States_t state)
  */
 void FAKE_SW_setSwDuration(int duration)
 {
-    P_Switch_Duration = duration;
+    FakeSnapshot.P_Duration = duration;
 }
\ No newline at end of file
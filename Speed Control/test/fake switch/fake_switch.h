@@ -63,6 +63,17 @@ Switches_States_t FAKE_SW_getSwState(Switches_IDs_t ID);
  */
 int FAKE_SW_getSwDuration(void);
 
+/**
+ *  \brief Getting the readings of all fake switches.
+ *
+ *  \param None
+ *  \return The \ref Switches_Snapshot_t of the fake switches.
+ *
+ *  \details The returned snapshot follows the fake switches setters,
+ *  		 it can be assigned to \ref Switches_Snapshot.
+ */
+const Switches_Snapshot_t * FAKE_SW_getSnapshot(void);
+
 /**
  *  \brief	Assigning a \ref Switches_States_t to the fake
  *  		switch with \ref Switches_IDs_t = \ref ID.
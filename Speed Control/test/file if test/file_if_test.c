@@ -0,0 +1,734 @@
+/**
+ *  \file	file_if_test.c
+ *  \brief	This file includes test cases for testing File If module.
+ *  \author Ahmed Wageh
+ */
+#include <stdio.h>
+#include <string.h>
+#include "../../source/File If/FileIf.h"
+#include "../unity/unity_fixture.h"
+#ifdef FILE_IF_COMPRESS_ENABLED
+#include <zlib.h>
+#endif
+#if defined(__unix__) || defined(__APPLE__)
+#include <pthread.h>
+#include <sys/stat.h>
+/** The system supports named pipes */
+#define FILE_IF_TEST_FIFO_SUPPORTED
+#endif
+
+/** The output file used by the test cases */
+#define FILE_IF_TEST_OUTPUT_PATH	"file_if_test_motor.txt"
+/** The input file used by the test cases */
+#define FILE_IF_TEST_INPUT_PATH		"file_if_test_switches.txt"
+/** The compressed output file used by the test cases */
+#define FILE_IF_TEST_GZIP_OUTPUT_PATH	"file_if_test_motor.txt.gz"
+/** The compressed input file used by the test cases */
+#define FILE_IF_TEST_GZIP_INPUT_PATH	"file_if_test_switches.txt.gz"
+/** The zstd output file used by the test cases */
+#define FILE_IF_TEST_ZSTD_OUTPUT_PATH	"file_if_test_motor.txt.zst"
+/** The number of lines written by the run-length test cases */
+#define FILE_IF_TEST_RUN_LINES		300u
+
+/* Test group declaration */
+TEST_GROUP(file_if_test);
+
+/** Writer object under test */
+static FileIf_Writer_t Test_Writer;
+/** Buffer of the writer object under test */
+static char Test_Buffer[64];
+/** Reader object under test */
+static FileIf_Reader_t Test_Reader;
+/** Small block buffer of the reader object under test to force refilling */
+static char Test_Read_Buffer[24 + 1];
+
+/**
+ *  \brief Creates the input file under test and opens it for
+ *  		the reader under test.
+ *
+ *  \param [in] Text the file content.
+ *  \return \ref FileIf_Error_t of opening the reader.
+ */
+static FileIf_Error_t OpenInputFile(const char * Text)
+{
+	FILE * handler = fopen(FILE_IF_TEST_INPUT_PATH, "wb");
+
+	fputs(Text, handler);
+	fclose(handler);
+	return File_ReaderOpen(&Test_Reader, FILE_IF_TEST_INPUT_PATH,
+		Test_Read_Buffer, sizeof(Test_Read_Buffer) - 1);
+}
+
+/**
+ *  \brief Reads the next line of the reader under test as a string.
+ *
+ *  \param [out] Text the line as a string.
+ *  \return \ref FileIf_Error_t of reading the line.
+ */
+static FileIf_Error_t ReadInputLine(char * Text)
+{
+	const char * line;
+	unsigned int length;
+	FileIf_Error_t retData = File_ReaderNextLine(&Test_Reader, &line, &length);
+
+	Text[0] = 0;
+	if (retData == FILE_IF_ERROR_OK)
+	{
+		memcpy(Text, line, length);
+		Text[length] = 0;
+	}
+	return retData;
+}
+
+#ifdef FILE_IF_TEST_FIFO_SUPPORTED
+/**
+ *  \brief Writes some lines to the named pipe under test.
+ *
+ *  \param [in] Argument Not used.
+ *  \return NULL.
+ */
+static void * WriteFifo(void * Argument)
+{
+	FILE * handler = fopen(FILE_IF_TEST_INPUT_PATH, "wb");
+
+	(void)Argument;
+	if (handler != NULL)
+	{
+		fputs("header\npressed 1\nreleased 2\n", handler);
+		fclose(handler);
+	}
+	return NULL;
+}
+#endif
+
+/**
+ *  \brief Reads the whole output file under test.
+ *
+ *  \param [out] Text the file content as a string.
+ *  \param [in] Size the size of \p Text.
+ */
+static void ReadOutputFile(char * Text, unsigned int Size)
+{
+	FILE * handler = fopen(FILE_IF_TEST_OUTPUT_PATH, "rb");
+	size_t length = 0;
+
+	if (handler != NULL)
+	{
+		length = fread(Text, 1, Size - 1, handler);
+		fclose(handler);
+	}
+	Text[length] = 0;
+}
+
+/* file_if_test group setup and tear_down function */
+TEST_SETUP(file_if_test)
+{
+	File_WriterOpen(&Test_Writer, FILE_IF_TEST_OUTPUT_PATH, Test_Buffer, sizeof(Test_Buffer));
+}
+
+TEST_TEAR_DOWN(file_if_test)
+{
+	File_WriterClose(&Test_Writer);
+	File_ReaderClose(&Test_Reader);
+	remove(FILE_IF_TEST_OUTPUT_PATH);
+	remove(FILE_IF_TEST_INPUT_PATH);
+	remove(FILE_IF_TEST_GZIP_OUTPUT_PATH);
+	remove(FILE_IF_TEST_GZIP_INPUT_PATH);
+	remove(FILE_IF_TEST_ZSTD_OUTPUT_PATH);
+}
+
+/**
+ *  \defgroup file_if_test_cases File If module test cases
+ *  This is for testing the functionality of File If module
+ *
+ *  \details It tests the following test cases:
+ *  	-	WriterKeepsLinesUntilFlush: The written lines stay in the
+ *  		buffer until the writer is flushed.
+ *  	-	WriterFlushesEveryNLines: The flush policy flushes the buffer
+ *  		after the configured number of lines.
+ *  	-	WriterFlushesWhenBufferIsFull: The buffer is flushed when
+ *  		there is no room for a new line.
+ *  	-	WriterRejectsWritingAfterClose: Writing to a closed writer
+ *  		returns #FILE_IF_ERROR_CAN_NOT_OPEN.
+ *  	-	ReaderSkipsHeaderAndReadsLines: The header is skipped and the
+ *  		lines are read across block boundaries.
+ *  	-	ReaderReadsLastLineWithoutNewLine: The last line is read even
+ *  		if the file doesn't end with a new line.
+ *  	-	ReaderSkipsEmptyLines: Empty lines aren't returned.
+ *  	-	ReaderCanNotOpenMissingFile: Opening a missing file returns
+ *  		#FILE_IF_ERROR_CAN_NOT_OPEN.
+ *  	-	MappedReaderReadsLines: The lines of a memory-mapped file are
+ *  		the same as in stream mode.
+ *  	-	RunLengthOutputIsDecodedToTheSameLines: The runs of a run-length
+ *  		file written through a small buffer are decoded to the written lines.
+ *  	-	BadRunsAreDetected: Cut and corrupted runs are reported.
+ *  	-	WriterRepeatIsTheSameAsLines: Writing the same data many times
+ *  		at once is the same as writing every line.
+ *  	-	DashReadsStandardInput: "-" reads the standard input in stream
+ *  		mode and closing the reader keeps it opened.
+ *  	-	MappedReaderStreamsFifo: A named pipe is opened once and read
+ *  		in stream mode.
+ *  	-	GzipInputIsDecompressed: The lines of a gzip file of two members
+ *  		are read if compression is built in, otherwise gzip files are
+ *  		rejected.
+ *  	-	TruncatedGzipInputIsAnError: Reading a truncated gzip file by
+ *  		lines or chunks stops with an error kept by the reader.
+ *  	-	GzipOutputIsCompressed: A ".gz" output file is readable by zlib
+ *  		after every flush and it's read back by a reader if compression
+ *  		is built in, otherwise it isn't created.
+ *  	-	ZstdNeedsTheLibrary: zstd files are written and read back if
+ *  		zstd is built in, otherwise they are rejected and closed
+ *  		without reading their bytes as lines.
+ *  @{
+ */
+
+/**
+ *  \brief Test case for the default flush policy.
+ *
+ *  \details The lines are written to the file only after
+ *  		 \ref File_WriterFlush is called.
+ */
+TEST(file_if_test, WriterKeepsLinesUntilFlush)
+{
+	char text[128];
+
+	LONGS_EQUAL(FILE_IF_ERROR_OK, File_WriterWriteLine(&Test_Writer, 90));
+	LONGS_EQUAL(FILE_IF_ERROR_OK, File_WriterWriteLine(&Test_Writer, -12));
+	ReadOutputFile(text, sizeof(text));
+	STRCMP_EQUAL(FILE_IF_OUTPUT_FILE_HEADER, text);
+
+	LONGS_EQUAL(FILE_IF_ERROR_OK, File_WriterFlush(&Test_Writer));
+	ReadOutputFile(text, sizeof(text));
+	STRCMP_EQUAL(FILE_IF_OUTPUT_FILE_HEADER "90\n-12\n", text);
+}
+
+/**
+ *  \brief Test case for "every N lines" flush policy.
+ *
+ *  \details With a policy of 2 lines, the first line is kept in the
+ *  		 buffer and the second line flushes both of them.
+ */
+TEST(file_if_test, WriterFlushesEveryNLines)
+{
+	char text[128];
+
+	Test_Writer.Policy.Every_Lines = 2;
+	File_WriterWriteLine(&Test_Writer, 10);
+	ReadOutputFile(text, sizeof(text));
+	STRCMP_EQUAL(FILE_IF_OUTPUT_FILE_HEADER, text);
+
+	File_WriterWriteLine(&Test_Writer, 140);
+	ReadOutputFile(text, sizeof(text));
+	STRCMP_EQUAL(FILE_IF_OUTPUT_FILE_HEADER "10\n140\n", text);
+}
+
+/**
+ *  \brief Test case for a full buffer.
+ *
+ *  \details Writing more lines than the buffer can hold flushes the
+ *  		 old lines and keeps the output in order.
+ */
+TEST(file_if_test, WriterFlushesWhenBufferIsFull)
+{
+	char text[512];
+	char expected[512];
+	int line;
+
+	strcpy(expected, FILE_IF_OUTPUT_FILE_HEADER);
+	for (line = 0; line < 30; line++)
+	{
+		File_WriterWriteLine(&Test_Writer, 100 + line);
+		sprintf(expected + strlen(expected), "%d\n", 100 + line);
+	}
+	File_WriterFlush(&Test_Writer);
+	ReadOutputFile(text, sizeof(text));
+	STRCMP_EQUAL(expected, text);
+}
+
+/**
+ *  \brief Test case for writing after closing the writer.
+ */
+TEST(file_if_test, WriterRejectsWritingAfterClose)
+{
+	File_WriterClose(&Test_Writer);
+	LONGS_EQUAL(FILE_IF_ERROR_CAN_NOT_OPEN, File_WriterWriteLine(&Test_Writer, 90));
+}
+/**
+ *  \brief Test case for reading lines through a small block buffer.
+ *
+ *  \details The lines cross the 24 bytes block boundaries and must
+ *  		 be returned complete and in order.
+ */
+TEST(file_if_test, ReaderSkipsHeaderAndReadsLines)
+{
+	char text[32];
+
+	LONGS_EQUAL(FILE_IF_ERROR_OK, OpenInputFile("header line\nreleased\tpressed\t0\npre_pressed\t30000\n"));
+	LONGS_EQUAL(FILE_IF_ERROR_OK, ReadInputLine(text));
+	STRCMP_EQUAL("released\tpressed\t0", text);
+	LONGS_EQUAL(FILE_IF_ERROR_OK, ReadInputLine(text));
+	STRCMP_EQUAL("pre_pressed\t30000", text);
+	LONGS_EQUAL(FILE_IF_ERROR_END_OF_FILE, ReadInputLine(text));
+	LONGS_EQUAL(FILE_IF_ERROR_END_OF_FILE, ReadInputLine(text));
+}
+
+/**
+ *  \brief Test case for a file that doesn't end with a new line.
+ */
+TEST(file_if_test, ReaderReadsLastLineWithoutNewLine)
+{
+	char text[32];
+
+	OpenInputFile("header\npressed 1\nreleased 2");
+	ReadInputLine(text);
+	LONGS_EQUAL(FILE_IF_ERROR_OK, ReadInputLine(text));
+	STRCMP_EQUAL("released 2", text);
+	LONGS_EQUAL(FILE_IF_ERROR_END_OF_FILE, ReadInputLine(text));
+}
+
+/**
+ *  \brief Test case for empty lines between and after the lines.
+ */
+TEST(file_if_test, ReaderSkipsEmptyLines)
+{
+	char text[32];
+
+	OpenInputFile("header\n\npressed 1\n\n\nreleased 2\n\n");
+	ReadInputLine(text);
+	STRCMP_EQUAL("pressed 1", text);
+	ReadInputLine(text);
+	STRCMP_EQUAL("released 2", text);
+	LONGS_EQUAL(FILE_IF_ERROR_END_OF_FILE, ReadInputLine(text));
+}
+
+/**
+ *  \brief Test case for a missing input file.
+ */
+TEST(file_if_test, ReaderCanNotOpenMissingFile)
+{
+	char text[32];
+
+	remove(FILE_IF_TEST_INPUT_PATH);
+	LONGS_EQUAL(FILE_IF_ERROR_CAN_NOT_OPEN, File_ReaderOpen(&Test_Reader,
+		FILE_IF_TEST_INPUT_PATH, Test_Read_Buffer, sizeof(Test_Read_Buffer) - 1));
+	LONGS_EQUAL(FILE_IF_ERROR_CAN_NOT_OPEN, ReadInputLine(text));
+}
+/**
+ *  \brief Test case for reading a memory-mapped file.
+ *
+ *  \details Empty lines are skipped and the last line, which doesn't end
+ *  		 with a new line, is returned Null terminated.
+ */
+TEST(file_if_test, MappedReaderReadsLines)
+{
+	const char * line;
+	unsigned int length;
+	FILE * handler = fopen(FILE_IF_TEST_INPUT_PATH, "wb");
+
+	fputs("header\n\npressed 1\nreleased 2", handler);
+	fclose(handler);
+	LONGS_EQUAL(FILE_IF_ERROR_OK, File_ReaderOpenMode(&Test_Reader, FILE_IF_TEST_INPUT_PATH,
+		Test_Read_Buffer, sizeof(Test_Read_Buffer) - 1, FILE_IF_INPUT_MODE_MAPPED));
+
+	LONGS_EQUAL(FILE_IF_ERROR_OK, File_ReaderNextLine(&Test_Reader, &line, &length));
+	LONGS_EQUAL(9, length);
+	LONGS_EQUAL(0, strncmp("pressed 1", line, length));
+	LONGS_EQUAL(FILE_IF_ERROR_OK, File_ReaderNextLine(&Test_Reader, &line, &length));
+	STRCMP_EQUAL("released 2", line);
+	LONGS_EQUAL(FILE_IF_ERROR_END_OF_FILE, File_ReaderNextLine(&Test_Reader, &line, &length));
+	LONGS_EQUAL(FILE_IF_ERROR_END_OF_FILE, File_ReaderNextLine(&Test_Reader, &line, &length));
+}
+
+/**
+ *  \brief Test case for writing and decoding a run-length file.
+ *
+ *  \details The runs have different lengths and negative differences,
+ *  		 and the 64 bytes buffer gets full many times.
+ */
+TEST(file_if_test, RunLengthOutputIsDecodedToTheSameLines)
+{
+	unsigned char data[FILE_IF_TEST_RUN_LINES * FILE_IF_RUN_LENGTH_RUN_MAX_SIZE];
+	int lines[FILE_IF_TEST_RUN_LINES];
+	FILE * handler;
+	unsigned int length = 0;
+	unsigned int position;
+	unsigned int used;
+	unsigned int count;
+	unsigned int line = 0;
+	int runData = 0;
+
+	File_WriterClose(&Test_Writer);
+	LONGS_EQUAL(FILE_IF_ERROR_OK, File_WriterOpenFormat(&Test_Writer, FILE_IF_TEST_OUTPUT_PATH,
+		Test_Buffer, sizeof(Test_Buffer), FILE_IF_OUTPUT_FORMAT_RUN_LENGTH));
+	for (position = 0; position < FILE_IF_TEST_RUN_LINES; position++)
+	{
+		lines[position] = (position % 7u == 0u) ? -1000 * (int)position : 10 + (int)(position / 5u);
+		LONGS_EQUAL(FILE_IF_ERROR_OK, File_WriterWriteLine(&Test_Writer, lines[position]));
+	}
+	LONGS_EQUAL(FILE_IF_ERROR_OK, File_WriterClose(&Test_Writer));
+
+	handler = fopen(FILE_IF_TEST_OUTPUT_PATH, "rb");
+	if (handler != NULL)
+	{
+		length = (unsigned int)fread(data, 1, sizeof(data), handler);
+		fclose(handler);
+	}
+	CHECK(length > FILE_IF_RUN_LENGTH_HEADER_SIZE);
+	LONGS_EQUAL(0, memcmp(data, FILE_IF_RUN_LENGTH_MAGIC, FILE_IF_RUN_LENGTH_MAGIC_SIZE));
+	LONGS_EQUAL(FILE_IF_RUN_LENGTH_VERSION, data[FILE_IF_RUN_LENGTH_MAGIC_SIZE]);
+
+	for (position = FILE_IF_RUN_LENGTH_HEADER_SIZE; position < length; position += used)
+	{
+		LONGS_EQUAL(FILE_IF_ERROR_OK, File_DecodeRun(data + position, length - position,
+			&runData, &count, &used));
+		for (; count > 0u && line < FILE_IF_TEST_RUN_LINES; count--, line++)
+		{
+			LONGS_EQUAL(lines[line], runData);
+		}
+		LONGS_EQUAL(0, count);
+	}
+	LONGS_EQUAL(FILE_IF_TEST_RUN_LINES, line);
+}
+
+/**
+ *  \brief Test case for decoding bad runs.
+ *
+ *  \details The data of the previous run isn't changed by a bad run.
+ */
+TEST(file_if_test, BadRunsAreDetected)
+{
+	const unsigned char run[] = {0x03, 0x81, 0x01};	/* -2 for 129 lines */
+	const unsigned char noLines[] = {0x02, 0x00};
+	const unsigned char tooLong[] = {0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F};
+	int runData = 90;
+	unsigned int count;
+	unsigned int used;
+
+	LONGS_EQUAL(FILE_IF_ERROR_END_OF_FILE, File_DecodeRun(run, 0, &runData, &count, &used));
+	LONGS_EQUAL(FILE_IF_ERROR_END_OF_FILE, File_DecodeRun(run, 2, &runData, &count, &used));
+	LONGS_EQUAL(FILE_IF_ERROR_BAD_FORMAT, File_DecodeRun(noLines, sizeof(noLines), &runData, &count, &used));
+	LONGS_EQUAL(FILE_IF_ERROR_BAD_FORMAT, File_DecodeRun(tooLong, sizeof(tooLong), &runData, &count, &used));
+	LONGS_EQUAL(90, runData);
+	LONGS_EQUAL(FILE_IF_ERROR_OK, File_DecodeRun(run, sizeof(run), &runData, &count, &used));
+	LONGS_EQUAL(88, runData);
+	LONGS_EQUAL(129, count);
+	LONGS_EQUAL(3, used);
+}
+
+/**
+ *  \brief Test case for writing the same data many times.
+ *
+ *  \details The repeated lines fill the 64 bytes buffer many times.
+ */
+TEST(file_if_test, WriterRepeatIsTheSameAsLines)
+{
+	char expected[256];
+	char text[256];
+	unsigned int index;
+
+	for (index = 0; index < 40u; index++)
+	{
+		File_WriterWriteLine(&Test_Writer, (index < 30u) ? 140 : -7);
+	}
+	File_WriterWriteLine(&Test_Writer, 10);
+	File_WriterClose(&Test_Writer);
+	ReadOutputFile(expected, sizeof(expected));
+
+	File_WriterOpen(&Test_Writer, FILE_IF_TEST_OUTPUT_PATH, Test_Buffer, sizeof(Test_Buffer));
+	LONGS_EQUAL(FILE_IF_ERROR_OK, File_WriterWriteRepeat(&Test_Writer, 140, 30));
+	LONGS_EQUAL(FILE_IF_ERROR_OK, File_WriterWriteRepeat(&Test_Writer, 8, 0));
+	LONGS_EQUAL(FILE_IF_ERROR_OK, File_WriterWriteRepeat(&Test_Writer, -7, 10));
+	LONGS_EQUAL(FILE_IF_ERROR_OK, File_WriterWriteRepeat(&Test_Writer, 10, 1));
+	File_WriterClose(&Test_Writer);
+	ReadOutputFile(text, sizeof(text));
+	STRCMP_EQUAL(expected, text);
+	LONGS_EQUAL(FILE_IF_ERROR_CAN_NOT_OPEN, File_WriterWriteRepeat(&Test_Writer, 10, 1));
+}
+
+/**
+ *  \brief Test case for reading the standard input.
+ *
+ *  \details The standard input is redirected to the input file, it's
+ *  		 read twice to check that the first reader didn't close it.
+ */
+TEST(file_if_test, DashReadsStandardInput)
+{
+	const char * line;
+	unsigned int length;
+	unsigned int round;
+	FILE * handler = fopen(FILE_IF_TEST_INPUT_PATH, "wb");
+
+	fputs("header\npressed 1\nreleased 2\n", handler);
+	fclose(handler);
+	CHECK(freopen(FILE_IF_TEST_INPUT_PATH, "rb", stdin) != NULL);
+
+	for (round = 0; round < 2u; round++)
+	{
+		rewind(stdin);
+		LONGS_EQUAL(FILE_IF_ERROR_OK, File_ReaderOpenMode(&Test_Reader, FILE_IF_STANDARD_STREAM_PATH,
+			Test_Read_Buffer, sizeof(Test_Read_Buffer) - 1, FILE_IF_INPUT_MODE_MAPPED));
+		LONGS_EQUAL(FILE_IF_INPUT_MODE_STREAM, Test_Reader.Mode);
+		LONGS_EQUAL(FILE_IF_ERROR_OK, File_ReaderNextLine(&Test_Reader, &line, &length));
+		LONGS_EQUAL(9, length);
+		LONGS_EQUAL(0, strncmp("pressed 1", line, length));
+		LONGS_EQUAL(FILE_IF_ERROR_OK, File_ReaderNextLine(&Test_Reader, &line, &length));
+		LONGS_EQUAL(10, length);
+		LONGS_EQUAL(0, strncmp("released 2", line, length));
+		LONGS_EQUAL(FILE_IF_ERROR_END_OF_FILE, File_ReaderNextLine(&Test_Reader, &line, &length));
+		File_ReaderClose(&Test_Reader);
+	}
+}
+
+/**
+ *  \brief Test case for reading a named pipe in mapped mode.
+ *
+ *  \details The pipe can't be mapped, it must be opened only once
+ *  		 because the writer ends the pipe when the reader closes it.
+ */
+TEST(file_if_test, MappedReaderStreamsFifo)
+{
+#ifdef FILE_IF_TEST_FIFO_SUPPORTED
+	const char * line;
+	unsigned int length;
+	pthread_t writer;
+
+	remove(FILE_IF_TEST_INPUT_PATH);
+	LONGS_EQUAL(0, mkfifo(FILE_IF_TEST_INPUT_PATH, 0600));
+	LONGS_EQUAL(0, pthread_create(&writer, NULL, WriteFifo, NULL));
+	LONGS_EQUAL(FILE_IF_ERROR_OK, File_ReaderOpenMode(&Test_Reader, FILE_IF_TEST_INPUT_PATH,
+		Test_Read_Buffer, sizeof(Test_Read_Buffer) - 1, FILE_IF_INPUT_MODE_MAPPED));
+	LONGS_EQUAL(FILE_IF_INPUT_MODE_STREAM, Test_Reader.Mode);
+	LONGS_EQUAL(FILE_IF_ERROR_OK, File_ReaderNextLine(&Test_Reader, &line, &length));
+	LONGS_EQUAL(0, strncmp("pressed 1", line, length));
+	LONGS_EQUAL(FILE_IF_ERROR_OK, File_ReaderNextLine(&Test_Reader, &line, &length));
+	LONGS_EQUAL(0, strncmp("released 2", line, length));
+	LONGS_EQUAL(FILE_IF_ERROR_END_OF_FILE, File_ReaderNextLine(&Test_Reader, &line, &length));
+	pthread_join(writer, NULL);
+#endif
+}
+
+/**
+ *  \brief Test case for reading a gzip input file.
+ *
+ *  \details The file is written by zlib in two members and read through
+ *  		 the small block buffer. A mapped compressed file is read in
+ *  		 stream mode. Without FILE_IF_COMPRESS_ENABLED an input file
+ *  		 starting with the gzip magic is rejected.
+ */
+TEST(file_if_test, GzipInputIsDecompressed)
+{
+	char text[FILE_IF_LINE_MAX_LENGTH];
+#ifdef FILE_IF_COMPRESS_ENABLED
+	gzFile input = gzopen(FILE_IF_TEST_GZIP_INPUT_PATH, "wb");
+
+	gzputs(input, "header\npressed 1\n");
+	gzclose(input);
+	input = gzopen(FILE_IF_TEST_GZIP_INPUT_PATH, "ab");	/* Second member */
+	gzputs(input, "released 2\nreleased 3");
+	gzclose(input);
+
+	LONGS_EQUAL(FILE_IF_ERROR_OK, File_ReaderOpenMode(&Test_Reader, FILE_IF_TEST_GZIP_INPUT_PATH,
+		Test_Read_Buffer, sizeof(Test_Read_Buffer) - 1, FILE_IF_INPUT_MODE_MAPPED));
+	LONGS_EQUAL(FILE_IF_COMPRESSION_GZIP, Test_Reader.Compression);
+	LONGS_EQUAL(FILE_IF_INPUT_MODE_STREAM, Test_Reader.Mode);
+	LONGS_EQUAL(FILE_IF_ERROR_OK, ReadInputLine(text));
+	STRCMP_EQUAL("pressed 1", text);
+	LONGS_EQUAL(FILE_IF_ERROR_OK, ReadInputLine(text));
+	STRCMP_EQUAL("released 2", text);
+	LONGS_EQUAL(FILE_IF_ERROR_OK, ReadInputLine(text));
+	STRCMP_EQUAL("released 3", text);
+	LONGS_EQUAL(FILE_IF_ERROR_END_OF_FILE, ReadInputLine(text));
+	LONGS_EQUAL(FILE_IF_ERROR_OK, Test_Reader.Error);
+#else
+	LONGS_EQUAL(FILE_IF_ERROR_UNSUPPORTED, OpenInputFile("\x1F\x8B\x08 header\npressed 1\n"));
+	LONGS_EQUAL(FILE_IF_COMPRESSION_GZIP, Test_Reader.Compression);
+	CHECK(Test_Reader.Handler == NULL && Test_Reader.Map == NULL);
+	LONGS_EQUAL(FILE_IF_ERROR_CAN_NOT_OPEN, ReadInputLine(text));
+#endif
+}
+
+/**
+ *  \brief Test case for reading a truncated gzip input file.
+ *
+ *  \details The file is cut before the end of its member, so reading
+ *  		 it by lines and by chunks stops with an error that is kept
+ *  		 by the reader and isn't the end of the file. Without
+ *  		 FILE_IF_COMPRESS_ENABLED the kept error is the open error.
+ */
+TEST(file_if_test, TruncatedGzipInputIsAnError)
+{
+	char text[FILE_IF_LINE_MAX_LENGTH];
+#ifdef FILE_IF_COMPRESS_ENABLED
+	char compressed[256];
+	gzFile input = gzopen(FILE_IF_TEST_GZIP_INPUT_PATH, "wb");
+	FILE * handler;
+	FileIf_Error_t error;
+	size_t length;
+	unsigned int count;
+	unsigned int index;
+
+	gzputs(input, "header\n");
+	for (index = 0; index < 20u; index++)
+	{
+		gzputs(input, "pressed 1\n");
+	}
+	gzclose(input);
+	handler = fopen(FILE_IF_TEST_GZIP_INPUT_PATH, "rb");
+	length = fread(compressed, 1, sizeof(compressed), handler);
+	fclose(handler);
+	handler = fopen(FILE_IF_TEST_GZIP_INPUT_PATH, "wb");
+	fwrite(compressed, 1, length - 6u, handler);
+	fclose(handler);
+
+	LONGS_EQUAL(FILE_IF_ERROR_OK, File_ReaderOpen(&Test_Reader, FILE_IF_TEST_GZIP_INPUT_PATH,
+		Test_Read_Buffer, sizeof(Test_Read_Buffer) - 1));
+	LONGS_EQUAL(FILE_IF_ERROR_OK, Test_Reader.Error);
+	do
+	{
+		error = ReadInputLine(text);
+	} while (error == FILE_IF_ERROR_OK);
+	LONGS_EQUAL(FILE_IF_ERROR_BAD_FORMAT, error);
+	LONGS_EQUAL(FILE_IF_ERROR_BAD_FORMAT, Test_Reader.Error);
+	File_ReaderClose(&Test_Reader);
+
+	LONGS_EQUAL(FILE_IF_ERROR_OK, File_ReaderOpen(&Test_Reader, FILE_IF_TEST_GZIP_INPUT_PATH,
+		Test_Read_Buffer, sizeof(Test_Read_Buffer) - 1));
+	do
+	{
+		error = File_ReaderReadChunk(&Test_Reader, text, sizeof(text), &count);
+	} while (error == FILE_IF_ERROR_OK);
+	LONGS_EQUAL(FILE_IF_ERROR_BAD_FORMAT, error);
+	LONGS_EQUAL(FILE_IF_ERROR_BAD_FORMAT, Test_Reader.Error);
+#else
+	LONGS_EQUAL(FILE_IF_ERROR_UNSUPPORTED, OpenInputFile("\x1F\x8B\x08 header\npressed 1\n"));
+	LONGS_EQUAL(FILE_IF_ERROR_UNSUPPORTED, Test_Reader.Error);
+	(void)text;
+#endif
+}
+
+/**
+ *  \brief Test case for writing a gzip output file.
+ *
+ *  \details The flushed lines are read by zlib while the writer is
+ *  		 still opened. Without FILE_IF_COMPRESS_ENABLED the output
+ *  		 file isn't created.
+ */
+TEST(file_if_test, GzipOutputIsCompressed)
+{
+#ifdef FILE_IF_COMPRESS_ENABLED
+	char text[64];
+	gzFile output;
+	int length;
+#else
+	FILE * handler;
+#endif
+
+	File_WriterClose(&Test_Writer);
+#ifdef FILE_IF_COMPRESS_ENABLED
+	LONGS_EQUAL(FILE_IF_ERROR_OK, File_WriterOpen(&Test_Writer, FILE_IF_TEST_GZIP_OUTPUT_PATH,
+		Test_Buffer, sizeof(Test_Buffer)));
+	LONGS_EQUAL(FILE_IF_COMPRESSION_GZIP, Test_Writer.Compression);
+	LONGS_EQUAL(FILE_IF_ERROR_OK, File_WriterWriteLine(&Test_Writer, 1));
+	LONGS_EQUAL(FILE_IF_ERROR_OK, File_WriterWriteLine(&Test_Writer, -2));
+	LONGS_EQUAL(FILE_IF_ERROR_OK, File_WriterFlush(&Test_Writer));
+
+	output = gzopen(FILE_IF_TEST_GZIP_OUTPUT_PATH, "rb");
+	length = gzread(output, text, sizeof(text) - 1);
+	gzclose(output);
+	text[(length > 0) ? length : 0] = 0;
+	STRCMP_EQUAL(FILE_IF_OUTPUT_FILE_HEADER "1\n-2\n", text);
+
+	LONGS_EQUAL(FILE_IF_ERROR_OK, File_WriterWriteRepeat(&Test_Writer, 3, 2u));
+	LONGS_EQUAL(FILE_IF_ERROR_OK, File_WriterClose(&Test_Writer));
+	output = gzopen(FILE_IF_TEST_GZIP_OUTPUT_PATH, "rb");
+	length = gzread(output, text, sizeof(text) - 1);
+	LONGS_EQUAL(1, gzeof(output));
+	gzclose(output);
+	text[(length > 0) ? length : 0] = 0;
+	STRCMP_EQUAL(FILE_IF_OUTPUT_FILE_HEADER "1\n-2\n3\n3\n", text);
+
+	LONGS_EQUAL(FILE_IF_ERROR_OK, File_ReaderOpen(&Test_Reader, FILE_IF_TEST_GZIP_OUTPUT_PATH,
+		Test_Read_Buffer, sizeof(Test_Read_Buffer) - 1));
+	LONGS_EQUAL(FILE_IF_ERROR_OK, ReadInputLine(text));
+	STRCMP_EQUAL("1", text);
+	LONGS_EQUAL(FILE_IF_ERROR_OK, ReadInputLine(text));
+	STRCMP_EQUAL("-2", text);
+#else
+	LONGS_EQUAL(FILE_IF_ERROR_UNSUPPORTED, File_WriterOpen(&Test_Writer, FILE_IF_TEST_GZIP_OUTPUT_PATH,
+		Test_Buffer, sizeof(Test_Buffer)));
+	handler = fopen(FILE_IF_TEST_GZIP_OUTPUT_PATH, "rb");
+	CHECK(handler == NULL);
+#endif
+}
+
+/**
+ *  \brief Test case for zstd files.
+ *
+ *  \details Without FILE_IF_COMPRESS_ENABLED and FILE_IF_ZSTD_ENABLED
+ *  		 the output file isn't created and an input file starting with the zstd magic is rejected.
+ */
+TEST(file_if_test, ZstdNeedsTheLibrary)
+{
+	char text[FILE_IF_LINE_MAX_LENGTH];
+	FILE * handler;
+
+	File_WriterClose(&Test_Writer);
+#if defined(FILE_IF_COMPRESS_ENABLED) && defined(FILE_IF_ZSTD_ENABLED)
+	LONGS_EQUAL(FILE_IF_ERROR_OK, File_WriterOpen(&Test_Writer, FILE_IF_TEST_ZSTD_OUTPUT_PATH,
+		Test_Buffer, sizeof(Test_Buffer)));
+	LONGS_EQUAL(FILE_IF_ERROR_OK, File_WriterWriteLine(&Test_Writer, 5));
+	LONGS_EQUAL(FILE_IF_ERROR_OK, File_WriterWriteRepeat(&Test_Writer, -7, 40u));
+	LONGS_EQUAL(FILE_IF_ERROR_OK, File_WriterClose(&Test_Writer));
+	LONGS_EQUAL(FILE_IF_ERROR_OK, File_ReaderOpen(&Test_Reader, FILE_IF_TEST_ZSTD_OUTPUT_PATH,
+		Test_Read_Buffer, sizeof(Test_Read_Buffer) - 1));
+	LONGS_EQUAL(FILE_IF_COMPRESSION_ZSTD, Test_Reader.Compression);
+	LONGS_EQUAL(FILE_IF_ERROR_OK, ReadInputLine(text));
+	STRCMP_EQUAL("5", text);
+	LONGS_EQUAL(FILE_IF_ERROR_OK, ReadInputLine(text));
+	STRCMP_EQUAL("-7", text);
+	(void)handler;
+#else
+	LONGS_EQUAL(FILE_IF_ERROR_UNSUPPORTED, File_WriterOpen(&Test_Writer, FILE_IF_TEST_ZSTD_OUTPUT_PATH,
+		Test_Buffer, sizeof(Test_Buffer)));
+	handler = fopen(FILE_IF_TEST_ZSTD_OUTPUT_PATH, "rb");
+	CHECK(handler == NULL);
+	LONGS_EQUAL(FILE_IF_ERROR_UNSUPPORTED, OpenInputFile("\x28\xB5\x2F\xFD header\npressed 1\n"));
+	LONGS_EQUAL(FILE_IF_COMPRESSION_ZSTD, Test_Reader.Compression);
+	CHECK(Test_Reader.Handler == NULL && Test_Reader.Map == NULL);
+	LONGS_EQUAL(FILE_IF_ERROR_CAN_NOT_OPEN, ReadInputLine(text));
+	LONGS_EQUAL(FILE_IF_ERROR_UNSUPPORTED, File_ReaderOpenMode(&Test_Reader, FILE_IF_TEST_INPUT_PATH,
+		Test_Read_Buffer, sizeof(Test_Read_Buffer) - 1, FILE_IF_INPUT_MODE_MAPPED));
+	CHECK(Test_Reader.Handler == NULL && Test_Reader.Map == NULL);
+	LONGS_EQUAL(FILE_IF_ERROR_CAN_NOT_OPEN, ReadInputLine(text));
+#endif
+}
+/**
+ *  @}
+ */
+
+/**
+ *  \brief Test code runner for all test cases of File If module.
+ */
+TEST_GROUP_RUNNER(file_if_test)
+{
+    printf("======================= Testing File If Module =======================\n\n");
+    RUN_TEST_CASE(file_if_test, WriterKeepsLinesUntilFlush);
+    RUN_TEST_CASE(file_if_test, WriterFlushesEveryNLines);
+    RUN_TEST_CASE(file_if_test, WriterFlushesWhenBufferIsFull);
+    RUN_TEST_CASE(file_if_test, WriterRejectsWritingAfterClose);
+    RUN_TEST_CASE(file_if_test, ReaderSkipsHeaderAndReadsLines);
+    RUN_TEST_CASE(file_if_test, ReaderReadsLastLineWithoutNewLine);
+    RUN_TEST_CASE(file_if_test, ReaderSkipsEmptyLines);
+    RUN_TEST_CASE(file_if_test, ReaderCanNotOpenMissingFile);
+    RUN_TEST_CASE(file_if_test, MappedReaderReadsLines);
+    RUN_TEST_CASE(file_if_test, RunLengthOutputIsDecodedToTheSameLines);
+    RUN_TEST_CASE(file_if_test, BadRunsAreDetected);
+    RUN_TEST_CASE(file_if_test, WriterRepeatIsTheSameAsLines);
+    RUN_TEST_CASE(file_if_test, DashReadsStandardInput);
+    RUN_TEST_CASE(file_if_test, MappedReaderStreamsFifo);
+    RUN_TEST_CASE(file_if_test, GzipInputIsDecompressed);
+    RUN_TEST_CASE(file_if_test, TruncatedGzipInputIsAnError);
+    RUN_TEST_CASE(file_if_test, GzipOutputIsCompressed);
+    RUN_TEST_CASE(file_if_test, ZstdNeedsTheLibrary);
+    printf("\n==================== Testing File If  Module Done ====================\n\n\n");
+}
@@ -0,0 +1,185 @@
+/**
+ *  \file	fleet_test.c
+ *  \brief	This file includes test cases for testing Fleet module.
+ *  \author Ahmed Wageh
+ */
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <direct.h>
+/** Creates a directory */
+#define FLEET_TEST_MKDIR(path)	_mkdir(path)
+#else
+#include <unistd.h>
+/** Creates a directory */
+#define FLEET_TEST_MKDIR(path)	mkdir(path, 0755)
+#endif
+#include "../../source/Fleet/Fleet.h"
+#include "../../source/File If/FileIf.h"
+#include "../unity/unity_fixture.h"
+
+/** The input directory used by the test cases */
+#define FLEET_TEST_DIR		"fleet_test_units"
+/** The number of devices in the input directory */
+#define FLEET_TEST_DEVICES	5
+
+/* Test group declaration */
+TEST_GROUP(fleet_test);
+
+/** The input files of the devices, the last directory has no input file */
+static const char * Test_Input[FLEET_TEST_DEVICES] =
+{
+	"header\npre_pressed released released 0\npre_pressed released released 0\n",
+	"header\nreleased pre_pressed released 0\n",
+	"header\nreleased released pressed 90000\nreleased released released 0\npre_pressed released released 0\n",
+	"header\n",
+	NULL
+};
+/** The expected output files of the devices */
+static const char * Test_Output[FLEET_TEST_DEVICES] =
+{
+	FILE_IF_OUTPUT_FILE_HEADER "91\n92\n",
+	FILE_IF_OUTPUT_FILE_HEADER "89\n",
+	FILE_IF_OUTPUT_FILE_HEADER "87\n87\n88\n",
+	FILE_IF_OUTPUT_FILE_HEADER,
+	NULL
+};
+
+/**
+ *  \brief Gets the path of a file of a device.
+ *
+ *  \param [out] Path the path.
+ *  \param [in] Index the index of the device.
+ *  \param [in] Name the file name or NULL for the device directory.
+ */
+static void GetPath(char * Path, int Index, const char * Name)
+{
+	sprintf(Path, FLEET_TEST_DIR "/unit%d%s%s", Index, (Name == NULL) ? "" : "/", (Name == NULL) ? "" : Name);
+}
+
+/**
+ *  \brief Reads a whole file.
+ *
+ *  \param [in] Path the path of the file.
+ *  \param [out] Text the file content as a string.
+ *  \param [in] Size the size of \p Text.
+ */
+static void ReadFile(const char * Path, char * Text, unsigned int Size)
+{
+	FILE * handler = fopen(Path, "rb");
+	size_t length = 0;
+
+	if (handler != NULL)
+	{
+		length = fread(Text, 1, Size - 1, handler);
+		fclose(handler);
+	}
+	Text[length] = 0;
+}
+
+/* fleet_test group setup and tear_down function */
+TEST_SETUP(fleet_test)
+{
+	char path[64];
+	FILE * handler;
+	int index;
+
+	FLEET_TEST_MKDIR(FLEET_TEST_DIR);
+	for (index = 0; index < FLEET_TEST_DEVICES; index++)
+	{
+		GetPath(path, index, NULL);
+		FLEET_TEST_MKDIR(path);
+		if (Test_Input[index] != NULL)
+		{
+			GetPath(path, index, "switches.txt");
+			handler = fopen(path, "wb");
+			fputs(Test_Input[index], handler);
+			fclose(handler);
+		}
+	}
+}
+
+TEST_TEAR_DOWN(fleet_test)
+{
+	char path[64];
+	int index;
+
+	for (index = 0; index < FLEET_TEST_DEVICES; index++)
+	{
+		GetPath(path, index, "switches.txt");
+		remove(path);
+		GetPath(path, index, "motor.txt");
+		remove(path);
+		GetPath(path, index, NULL);
+		rmdir(path);
+	}
+	rmdir(FLEET_TEST_DIR);
+}
+
+/**
+ *  \defgroup fleet_test_cases Fleet module test cases
+ *  This is for testing the functionality of Fleet module
+ *
+ *  \details It tests the following test cases:
+ *  	-	FleetReplaysEveryDevice: Every device with an input file gets
+ *  		its own output file with any number of workers.
+ *  	-	FleetCanNotOpenMissingDir: A missing input directory returns
+ *  		#FLEET_ERROR_CAN_NOT_OPEN_DIR.
+ *  @{
+ */
+
+/**
+ *  \brief Test case for replaying a directory of devices.
+ *
+ *  \details It's replayed by 1 worker, by more workers than devices
+ *  		 and by a worker for every core.
+ */
+TEST(fleet_test, FleetReplaysEveryDevice)
+{
+	static const unsigned int workers[] = {1, 8, 0};
+	Fleet_Result_t result;
+	char path[64];
+	char text[128];
+	unsigned int run;
+	int index;
+
+	for (run = 0; run < sizeof(workers) / sizeof(workers[0]); run++)
+	{
+		LONGS_EQUAL(FLEET_ERROR_OK, Fleet_Run(FLEET_TEST_DIR, workers[run], &result));
+		LONGS_EQUAL(FLEET_TEST_DEVICES - 1, result.Devices);
+		LONGS_EQUAL(0, result.Failed);
+		LONGS_EQUAL(6, result.Lines);
+		for (index = 0; index < FLEET_TEST_DEVICES; index++)
+		{
+			GetPath(path, index, "motor.txt");
+			ReadFile(path, text, sizeof(text));
+			STRCMP_EQUAL((Test_Output[index] == NULL) ? "" : Test_Output[index], text);
+		}
+	}
+}
+
+/**
+ *  \brief Test case for replaying a missing directory.
+ */
+TEST(fleet_test, FleetCanNotOpenMissingDir)
+{
+	Fleet_Result_t result;
+
+	LONGS_EQUAL(FLEET_ERROR_CAN_NOT_OPEN_DIR, Fleet_Run(FLEET_TEST_DIR "/missing", 2, &result));
+	LONGS_EQUAL(0, result.Devices);
+}
+/**
+ *  @}
+ */
+
+/**
+ *  \brief Test code runner for all test cases of Fleet module.
+ */
+TEST_GROUP_RUNNER(fleet_test)
+{
+    printf("======================= Testing Fleet Module =======================\n\n");
+    RUN_TEST_CASE(fleet_test, FleetReplaysEveryDevice);
+    RUN_TEST_CASE(fleet_test, FleetCanNotOpenMissingDir);
+    printf("\n==================== Testing Fleet  Module Done ====================\n\n\n");
+}
@@ -0,0 +1,225 @@
+/**
+ *  \file	generate_test.c
+ *  \brief	This file includes test cases for testing Generate module.
+ *  \author Ahmed Wageh
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../../source/Generate/Generate.h"
+#include "../../source/Parse/Parse.h"
+#include "../replay helper/replay_helper.h"
+#include "../unity/unity_fixture.h"
+
+/** The output file of one worker used by the test cases */
+#define GENERATE_TEST_SERIAL	"generate_test_serial.txt"
+/** The output file of many workers used by the test cases */
+#define GENERATE_TEST_PARALLEL	"generate_test_parallel.txt"
+/** The number of lines of every generated chunk */
+#define GENERATE_TEST_LINES		2000u
+/** The number of lines of every chunk of the generated files */
+#define GENERATE_TEST_CHUNK_LINES	100u
+/** The number of lines of the generated files, the last chunk isn't full */
+#define GENERATE_TEST_FILE_LINES	1050u
+
+/* Test group declaration */
+TEST_GROUP(generate_test);
+
+/** The model used by the test cases */
+static Generate_Config_t Test_Config;
+/** The generated lines */
+static char Test_Lines[GENERATE_TEST_LINES * GENERATE_MAX_LINE_SIZE];
+/** Other generated lines */
+static char Test_Other_Lines[GENERATE_TEST_LINES * GENERATE_MAX_LINE_SIZE];
+
+/**
+ *  \brief Sets the same probability of leaving every state.
+ *
+ *  \param [in] Leave the probability.
+ */
+static void SetLeave(double Leave)
+{
+	unsigned int id;
+	unsigned int state;
+
+	for (id = 0; id < GENERATE_SWITCHES; id++)
+	{
+		for (state = SWITCH_PRE_PRESSED; state < GENERATE_STATES; state++)
+		{
+			Test_Config.Leave[id][state] = Leave;
+		}
+	}
+}
+
+TEST_SETUP(generate_test)
+{
+	Generate_DefaultConfig(&Test_Config);
+}
+
+TEST_TEAR_DOWN(generate_test)
+{
+	remove(GENERATE_TEST_SERIAL);
+	remove(GENERATE_TEST_PARALLEL);
+}
+
+/**
+ *  \defgroup generate_test_cases Generate module test cases
+ *  This is for testing the functionality of Generate module
+ *
+ *  \details It tests the following test cases:
+ *  	-	ChunksAreReproducible: The same seed and chunk give the same
+ *  		lines, another seed or chunk gives other lines.
+ *  	-	LinesFollowTheButtonCycle: Every line is parsed and every
+ *  		switch stays or goes to the next state of a button.
+ *  	-	ProbabilitiesAreApplied: Switches never or always leave
+ *  		their states.
+ *  	-	FileIsTheSameForAnyWorkers: One and many workers write the
+ *  		same file.
+ *  @{
+ */
+/**
+ *  \brief Test case for generating a chunk twice.
+ */
+TEST(generate_test, ChunksAreReproducible)
+{
+	unsigned int size;
+
+	size = Generate_Chunk(&Test_Config, 3u, GENERATE_TEST_LINES, Test_Lines);
+	LONGS_EQUAL(size, Generate_Chunk(&Test_Config, 3u, GENERATE_TEST_LINES, Test_Other_Lines));
+	CHECK(memcmp(Test_Lines, Test_Other_Lines, size) == 0);
+
+	CHECK(Generate_Chunk(&Test_Config, 4u, GENERATE_TEST_LINES, Test_Other_Lines) != size ||
+		memcmp(Test_Lines, Test_Other_Lines, size) != 0);
+	Test_Config.Seed++;
+	CHECK(Generate_Chunk(&Test_Config, 3u, GENERATE_TEST_LINES, Test_Other_Lines) != size ||
+		memcmp(Test_Lines, Test_Other_Lines, size) != 0);
+}
+
+/**
+ *  \brief Test case for parsing the generated lines.
+ *
+ *  \details The press time of "p" switch is 0 unless it's pressed and
+ *  		 grows by the tick time while it's still pressed.
+ */
+TEST(generate_test, LinesFollowTheButtonCycle)
+{
+	static const Switches_States_t next[GENERATE_STATES] =
+	{
+		SWITCH_ERROR, SWITCH_PRESSED, SWITCH_PRE_RELEASED, SWITCH_PRE_PRESSED, SWITCH_RELEASED
+	};
+	Switches_States_t last[GENERATE_SWITCHES] = {SWITCH_RELEASED, SWITCH_RELEASED, SWITCH_RELEASED};
+	Switches_States_t states[GENERATE_SWITCHES];
+	Parse_Record_t record;
+	unsigned int size;
+	unsigned int start = 0;
+	unsigned int end;
+	unsigned int id;
+	unsigned int pressed = 0;
+	int duration = 0;
+
+	SetLeave(0.5);
+	size = Generate_Chunk(&Test_Config, 0u, GENERATE_TEST_LINES, Test_Lines);
+	for (end = 0; end < size; end++)
+	{
+		if (Test_Lines[end] == '\n')
+		{
+			LONGS_EQUAL(PARSE_ERROR_OK, ParseRecord(Test_Lines + start, end - start, &record));
+			states[SWITCH_INCREMENT] = record.Inc_Switch;
+			states[SWITCH_DECREMENT] = record.Dec_Switch;
+			states[SWITCH_P] = record.P_Switch;
+			for (id = 0; id < GENERATE_SWITCHES; id++)
+			{
+				CHECK(states[id] == last[id] || states[id] == next[last[id]]);
+				last[id] = states[id];
+			}
+			duration = (record.P_Switch == SWITCH_PRESSED && pressed) ? duration + (int)Test_Config.Tick_Ms : 0;
+			pressed = (record.P_Switch == SWITCH_PRESSED);
+			LONGS_EQUAL(duration, record.P_Duration);
+			start = end + 1u;
+		}
+	}
+	LONGS_EQUAL(size, start);
+}
+
+/**
+ *  \brief Test case for the lowest and the highest probabilities.
+ */
+TEST(generate_test, ProbabilitiesAreApplied)
+{
+	static const char * cycle[] =
+	{
+		PRE_PRESSED_TEXT "\t\t\t" PRE_PRESSED_TEXT "\t\t\t" PRE_PRESSED_TEXT "\t\t\t0\n",
+		PRESSED_TEXT "\t\t\t\t" PRESSED_TEXT "\t\t\t\t" PRESSED_TEXT "\t\t\t\t0\n",
+		PRE_RELEASED_TEXT "\t\t" PRE_RELEASED_TEXT "\t\t" PRE_RELEASED_TEXT "\t\t0\n",
+		RELEASED_TEXT "\t\t\t" RELEASED_TEXT "\t\t\t" RELEASED_TEXT "\t\t\t0\n"
+	};
+	char expected[GENERATE_MAX_LINE_SIZE * 8u] = "";
+	unsigned int index;
+
+	SetLeave(0.0);
+	Test_Lines[Generate_Chunk(&Test_Config, 5u, 2u, Test_Lines)] = 0;
+	STRCMP_EQUAL(RELEASED_TEXT "\t\t\t" RELEASED_TEXT "\t\t\t" RELEASED_TEXT "\t\t\t0\n"
+		RELEASED_TEXT "\t\t\t" RELEASED_TEXT "\t\t\t" RELEASED_TEXT "\t\t\t0\n", Test_Lines);
+
+	SetLeave(1.0);
+	for (index = 0; index < 8u; index++)
+	{
+		strcat(expected, cycle[index % 4u]);
+	}
+	Test_Lines[Generate_Chunk(&Test_Config, 5u, 8u, Test_Lines)] = 0;
+	STRCMP_EQUAL(expected, Test_Lines);
+}
+
+/**
+ *  \brief Test case for generating a file by one and many workers.
+ */
+TEST(generate_test, FileIsTheSameForAnyWorkers)
+{
+	unsigned long long serialSize;
+	unsigned long long parallelSize;
+	long serialLength;
+	long parallelLength;
+	char * serial;
+	char * parallel;
+	unsigned int lines = 0;
+	long index;
+
+	Test_Config.Chunk_Lines = GENERATE_TEST_CHUNK_LINES;
+	LONGS_EQUAL(GENERATE_ERROR_OK, Generate_File(GENERATE_TEST_SERIAL, GENERATE_TEST_FILE_LINES, &Test_Config,
+		1u, &serialSize));
+	LONGS_EQUAL(GENERATE_ERROR_OK, Generate_File(GENERATE_TEST_PARALLEL, GENERATE_TEST_FILE_LINES, &Test_Config,
+		4u, &parallelSize));
+	serial = REPLAY_ReadFile(GENERATE_TEST_SERIAL, &serialLength);
+	parallel = REPLAY_ReadFile(GENERATE_TEST_PARALLEL, &parallelLength);
+
+	LONGS_EQUAL(serialLength, (long)serialSize);
+	LONGS_EQUAL(serialLength, parallelLength);
+	CHECK(memcmp(serial, parallel, (size_t)serialLength) == 0);
+	CHECK(strncmp(serial, GENERATE_HEADER, sizeof(GENERATE_HEADER) - 1u) == 0);
+	for (index = 0; index < serialLength; index++)
+	{
+		lines += (serial[index] == '\n');
+	}
+	LONGS_EQUAL(GENERATE_TEST_FILE_LINES + 1u, lines);
+
+	free(serial);
+	free(parallel);
+	LONGS_EQUAL(GENERATE_ERROR_CAN_NOT_WRITE, Generate_File("generate_test_missing/switches.txt", 1u,
+		&Test_Config, 1u, &serialSize));
+}
+/**
+ *  @}
+ */
+
+/**
+ *  \brief Test code runner for all test cases of Generate module.
+ */
+TEST_GROUP_RUNNER(generate_test)
+{
+    printf("===================== Testing Generate Module ======================\n\n");
+    RUN_TEST_CASE(generate_test, ChunksAreReproducible);
+    RUN_TEST_CASE(generate_test, LinesFollowTheButtonCycle);
+    RUN_TEST_CASE(generate_test, ProbabilitiesAreApplied);
+    RUN_TEST_CASE(generate_test, FileIsTheSameForAnyWorkers);
+    printf("\n================== Testing Generate  Module Done ===================\n\n\n");
+}
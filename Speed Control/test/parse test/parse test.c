@@ -9,9 +9,11 @@
  */
 #include <stdio.h>
 #include <string.h>
+#include <limits.h>
 
 /* Include tested module header file */
 #include "../../source/Parse/Parse.h"
+#include "../../source/Parse/ParseScan.h"
 
 /* Include Unity */
 #include "../unity/unity_fixture.h"
@@ -46,6 +48,22 @@ TEST_TEAR_DOWN(parseing_test)
  *  		of "P" switch from text line correctly, when it's more than 1 digit.
  *  	-	getting_p_duration_Negative_Number: To get the pressing duration 
  *  		of "P" switch from text line correctly, when it's negative number.
+ *  	-	parsing_record_in_one_pass: To get all fields of the text line
+ *  		in one call.
+ *  	-	parsing_record_reports_failed_column: To get the first column
+ *  		that couldn't be parsed.
+ *  	-	parsing_record_reports_missing_duration: To get an error when
+ *  		the duration has no digits.
+ *  	-	parsing_record_stops_at_length: To make sure that parsing doesn't
+ *  		go beyond the given length of the line.
+ *  	-	switch_state_text_is_exact: To make sure that every switch state
+ *  		text is recognized and near misses are rejected.
+ *  	-	scanning_levels_agree: To make sure that SSE2 and AVX2 scanning
+ *  		find the same field boundaries as byte by byte scanning.
+ *  	-	duration_reports_overflow: To get an error and a saturated value
+ *  		when the duration is out of int range.
+ *  	-	duration_of_every_width: To decode durations of 1 to 10 digits
+ *  		followed by any character.
  *  @{
  */
 /**
@@ -177,6 +195,206 @@ TEST(parseing_test, getting_p_duration_Negative_Number)
 
     LONGS_EQUAL(expected_duration, ParsePDuaration(text));
 }
+/**
+ *  \brief	Test case for parsing all fields of a text line in one call.
+ *  
+ *  \details Here we pass a text line with the same format as the input
+ *  		 text file and expect every field of \ref Parse_Record_t to be
+ *  		 decoded and #PARSE_ERROR_OK to be returned.
+ */
+TEST(parseing_test, parsing_record_in_one_pass)
+{
+    /* Needed variables */
+    Parse_Record_t record;
+    char text[] = "pre_released			released			pressed				-12754";    /* Creating a line of text */
+
+    LONGS_EQUAL(PARSE_ERROR_OK, ParseRecord(text, strlen(text), &record));
+    LONGS_EQUAL(SWITCH_PRE_RELEASED, record.Inc_Switch);
+    LONGS_EQUAL(SWITCH_RELEASED, record.Dec_Switch);
+    LONGS_EQUAL(SWITCH_PRESSED, record.P_Switch);
+    LONGS_EQUAL(-12754, record.P_Duration);
+}
+
+/**
+ *  \brief	Test case for parsing a text line with unexpected text.
+ *  
+ *  \details The "-ve" switch state is "pressedx", so we expect
+ *  		 #PARSE_ERROR_DEC_SWITCH and the other columns still parsed.
+ */
+TEST(parseing_test, parsing_record_reports_failed_column)
+{
+    /* Needed variables */
+    Parse_Record_t record;
+    char text[] = "released			pressedx			rel				30000";    /* Creating a line of text */
+
+    LONGS_EQUAL(PARSE_ERROR_DEC_SWITCH, ParseRecord(text, strlen(text), &record));
+    LONGS_EQUAL(SWITCH_RELEASED, record.Inc_Switch);
+    LONGS_EQUAL(SWITCH_ERROR, record.Dec_Switch);
+    LONGS_EQUAL(SWITCH_ERROR, record.P_Switch);
+    LONGS_EQUAL(30000, record.P_Duration);
+}
+
+/**
+ *  \brief	Test case for parsing a text line without duration digits.
+ */
+TEST(parseing_test, parsing_record_reports_missing_duration)
+{
+    /* Needed variables */
+    Parse_Record_t record;
+    char text[] = "released			released			pressed				-";    /* Creating a line of text */
+
+    LONGS_EQUAL(PARSE_ERROR_P_DURATION, ParseRecord(text, strlen(text), &record));
+    LONGS_EQUAL(0, record.P_Duration);
+}
+
+/**
+ *  \brief	Test case for parsing only a part of a text line.
+ *  
+ *  \details The length ends the line before the duration, so the
+ *  		 duration after it must not be parsed.
+ */
+TEST(parseing_test, parsing_record_stops_at_length)
+{
+    /* Needed variables */
+    Parse_Record_t record;
+    char text[] = "released released pressed 30000";    /* Creating a line of text */
+
+    LONGS_EQUAL(PARSE_ERROR_P_DURATION, ParseRecord(text, 26, &record));
+    LONGS_EQUAL(SWITCH_PRESSED, record.P_Switch);
+    LONGS_EQUAL(0, record.P_Duration);
+    LONGS_EQUAL(PARSE_ERROR_P_SWITCH, ParseRecord(text, 21, &record));
+}
+/**
+ *  \brief	Test case for recognizing the switch state texts.
+ *  
+ *  \details Every text in \ref Switches_text gives its state while texts
+ *  		 that share its length or its start give #SWITCH_ERROR.
+ */
+TEST(parseing_test, switch_state_text_is_exact)
+{
+    LONGS_EQUAL(SWITCH_PRE_PRESSED, ParseSwitchState(PRE_PRESSED_TEXT, strlen(PRE_PRESSED_TEXT)));
+    LONGS_EQUAL(SWITCH_PRESSED, ParseSwitchState(PRESSED_TEXT, strlen(PRESSED_TEXT)));
+    LONGS_EQUAL(SWITCH_RELEASED, ParseSwitchState(RELEASED_TEXT, strlen(RELEASED_TEXT)));
+    LONGS_EQUAL(SWITCH_PRE_RELEASED, ParseSwitchState(PRE_RELEASED_TEXT, strlen(PRE_RELEASED_TEXT)));
+
+    LONGS_EQUAL(SWITCH_ERROR, ParseSwitchState("pressedx", 8));
+    LONGS_EQUAL(SWITCH_ERROR, ParseSwitchState("pressex", 7));
+    LONGS_EQUAL(SWITCH_ERROR, ParseSwitchState("xressed", 7));
+    LONGS_EQUAL(SWITCH_ERROR, ParseSwitchState("prassed", 7));
+    LONGS_EQUAL(SWITCH_ERROR, ParseSwitchState("pre_releasex", 12));
+    LONGS_EQUAL(SWITCH_ERROR, ParseSwitchState("pre_pressedd", 12));
+    LONGS_EQUAL(SWITCH_ERROR, ParseSwitchState("press", 5));
+    LONGS_EQUAL(SWITCH_ERROR, ParseSwitchState("", 0));
+}
+
+/**
+ *  \brief	Test case for scanning with every \ref ParseScan_Level_t.
+ *  
+ *  \details Every part of a wide line is scanned by every level supported
+ *  		 by the CPU and compared with #PARSE_SCAN_LEVEL_SCALAR.
+ */
+TEST(parseing_test, scanning_levels_agree)
+{
+    const char line[] = "\t\t \xE0x_released\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t"
+                        "pre_pressed\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t"
+                        "abcdefghijklmnopqrstuvwxyz_0123456789{`/:\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t-1200";
+    unsigned int length = sizeof(line) - 1;
+    unsigned int skipState[sizeof(line)];
+    unsigned int skipDuration[sizeof(line)];
+    unsigned int textLength[sizeof(line)];
+    ParseScan_Level_t level;
+    unsigned int start;
+
+    ParseScan_SelectLevel(PARSE_SCAN_LEVEL_SCALAR);
+    for (start = 0; start <= length; start++)
+    {
+        skipState[start] = ParseScan_SkipToState(line + start, length - start);
+        skipDuration[start] = ParseScan_SkipToDuration(line + start, length - start);
+        textLength[start] = ParseScan_TextLength(line + start, length - start);
+    }
+
+    for (level = PARSE_SCAN_LEVEL_SSE2; level <= ParseScan_GetBestLevel(); level++)
+    {
+        LONGS_EQUAL(level, ParseScan_SelectLevel(level));
+        for (start = 0; start <= length; start++)
+        {
+            LONGS_EQUAL(skipState[start], ParseScan_SkipToState(line + start, length - start));
+            LONGS_EQUAL(skipDuration[start], ParseScan_SkipToDuration(line + start, length - start));
+            LONGS_EQUAL(textLength[start], ParseScan_TextLength(line + start, length - start));
+        }
+        /* The scanning never goes beyond the given length */
+        LONGS_EQUAL(3, ParseScan_SkipToState(line, 3));
+        LONGS_EQUAL(60, ParseScan_SkipToDuration(line, 60));
+    }
+
+    ParseScan_SelectLevel(ParseScan_GetBestLevel());
+}
+
+/**
+ *  \brief	Test case for a duration out of int range (BVA).
+ */
+TEST(parseing_test, duration_reports_overflow)
+{
+    /* Needed variables */
+    int duration = 0;
+
+    LONGS_EQUAL(PARSE_ERROR_OK, ParseDuration("2147483647\n", 11, &duration));
+    LONGS_EQUAL(INT_MAX, duration);
+    LONGS_EQUAL(PARSE_ERROR_P_DURATION_OVERFLOW, ParseDuration("2147483648", 10, &duration));
+    LONGS_EQUAL(INT_MAX, duration);
+    LONGS_EQUAL(PARSE_ERROR_OK, ParseDuration("-2147483648", 11, &duration));
+    LONGS_EQUAL(INT_MIN, duration);
+    LONGS_EQUAL(PARSE_ERROR_P_DURATION_OVERFLOW, ParseDuration("-2147483649", 11, &duration));
+    LONGS_EQUAL(INT_MIN, duration);
+    LONGS_EQUAL(PARSE_ERROR_P_DURATION_OVERFLOW, ParseDuration("99999999999999999999999999", 26, &duration));
+    LONGS_EQUAL(INT_MAX, duration);
+    /* Leading zeros don't overflow */
+    LONGS_EQUAL(PARSE_ERROR_OK, ParseDuration("000000000000000000030000", 24, &duration));
+    LONGS_EQUAL(30000, duration);
+    LONGS_EQUAL(PARSE_ERROR_P_DURATION, ParseDuration("-", 1, &duration));
+    LONGS_EQUAL(0, duration);
+    LONGS_EQUAL(PARSE_ERROR_P_DURATION, ParseDuration("x30000", 6, &duration));
+    LONGS_EQUAL(0, duration);
+}
+
+/**
+ *  \brief	Test case for durations of every width (EP).
+ *  
+ *  \details Every value is followed by another character and more
+ *  		 digits that are out of the given length.
+ */
+TEST(parseing_test, duration_of_every_width)
+{
+    /* Needed variables */
+    static const int values[] =
+    {
+        0, 7, 71, 712, 7123, 71234, 712345, 7123456, 71234567, 99999999,
+        100000000, 712345678, 1000000000, 2147483647
+    };
+    static const char endings[] = "\n\t :/x-";
+    char text[32];
+    int duration;
+    int length;
+    unsigned int value;
+    unsigned int ending;
+
+    for (value = 0; value < sizeof(values) / sizeof(values[0]); value++)
+    {
+        for (ending = 0; ending < sizeof(endings); ending++)
+        {
+            length = sprintf(text, "%d%c12345678", values[value], endings[ending]);
+            LONGS_EQUAL(PARSE_ERROR_OK, ParseDuration(text, length, &duration));
+            LONGS_EQUAL(values[value], duration);
+            length = sprintf(text, "-%d%c12345678", values[value], endings[ending]);
+            LONGS_EQUAL(PARSE_ERROR_OK, ParseDuration(text, length, &duration));
+            LONGS_EQUAL(-values[value], duration);
+        }
+        /* The value at the end of the text */
+        length = sprintf(text, "%d", values[value]);
+        LONGS_EQUAL(PARSE_ERROR_OK, ParseDuration(text, length, &duration));
+        LONGS_EQUAL(values[value], duration);
+    }
+}
 /**
  *  @}
  */
@@ -193,5 +411,13 @@ TEST_GROUP_RUNNER(parseing_test)
     RUN_TEST_CASE(parseing_test, getting_p_duration_correctly);
     RUN_TEST_CASE(parseing_test, getting_p_duration_MULTI_DIGIT_NUMBER);
     RUN_TEST_CASE(parseing_test, getting_p_duration_Negative_Number);
+    RUN_TEST_CASE(parseing_test, parsing_record_in_one_pass);
+    RUN_TEST_CASE(parseing_test, parsing_record_reports_failed_column);
+    RUN_TEST_CASE(parseing_test, parsing_record_reports_missing_duration);
+    RUN_TEST_CASE(parseing_test, parsing_record_stops_at_length);
+    RUN_TEST_CASE(parseing_test, switch_state_text_is_exact);
+    RUN_TEST_CASE(parseing_test, scanning_levels_agree);
+    RUN_TEST_CASE(parseing_test, duration_reports_overflow);
+    RUN_TEST_CASE(parseing_test, duration_of_every_width);
     printf("\n==================== Testing Parse  Module Done ====================\n\n\n");
 }
@@ -0,0 +1,127 @@
+/**
+ *  \file	pipeline_test.c
+ *  \brief	This file includes test cases for testing Pipeline module.
+ *  \author Ahmed Wageh
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../../source/Pipeline/Pipeline.h"
+#include "../replay helper/replay_helper.h"
+#include "../unity/unity_fixture.h"
+
+/** The input file used by the test cases */
+#define PIPELINE_TEST_INPUT		"pipeline_test_switches.txt"
+/** The output file of replaying line by line */
+#define PIPELINE_TEST_SERIAL	"pipeline_test_motor_serial.txt"
+/** The output file of replaying by the pipeline */
+#define PIPELINE_TEST_PIPELINED	"pipeline_test_motor_pipelined.txt"
+/** The number of input lines, some batches and a part of a batch */
+#define PIPELINE_TEST_LINES		(3u * PIPELINE_BATCH_LINES + 5u)
+
+/* Test group declaration */
+TEST_GROUP(pipeline_test);
+
+/* pipeline_test group setup and tear_down function */
+TEST_SETUP(pipeline_test)
+{
+	REPLAY_WriteInput(PIPELINE_TEST_INPUT, PIPELINE_TEST_LINES, 0u);
+}
+
+TEST_TEAR_DOWN(pipeline_test)
+{
+	remove(PIPELINE_TEST_INPUT);
+	remove(PIPELINE_TEST_SERIAL);
+	remove(PIPELINE_TEST_PIPELINED);
+}
+
+/**
+ *  \defgroup pipeline_test_cases Pipeline module test cases
+ *  This is for testing the functionality of Pipeline module
+ *
+ *  \details It tests the following test cases:
+ *  	-	PipelineIsTheSameAsSerial: The output file and the last speed
+ *  		are the same as replaying line by line in both input modes.
+ *  	-	PipelineCopiesLongLines: A line longer than the text of a batch
+ *  		is parsed the same as replaying line by line.
+ *  	-	PipelineReplaysEmptyFile: A file with only a header writes only
+ *  		the output header.
+ *  @{
+ */
+
+/**
+ *  \brief Test case for the output of the pipeline.
+ *
+ *  \details The input lines are more than 3 batches, the stream mode
+ *  		 reuses its read block for every few lines.
+ */
+TEST(pipeline_test, PipelineIsTheSameAsSerial)
+{
+	static const REPLAY_Config_t configs[] =
+	{
+		{FILE_IF_INPUT_MODE_STREAM, REPLAY_PIPELINED, 0u, 0u},
+		{FILE_IF_INPUT_MODE_MAPPED, REPLAY_PIPELINED, 0u, 0u}
+	};
+	unsigned int config;
+
+	for (config = 0; config < sizeof(configs) / sizeof(configs[0]); config++)
+	{
+		REPLAY_CheckSameAsSerial(PIPELINE_TEST_INPUT, PIPELINE_TEST_SERIAL, PIPELINE_TEST_PIPELINED,
+			&configs[config]);
+	}
+}
+
+/**
+ *  \brief Test case for a line longer than #PIPELINE_TEXT_SIZE.
+ */
+TEST(pipeline_test, PipelineCopiesLongLines)
+{
+	static const REPLAY_Config_t config = {FILE_IF_INPUT_MODE_MAPPED, REPLAY_PIPELINED, 0u, 0u};
+	FILE * handler = fopen(PIPELINE_TEST_INPUT, "ab");
+	unsigned int index;
+
+	fputs("pre_pressed", handler);
+	for (index = 0; index < PIPELINE_TEXT_SIZE; index++)
+	{
+		fputc('\t', handler);
+	}
+	fputs("released released 0\nreleased released pressed 60000\n", handler);
+	fclose(handler);
+
+	REPLAY_CheckSameAsSerial(PIPELINE_TEST_INPUT, PIPELINE_TEST_SERIAL, PIPELINE_TEST_PIPELINED, &config);
+}
+
+/**
+ *  \brief Test case for an input file without lines.
+ */
+TEST(pipeline_test, PipelineReplaysEmptyFile)
+{
+	static const REPLAY_Config_t config = {FILE_IF_INPUT_MODE_STREAM, REPLAY_PIPELINED, 0u, 0u};
+	FILE * handler = fopen(PIPELINE_TEST_INPUT, "wb");
+	long size;
+	char * text;
+
+	fputs("header\n", handler);
+	fclose(handler);
+
+	LONGS_EQUAL(MOTOR_MEDIUM_SPEED, REPLAY_Run(PIPELINE_TEST_INPUT, PIPELINE_TEST_PIPELINED, &config, NULL));
+	text = REPLAY_ReadFile(PIPELINE_TEST_PIPELINED, &size);
+	text[size] = 0;
+	STRCMP_EQUAL(FILE_IF_OUTPUT_FILE_HEADER, text);
+	free(text);
+}
+/**
+ *  @}
+ */
+
+/**
+ *  \brief Test code runner for all test cases of Pipeline module.
+ */
+TEST_GROUP_RUNNER(pipeline_test)
+{
+    printf("======================= Testing Pipeline Module =======================\n\n");
+    RUN_TEST_CASE(pipeline_test, PipelineIsTheSameAsSerial);
+    RUN_TEST_CASE(pipeline_test, PipelineCopiesLongLines);
+    RUN_TEST_CASE(pipeline_test, PipelineReplaysEmptyFile);
+    printf("\n==================== Testing Pipeline  Module Done ====================\n\n\n");
+}
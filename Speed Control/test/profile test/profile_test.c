@@ -0,0 +1,111 @@
+/**
+ *  \file	profile_test.c
+ *  \brief	This file includes test cases for testing Profile module.
+ *  \author Ahmed Wageh
+ */
+#include <stdio.h>
+#include "../../source/Profile/Profile.h"
+#include "../unity/unity_fixture.h"
+
+/** The number of recorded latencies, they are 1 to it */
+#define PROFILE_TEST_LATENCIES	1000u
+
+/* Test group declaration */
+TEST_GROUP(profile_test);
+
+TEST_SETUP(profile_test)
+{
+	Profile_Reset();
+}
+
+TEST_TEAR_DOWN(profile_test)
+{
+	Profile_Reset();
+}
+
+/**
+ *  \defgroup profile_test_cases Profile module test cases
+ *  This is for testing the functionality of Profile module
+ *
+ *  \details It tests the following test cases:
+ *  	-	PercentilesAreInTheirBuckets: The percentiles of 1 to 1000 ns
+ *  		are at most 1 / #PROFILE_SUB_BUCKETS more than the exact ones.
+ *  	-	SmallAndLargeLatenciesAreRecorded: The latencies less than
+ *  		#PROFILE_SUB_BUCKETS are exact and the largest one is recorded.
+ *  	-	BeginAndEndRecordOneLatency: Timing a stage records it only.
+ *  @{
+ */
+/**
+ *  \brief Test case for the percentiles of many latencies of one stage.
+ */
+TEST(profile_test, PercentilesAreInTheirBuckets)
+{
+	unsigned long long latency;
+
+	for (latency = 1; latency <= PROFILE_TEST_LATENCIES; latency++)
+	{
+		Profile_Record(PROFILE_STAGE_CALC, latency);
+	}
+
+	LONGS_EQUAL(PROFILE_TEST_LATENCIES, Profile_GetCount(PROFILE_STAGE_CALC));
+	LONGS_EQUAL(PROFILE_TEST_LATENCIES, Profile_GetMax(PROFILE_STAGE_CALC));
+	CHECK(Profile_GetPercentile(PROFILE_STAGE_CALC, 50.0) >= 500u);
+	CHECK(Profile_GetPercentile(PROFILE_STAGE_CALC, 50.0) <= 500u + 500u / PROFILE_SUB_BUCKETS);
+	CHECK(Profile_GetPercentile(PROFILE_STAGE_CALC, 99.0) >= 990u);
+	CHECK(Profile_GetPercentile(PROFILE_STAGE_CALC, 99.0) <= PROFILE_TEST_LATENCIES);
+	LONGS_EQUAL(PROFILE_TEST_LATENCIES, Profile_GetPercentile(PROFILE_STAGE_CALC, 100.0));
+	LONGS_EQUAL(1, Profile_GetPercentile(PROFILE_STAGE_CALC, 0.0));
+
+	LONGS_EQUAL(0, Profile_GetCount(PROFILE_STAGE_READ));
+	LONGS_EQUAL(0, Profile_GetPercentile(PROFILE_STAGE_READ, 50.0));
+	LONGS_EQUAL(0, Profile_GetMax(PROFILE_STAGE_READ));
+}
+
+/**
+ *  \brief Test case for the first and the last buckets.
+ */
+TEST(profile_test, SmallAndLargeLatenciesAreRecorded)
+{
+	unsigned long long latency;
+
+	for (latency = 0; latency < PROFILE_SUB_BUCKETS; latency++)
+	{
+		Profile_Record(PROFILE_STAGE_PARSE, latency);
+		LONGS_EQUAL(latency, Profile_GetPercentile(PROFILE_STAGE_PARSE, 100.0));
+	}
+	Profile_Record(PROFILE_STAGE_WRITE, ~0ull);
+	CHECK(~0ull == Profile_GetMax(PROFILE_STAGE_WRITE));
+	CHECK(~0ull == Profile_GetPercentile(PROFILE_STAGE_WRITE, 50.0));
+}
+
+/**
+ *  \brief Test case for timing a stage on the calling thread.
+ */
+TEST(profile_test, BeginAndEndRecordOneLatency)
+{
+	unsigned long long start = Profile_GetTimeNs();
+
+	Profile_Begin(PROFILE_STAGE_READ);
+	Profile_End(PROFILE_STAGE_READ);
+
+	LONGS_EQUAL(1, Profile_GetCount(PROFILE_STAGE_READ));
+	CHECK(Profile_GetMax(PROFILE_STAGE_READ) <= Profile_GetTimeNs() - start);
+	LONGS_EQUAL(0, Profile_GetCount(PROFILE_STAGE_PARSE));
+	LONGS_EQUAL(0, Profile_GetCount(PROFILE_STAGE_CALC));
+	LONGS_EQUAL(0, Profile_GetCount(PROFILE_STAGE_WRITE));
+}
+/**
+ *  @}
+ */
+
+/**
+ *  \brief Test code runner for all test cases of Profile module.
+ */
+TEST_GROUP_RUNNER(profile_test)
+{
+    printf("====================== Testing Profile Module ======================\n\n");
+    RUN_TEST_CASE(profile_test, PercentilesAreInTheirBuckets);
+    RUN_TEST_CASE(profile_test, SmallAndLargeLatenciesAreRecorded);
+    RUN_TEST_CASE(profile_test, BeginAndEndRecordOneLatency);
+    printf("\n=================== Testing Profile  Module Done ===================\n\n\n");
+}
@@ -0,0 +1,158 @@
+/**
+ *  \file	replay_helper.c
+ *  \brief	This file implementation of the replay helper of the test cases.
+ *  \author Ahmed Wageh.
+ *  \details Every replayer reads the input file by its own reader and
+ *  		 writes the output file by its own writer, so replays never
+ *  		 share the input and output files of the application.
+ */
+/* Include Header File */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "replay_helper.h"
+#include "../../source/Chunk/Chunk.h"
+#include "../../source/Pipeline/Pipeline.h"
+#include "../../source/Speed Control/SpeedControl.h"
+#include "../unity/unity_fixture.h"
+
+/* Functions definition */
+/**
+ *  \brief	Writes an input file with every switches states and
+ *  		durations around the "P" steps.
+ *
+ *  \param Path : The path of the input file.
+ *  \param Lines : The number of lines after the header.
+ *  \param Blank_Every : An empty line is written after every
+ *  			\p Blank_Every lines, 0 for no empty lines.
+ *  \return None.
+ */
+void REPLAY_WriteInput(const char * Path, unsigned int Lines, unsigned int Blank_Every)
+{
+	static const char * states[] = {"pre_pressed", "pressed", "released", "pre_released", "bogus"};
+	static const char * durations[] = {"0", "29999", "30000", "95000", "-1", "4000000"};
+	FILE * handler = fopen(Path, "wb");
+	unsigned int line;
+
+	fputs("inc\tdec\tp\tduration\n", handler);
+	for (line = 0; line < Lines; line++)
+	{
+		fprintf(handler, "%s\t%s %s\t\t%s\n%s", states[line % 5u], states[line / 5u % 5u],
+			states[line / 3u % 5u], durations[line / 7u % 6u],
+			(Blank_Every != 0u && line % Blank_Every == 0u) ? "\n" : "");
+	}
+	fclose(handler);
+}
+
+/**
+ *  \brief	Reads a whole file.
+ *
+ *  \param Path : The path of the file.
+ *  \param Size : The size of the file.
+ *  \return The file content, it must be freed.
+ */
+char * REPLAY_ReadFile(const char * Path, long * Size)
+{
+	FILE * handler = fopen(Path, "rb");
+	char * text = NULL;
+
+	*Size = 0;
+	if (handler != NULL)
+	{
+		fseek(handler, 0, SEEK_END);
+		*Size = ftell(handler);
+		fseek(handler, 0, SEEK_SET);
+		text = malloc((size_t)*Size + 1u);
+		*Size = (long)fread(text, 1, (size_t)*Size, handler);
+		fclose(handler);
+	}
+
+	return text;
+}
+
+/**
+ *  \brief	Replays an input file to an output file.
+ *
+ *  \param Input_Path : The path of the input file.
+ *  \param Output_Path : The path of the output file.
+ *  \param Config : The \ref REPLAY_Config_t of the replay.
+ *  \param Skipped : The skipped ticks of #REPLAY_RUNS, it may be NULL.
+ *  \return The last motor speed.
+ */
+int REPLAY_Run(const char * Input_Path, const char * Output_Path, const REPLAY_Config_t * Config,
+	unsigned long long * Skipped)
+{
+	static char readBuffer[REPLAY_READ_SIZE + 1];
+	static char writeBuffer[FILE_IF_OUTPUT_BUFFER_SIZE];
+	FileIf_Reader_t reader;
+	FileIf_Writer_t writer;
+	Switches_Context_t switches;
+	Motor_Context_t motor;
+	unsigned long long skipped = 0;
+
+	LONGS_EQUAL(FILE_IF_ERROR_OK, File_ReaderOpenMode(&reader, Input_Path, readBuffer,
+		REPLAY_READ_SIZE, Config->Mode));
+	LONGS_EQUAL(FILE_IF_ERROR_OK, File_WriterOpen(&writer, Output_Path, writeBuffer, sizeof(writeBuffer)));
+	Switches_ContextInit(&switches, &reader);
+	Motor_ContextInit(&motor, &writer);
+	switch (Config->Replayer)
+	{
+		case REPLAY_PIPELINED:
+			LONGS_EQUAL(PIPELINE_ERROR_OK, Pipeline_Run(&switches, &motor));
+		break;
+
+		case REPLAY_RUNS:
+			SpeedControl_ContextReplay(&switches, &motor, &skipped);
+		break;
+
+		case REPLAY_CHUNKS:
+			LONGS_EQUAL(CHUNK_ERROR_OK, Chunk_Run(&switches, &motor, Config->Workers, Config->Chunk_Size));
+		break;
+
+		default:
+			while (Switches_ContextUpdateState(&switches) == SWITCH_UPDATE_OK)
+			{
+				Motor_ContextUpdateSpeed(&motor, SpeedControl_ContextCalcNewSpeed(&switches, &motor));
+			}
+	}
+	LONGS_EQUAL(FILE_IF_ERROR_OK, File_WriterClose(&writer));
+	File_ReaderClose(&reader);
+	if (Skipped != NULL)
+	{
+		*Skipped = skipped;
+	}
+
+	return Motor_ContextGetSpeed(&motor);
+}
+
+/**
+ *  \brief	Checks that a replay writes the same output file and the
+ *  		same last speed as replaying line by line.
+ *
+ *  \param Input_Path : The path of the input file.
+ *  \param Serial_Path : The path of the output file of replaying line by line.
+ *  \param Output_Path : The path of the output file of \p Config.
+ *  \param Config : The \ref REPLAY_Config_t of the checked replay.
+ *  \return The skipped ticks of #REPLAY_RUNS, otherwise 0.
+ */
+unsigned long long REPLAY_CheckSameAsSerial(const char * Input_Path, const char * Serial_Path,
+	const char * Output_Path, const REPLAY_Config_t * Config)
+{
+	REPLAY_Config_t serialConfig = {Config->Mode, REPLAY_SERIAL, 0u, 0u};
+	unsigned long long skipped;
+	char * serial;
+	char * replayed;
+	long serialSize;
+	long replayedSize;
+
+	LONGS_EQUAL(REPLAY_Run(Input_Path, Serial_Path, &serialConfig, NULL),
+		REPLAY_Run(Input_Path, Output_Path, Config, &skipped));
+	serial = REPLAY_ReadFile(Serial_Path, &serialSize);
+	replayed = REPLAY_ReadFile(Output_Path, &replayedSize);
+	LONGS_EQUAL(serialSize, replayedSize);
+	LONGS_EQUAL(0, memcmp(serial, replayed, (size_t)serialSize));
+	free(serial);
+	free(replayed);
+
+	return skipped;
+}
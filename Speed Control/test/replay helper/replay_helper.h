@@ -0,0 +1,103 @@
+/**
+ *  \file	replay_helper.h
+ *  \brief	This file provides functions to replay an input file in
+ *  		test cases and to compare the output files of two replays.
+ *  \author Ahmed Wageh.
+ *  \details This file is used when the need to test a way of replaying
+ *  		 the input file. Every replayer is compared with replaying
+ *  		 line by line by \ref REPLAY_CheckSameAsSerial.
+ */
+#ifndef REPLAY_HELPER_H_
+#define REPLAY_HELPER_H_
+/* Include the real modules headers to expose Types */
+#include "../../source/File If/FileIf.h"
+
+/* Macros */
+/** The size of one read block of the replayed input files */
+#define REPLAY_READ_SIZE	4096u
+
+/* User-defined data types */
+/**
+ *  This enum is for the ways of replaying an input file.
+ */
+enum REPLAY_Replayer_t
+{
+	/** Replaying line by line */
+	REPLAY_SERIAL = 0,
+	/** Replaying by \ref Pipeline_Run */
+	REPLAY_PIPELINED,
+	/** Replaying runs of lines by \ref SpeedControl_ContextReplay */
+	REPLAY_RUNS,
+	/** Replaying chunks of lines by \ref Chunk_Run */
+	REPLAY_CHUNKS
+};
+typedef enum REPLAY_Replayer_t REPLAY_Replayer_t;
+
+/**
+ *  This struct selects how an input file is replayed.
+ */
+struct REPLAY_Config_t
+{
+	/** The \ref FileIf_InputMode_t of the input file */
+	FileIf_InputMode_t Mode;
+	/** The \ref REPLAY_Replayer_t */
+	REPLAY_Replayer_t Replayer;
+	/** The number of workers of #REPLAY_CHUNKS */
+	unsigned int Workers;
+	/** The size of the chunks of #REPLAY_CHUNKS, 0 for the default size */
+	unsigned int Chunk_Size;
+};
+typedef struct REPLAY_Config_t REPLAY_Config_t;
+
+/**
+ *  \brief	Writes an input file with every switches states and
+ *  		durations around the "P" steps.
+ *
+ *  \param Path : The path of the input file.
+ *  \param Lines : The number of lines after the header.
+ *  \param Blank_Every : An empty line is written after every
+ *  			\p Blank_Every lines, 0 for no empty lines.
+ *  \return None.
+ *
+ *  \details Some states aren't valid and some lines are separated by
+ *  		 spaces instead of tabs.
+ */
+void REPLAY_WriteInput(const char * Path, unsigned int Lines, unsigned int Blank_Every);
+
+/**
+ *  \brief	Reads a whole file.
+ *
+ *  \param Path : The path of the file.
+ *  \param Size : The size of the file.
+ *  \return The file content, it must be freed. It holds one more byte
+ *  		to be terminated by the caller.
+ */
+char * REPLAY_ReadFile(const char * Path, long * Size);
+
+/**
+ *  \brief	Replays an input file to an output file.
+ *
+ *  \param Input_Path : The path of the input file.
+ *  \param Output_Path : The path of the output file.
+ *  \param Config : The \ref REPLAY_Config_t of the replay.
+ *  \param Skipped : The skipped ticks of #REPLAY_RUNS, 0 for the other
+ *  			replayers, it may be NULL.
+ *  \return The last motor speed.
+ */
+int REPLAY_Run(const char * Input_Path, const char * Output_Path, const REPLAY_Config_t * Config,
+	unsigned long long * Skipped);
+
+/**
+ *  \brief	Checks that a replay writes the same output file and the
+ *  		same last speed as replaying line by line.
+ *
+ *  \param Input_Path : The path of the input file.
+ *  \param Serial_Path : The path of the output file of replaying line by line.
+ *  \param Output_Path : The path of the output file of \p Config.
+ *  \param Config : The \ref REPLAY_Config_t of the checked replay, the
+ *  			line by line replay uses the same input mode.
+ *  \return The skipped ticks of #REPLAY_RUNS, otherwise 0.
+ */
+unsigned long long REPLAY_CheckSameAsSerial(const char * Input_Path, const char * Serial_Path,
+	const char * Output_Path, const REPLAY_Config_t * Config);
+#endif /* REPLAY_HELPER_H_ */
@@ -4,25 +4,43 @@
  *  		module.
  *  \author Ahmed Wageh
  */
+#include <stdio.h>
+#include <limits.h>
 #include "../../source/Motor/Motor.h"
 #include "../fake switch/fake_switch.h"
+#include "../replay helper/replay_helper.h"
 #include "../../source/Speed Control/SpeedControl.h"
 #include "../unity/unity_fixture.h"
 
+/* Macros */
+/** Number of devices of the batch test, every states for 12 durations 4 times */
+#define SPEED_CONTROL_TEST_BATCH_COUNT	(5 * 5 * 5 * 12 * 4)
+/** Number of ticks of the run test, more than the ticks from the maximum to the minimum */
+#define SPEED_CONTROL_TEST_RUN_TICKS	(MOTOR_MAXIMUM_SPEED - MOTOR_MINIMUM_SPEED + 5)
+/** Number of ticks of the transfer test, some runs from one limit to the other */
+#define SPEED_CONTROL_TEST_TRANSFER_TICKS	3000u
+/** The input file of the replay test */
+#define SPEED_CONTROL_TEST_INPUT	"speed_control_test_switches.txt"
+/** The output file of replaying line by line */
+#define SPEED_CONTROL_TEST_SERIAL	"speed_control_test_motor_serial.txt"
+/** The output file of replaying by runs */
+#define SPEED_CONTROL_TEST_RUNS		"speed_control_test_motor_runs.txt"
+
 /* Test group declaration */
 TEST_GROUP(speed_control_test);
 TEST_GROUP(default_speed_control_test);
 TEST_GROUP(priority_speed_control_test);
 TEST_GROUP(EP_BVA_speed_control_test);
 TEST_GROUP(ONE_SWIICH_COVERAGE_speed_control_test);
+TEST_GROUP(closed_form_speed_control_test);
+TEST_GROUP(replay_speed_control_test);
 
 /* motor_test group setup and tear_down function */
 TEST_SETUP(speed_control_test)
 {
     Motor_Init();
     FAKE_SW_init();
-    UT_PTR_SET(Switches_GetState, FAKE_SW_getSwState);
-    UT_PTR_SET(Switches_GetPDuration, FAKE_SW_getSwDuration);
+    UT_PTR_SET(Switches_Snapshot, FAKE_SW_getSnapshot());
 }
 
 
@@ -36,8 +54,7 @@ TEST_SETUP(default_speed_control_test)
 {
     Motor_Init();
     FAKE_SW_init();
-    UT_PTR_SET(Switches_GetState, FAKE_SW_getSwState);
-    UT_PTR_SET(Switches_GetPDuration, FAKE_SW_getSwDuration);
+    UT_PTR_SET(Switches_Snapshot, FAKE_SW_getSnapshot());
 }
 
 
@@ -51,8 +68,7 @@ TEST_SETUP(priority_speed_control_test)
 {
     Motor_Init();
     FAKE_SW_init();
-    UT_PTR_SET(Switches_GetState, FAKE_SW_getSwState);
-    UT_PTR_SET(Switches_GetPDuration, FAKE_SW_getSwDuration);
+    UT_PTR_SET(Switches_Snapshot, FAKE_SW_getSnapshot());
 }
 
 
@@ -66,8 +82,7 @@ TEST_SETUP(EP_BVA_speed_control_test)
 {
     Motor_Init();
     FAKE_SW_init();
-    UT_PTR_SET(Switches_GetState, FAKE_SW_getSwState);
-    UT_PTR_SET(Switches_GetPDuration, FAKE_SW_getSwDuration);
+    UT_PTR_SET(Switches_Snapshot, FAKE_SW_getSnapshot());
 }
 
 
@@ -81,8 +96,7 @@ TEST_SETUP(ONE_SWIICH_COVERAGE_speed_control_test)
 {
     Motor_Init();
     FAKE_SW_init();
-    UT_PTR_SET(Switches_GetState, FAKE_SW_getSwState);
-    UT_PTR_SET(Switches_GetPDuration, FAKE_SW_getSwDuration);
+    UT_PTR_SET(Switches_Snapshot, FAKE_SW_getSnapshot());
 }
 
 
@@ -91,6 +105,32 @@ TEST_TEAR_DOWN(ONE_SWIICH_COVERAGE_speed_control_test)
     FAKE_SW_destroy();
 }
 
+/* closed_form_speed_control_test group setup and tear_down function */
+TEST_SETUP(closed_form_speed_control_test)
+{
+
+}
+
+
+TEST_TEAR_DOWN(closed_form_speed_control_test)
+{
+
+}
+
+/* replay_speed_control_test group setup and tear_down function */
+TEST_SETUP(replay_speed_control_test)
+{
+
+}
+
+
+TEST_TEAR_DOWN(replay_speed_control_test)
+{
+	remove(SPEED_CONTROL_TEST_INPUT);
+	remove(SPEED_CONTROL_TEST_SERIAL);
+	remove(SPEED_CONTROL_TEST_RUNS);
+}
+
 /**
  *  \defgroup speed_control_test Speed control test
  *  This is the testing of speed control module. It uses several testing techniques.
@@ -904,6 +944,456 @@ TEST(ONE_SWIICH_COVERAGE_speed_control_test, PSwitchCoverageTest)
 /**
  *  @}
  */
+
+/**
+ *  \defgroup closed_form_speed_control_test Closed form speed control test
+ *  This is the testing of the "P" switch speed reduction without a loop.
+ *  
+ *  \ingroup speed_control_test
+ *  
+ *  \details	It compares \ref SpeedControl_CalcSpeed with the loop that
+ *  			steps the speed down once for every 30 seconds. It tests the
+ *  			following test cases:
+ *  			-	PReductionIsTheSameAsStepLoop: For every speed around the
+ *  				motor limits and every duration around every step boundary.
+ *  			-	BatchIsTheSameAsOneDevice: \ref SpeedControl_CalcSpeedBatch
+ *  				for every switches states, speeds and durations.
+ *  			-	RunIsTheSameAsTicks: \ref SpeedControl_CalcSpeedRun for
+ *  				every switches states, speeds, durations and ticks.
+ *  			-	TransferIsTheSameAsTicks: \ref SpeedControl_Transfer_t
+ *  				of one tick and of groups of ticks appended in any order.
+ *  			-	TableIsTheSameAsRules: \ref SpeedControl_TableCalcSpeed
+ *  				for every input after the tables are generated.
+ *  			-	SnapshotIsReadByCalcNewSpeed: \ref SpeedControl_CalcNewSpeed
+ *  				reads a \ref Switches_Snapshot_t built by the test case.
+ *
+ *	@{
+ */
+
+/**
+ *  \brief	The reference "P" switch reduction, one step down for every
+ *  		30 seconds.
+ *  
+ *  \param [in] PDuration The pressing duration of "P" switch.
+ *  \param [in] MotorSpeed The current motor speed.
+ *  \return The new speed.
+ */
+static int SpeedControl_StepLoop(int PDuration, int MotorSpeed)
+{
+	if (MotorSpeed >= MOTOR_MINIMUM_SPEED)
+	{
+		do{
+			MotorSpeed--;
+			PDuration -= 30000;
+		}while(PDuration >= 30000 && MotorSpeed >= MOTOR_MINIMUM_SPEED);
+	}
+
+	return MotorSpeed;
+}
+
+/**
+ *  \brief	Test case for the equivalence of the closed form and the loop.
+ *  
+ *  \param Given : Any switches states, any speed from below the minimum to
+ *  				above the maximum and any duration near a step boundary.
+ *  \param When	 : Calling \ref SpeedControl_CalcSpeed.
+ *  \param Then  : The speed is the same as the step loop speed when "P" is
+ *  				pressed for at least 30 seconds, otherwise the same as
+ *  				the "+ve" and "-ve" switches rules.
+ *  
+ *  \details The durations are 0, the boundaries of int and for every step
+ *  		 count that can change the speed: one less, equal and one more
+ *  		 than its duration.
+ */
+TEST(closed_form_speed_control_test, PReductionIsTheSameAsStepLoop)
+{
+	/* Needed variables */
+	static const Switches_States_t otherStates[] = {SWITCH_RELEASED, SWITCH_PRE_PRESSED};
+	int durations[3 * (MOTOR_MAXIMUM_SPEED + 20) + 16];
+	int durationsCount = 0;
+	int expected;
+	int speed;
+	int step;
+	int index;
+	int inc;
+	int dec;
+	Switches_States_t p;
+
+	/* The durations */
+	durations[durationsCount++] = INT_MIN;
+	durations[durationsCount++] = -1;
+	durations[durationsCount++] = INT_MAX - 1;
+	durations[durationsCount++] = INT_MAX;
+	durations[durationsCount++] = (INT_MAX / 30000) * 30000 - 1;
+	durations[durationsCount++] = (INT_MAX / 30000) * 30000;
+	for (step = 0; step < MOTOR_MAXIMUM_SPEED + 20; step++)
+	{
+		durations[durationsCount++] = step * 30000 - 1;
+		durations[durationsCount++] = step * 30000;
+		durations[durationsCount++] = step * 30000 + 1;
+	}
+
+	for (speed = MOTOR_MINIMUM_SPEED - 15; speed <= MOTOR_MAXIMUM_SPEED + 15; speed++)
+	{
+		for (index = 0; index < durationsCount; index++)
+		{
+			for (p = SWITCH_ERROR; p <= SWITCH_PRE_RELEASED; p++)
+			{
+				for (inc = 0; inc < 2; inc++)
+				{
+					for (dec = 0; dec < 2; dec++)
+					{
+						if (p == SWITCH_PRESSED && durations[index] >= 30000)
+						{
+							expected = SpeedControl_StepLoop(durations[index], speed);
+						}
+						else if (otherStates[dec] == SWITCH_PRE_PRESSED)
+						{
+							expected = (speed >= MOTOR_MINIMUM_SPEED) ? speed - 1 : speed;
+						}
+						else if (otherStates[inc] == SWITCH_PRE_PRESSED)
+						{
+							expected = (speed <= MOTOR_MAXIMUM_SPEED) ? speed + 1 : speed;
+						}
+						else
+						{
+							expected = speed;
+						}
+						LONGS_EQUAL(expected, SpeedControl_CalcSpeed(otherStates[inc], otherStates[dec],
+							p, durations[index], speed));
+					}
+				}
+			}
+		}
+	}
+}
+
+/**
+ *  \brief	Test case for the equivalence of the batch and one device.
+ *  
+ *  \param Given : Devices with every switches states, speeds around the
+ *  				motor limits and durations around the step boundaries.
+ *  \param When	 : Calling \ref SpeedControl_CalcSpeedBatch for all devices.
+ *  \param Then  : The speed of every device is the same as
+ *  				\ref SpeedControl_CalcSpeed of this device.
+ *  
+ *  \details It's called with every count from 0 to more than a vector
+ *  		 to test the devices left after the last full vector.
+ */
+TEST(closed_form_speed_control_test, BatchIsTheSameAsOneDevice)
+{
+	/* Needed variables */
+	static const int durations[] = {INT_MIN, -1, 0, 29999, 30000, 30001, 59999, 60000,
+		3000000, 3600000, 4200000, INT_MAX};
+	static Switches_States_t inc[SPEED_CONTROL_TEST_BATCH_COUNT];
+	static Switches_States_t dec[SPEED_CONTROL_TEST_BATCH_COUNT];
+	static Switches_States_t p[SPEED_CONTROL_TEST_BATCH_COUNT];
+	static int duration[SPEED_CONTROL_TEST_BATCH_COUNT];
+	static int speed[SPEED_CONTROL_TEST_BATCH_COUNT];
+	static int newSpeed[SPEED_CONTROL_TEST_BATCH_COUNT + 1];
+	int count = 0;
+	int index;
+
+	/* Every device is different */
+	for (index = 0; index < SPEED_CONTROL_TEST_BATCH_COUNT; index++)
+	{
+		inc[index] = (Switches_States_t)(index % 5);
+		dec[index] = (Switches_States_t)(index / 5 % 5);
+		p[index] = (Switches_States_t)(index / 25 % 5);
+		duration[index] = durations[index / 125 % 12];
+		speed[index] = MOTOR_MINIMUM_SPEED - 1 + (index * 7) % (MOTOR_MAXIMUM_SPEED - MOTOR_MINIMUM_SPEED + 3);
+	}
+
+	/* All devices */
+	SpeedControl_CalcSpeedBatch(inc, dec, p, duration, speed, newSpeed, SPEED_CONTROL_TEST_BATCH_COUNT);
+	for (index = 0; index < SPEED_CONTROL_TEST_BATCH_COUNT; index++)
+	{
+		LONGS_EQUAL(SpeedControl_CalcSpeed(inc[index], dec[index], p[index], duration[index], speed[index]),
+			newSpeed[index]);
+	}
+
+	/* Every short count, the next device isn't written */
+	for (count = 0; count <= 40; count++)
+	{
+		newSpeed[count] = -1;
+		SpeedControl_CalcSpeedBatch(inc + 17, dec + 17, p + 17, duration + 17, speed + 17, newSpeed, count);
+		LONGS_EQUAL(-1, newSpeed[count]);
+		for (index = 0; index < count; index++)
+		{
+			LONGS_EQUAL(SpeedControl_CalcSpeed(inc[index + 17], dec[index + 17], p[index + 17],
+				duration[index + 17], speed[index + 17]), newSpeed[index]);
+		}
+	}
+}
+
+/**
+ *  \brief	Test case for the speed after a run of the same switches states.
+ *  
+ *  \param Given : Any switches states, any speed between the motor limits
+ *  				and any duration near a step boundary.
+ *  \param When	 : Calling \ref SpeedControl_CalcSpeedRun for every number
+ *  				of ticks until the speed can't change.
+ *  \param Then  : The speed is the same as calling \ref SpeedControl_CalcSpeed
+ *  				and limiting the speed by the motor every tick.
+ */
+TEST(closed_form_speed_control_test, RunIsTheSameAsTicks)
+{
+	/* Needed variables */
+	static const int durations[] = {INT_MIN, -1, 0, 29999, 30000, 59999, 60000, 95000,
+		3000000, INT_MAX};
+	Motor_Context_t motor;
+	unsigned int ticks;
+	int duration;
+	int speed;
+	int index;
+
+	for (index = 0; index < 5 * 5 * 5; index++)
+	{
+		for (duration = 0; duration < (int)(sizeof(durations) / sizeof(durations[0])); duration++)
+		{
+			for (speed = MOTOR_MINIMUM_SPEED; speed <= MOTOR_MAXIMUM_SPEED; speed++)
+			{
+				Motor_ContextSetSpeed(&motor, speed);
+				for (ticks = 0; ticks < SPEED_CONTROL_TEST_RUN_TICKS; ticks++)
+				{
+					LONGS_EQUAL(Motor_ContextGetSpeed(&motor), SpeedControl_CalcSpeedRun((Switches_States_t)(index % 5),
+						(Switches_States_t)(index / 5 % 5), (Switches_States_t)(index / 25), durations[duration],
+						speed, ticks));
+					Motor_ContextSetSpeed(&motor, SpeedControl_CalcSpeed((Switches_States_t)(index % 5),
+						(Switches_States_t)(index / 5 % 5), (Switches_States_t)(index / 25), durations[duration],
+						Motor_ContextGetSpeed(&motor)));
+				}
+				/* No more changes */
+				LONGS_EQUAL(Motor_ContextGetSpeed(&motor), SpeedControl_CalcSpeedRun((Switches_States_t)(index % 5),
+					(Switches_States_t)(index / 5 % 5), (Switches_States_t)(index / 25), durations[duration],
+					speed, ~0u));
+			}
+		}
+	}
+}
+
+/**
+ *  \brief	Test case for the change of the speed over many ticks.
+ *  
+ *  \param Given : Ticks of every switches states and durations near a
+ *  				step boundary, long runs which go beyond both limits.
+ *  \param When	 : Appending their \ref SpeedControl_Transfer_t one by one
+ *  				and by groups which are appended together later.
+ *  \param Then  : Applying the changes to every speed between the motor
+ *  				limits is the same as calling \ref SpeedControl_CalcSpeed
+ *  				and limiting the speed by the motor every tick.
+ */
+TEST(closed_form_speed_control_test, TransferIsTheSameAsTicks)
+{
+	/* Needed variables */
+	static const int durations[] = {INT_MIN, -1, 0, 29999, 30000, 59999, 60000, 95000,
+		3000000, INT_MAX};
+	static SpeedControl_Transfer_t ticks[SPEED_CONTROL_TEST_TRANSFER_TICKS];
+	static int speeds[SPEED_CONTROL_TEST_TRANSFER_TICKS];
+	SpeedControl_Transfer_t all;
+	SpeedControl_Transfer_t group;
+	SpeedControl_Transfer_t groups;
+	Motor_Context_t motor;
+	Switches_States_t states[3];
+	unsigned int random = 1u;
+	unsigned int index;
+	unsigned int size;
+	int duration;
+	int speed;
+
+	/* Random ticks with long runs of the same step */
+	for (index = 0; index < SPEED_CONTROL_TEST_TRANSFER_TICKS; index++)
+	{
+		if (index % 200u < 50u || index % 1000u >= 800u)
+		{
+			random = random * 1103515245u + 12345u;
+		}
+		states[0] = (Switches_States_t)((random >> 8) % 5u);
+		states[1] = (Switches_States_t)((random >> 12) % 5u);
+		states[2] = (Switches_States_t)((random >> 16) % 5u);
+		duration = durations[(random >> 20) % (sizeof(durations) / sizeof(durations[0]))];
+		SpeedControl_CalcTransfer(states[0], states[1], states[2], duration, &ticks[index]);
+		for (speed = MOTOR_MINIMUM_SPEED; speed <= MOTOR_MAXIMUM_SPEED; speed++)
+		{
+			Motor_ContextSetSpeed(&motor, SpeedControl_CalcSpeed(states[0], states[1], states[2], duration, speed));
+			LONGS_EQUAL(Motor_ContextGetSpeed(&motor), SpeedControl_TransferApply(&ticks[index], speed));
+		}
+	}
+
+	for (speed = MOTOR_MINIMUM_SPEED; speed <= MOTOR_MAXIMUM_SPEED; speed++)
+	{
+		speeds[0] = SpeedControl_TransferApply(&ticks[0], speed);
+		for (index = 1; index < SPEED_CONTROL_TEST_TRANSFER_TICKS; index++)
+		{
+			speeds[index] = SpeedControl_TransferApply(&ticks[index], speeds[index - 1u]);
+		}
+
+		/* One by one, every tick */
+		SpeedControl_TransferInit(&all);
+		LONGS_EQUAL(speed, SpeedControl_TransferApply(&all, speed));
+		for (index = 0; index < SPEED_CONTROL_TEST_TRANSFER_TICKS; index++)
+		{
+			SpeedControl_TransferAppend(&all, &ticks[index]);
+			LONGS_EQUAL(speeds[index], SpeedControl_TransferApply(&all, speed));
+		}
+
+		/* By groups of every size */
+		for (size = 1; size <= SPEED_CONTROL_TEST_TRANSFER_TICKS; size *= 3u)
+		{
+			SpeedControl_TransferInit(&groups);
+			SpeedControl_TransferInit(&group);
+			for (index = 0; index < SPEED_CONTROL_TEST_TRANSFER_TICKS; index++)
+			{
+				SpeedControl_TransferAppend(&group, &ticks[index]);
+				if ((index + 1u) % size == 0u || index + 1u == SPEED_CONTROL_TEST_TRANSFER_TICKS)
+				{
+					SpeedControl_TransferAppend(&groups, &group);
+					SpeedControl_TransferInit(&group);
+					LONGS_EQUAL(speeds[index], SpeedControl_TransferApply(&groups, speed));
+				}
+			}
+		}
+	}
+}
+
+/**
+ *  \brief	Test case for the tables of the new speed.
+ *  
+ *  \param Given : Every switches states, speeds around the motor limits and
+ *  				durations around the boundary of every bucket.
+ *  \param When	 : Calling \ref SpeedControl_TableCheck after
+ *  				\ref SpeedControl_TableInit.
+ *  \param Then  : There are no mismatches and the "P" steps, the "-ve" and
+ *  				"+ve" steps and the out of range inputs are the same as
+ *  				\ref SpeedControl_CalcSpeed.
+ */
+TEST(closed_form_speed_control_test, TableIsTheSameAsRules)
+{
+	SpeedControl_TableInit();
+	LONGS_EQUAL(0, SpeedControl_TableCheck());
+
+	LONGS_EQUAL(MOTOR_MINIMUM_SPEED - 1, SpeedControl_TableCalcSpeed(SWITCH_RELEASED, SWITCH_RELEASED,
+		SWITCH_PRESSED, INT_MAX, MOTOR_MAXIMUM_SPEED));
+	LONGS_EQUAL(MOTOR_MEDIUM_SPEED - 3, SpeedControl_TableCalcSpeed(SWITCH_PRE_PRESSED, SWITCH_PRE_PRESSED,
+		SWITCH_PRESSED, 3 * 30000 + 29999, MOTOR_MEDIUM_SPEED));
+	LONGS_EQUAL(MOTOR_MEDIUM_SPEED - 1, SpeedControl_TableCalcSpeed(SWITCH_PRE_PRESSED, SWITCH_PRE_PRESSED,
+		SWITCH_PRESSED, 29999, MOTOR_MEDIUM_SPEED));
+	LONGS_EQUAL(MOTOR_MAXIMUM_SPEED + 1, SpeedControl_TableCalcSpeed(SWITCH_PRE_PRESSED, SWITCH_RELEASED,
+		SWITCH_RELEASED, 0, MOTOR_MAXIMUM_SPEED));
+	LONGS_EQUAL(MOTOR_MINIMUM_SPEED - 5, SpeedControl_TableCalcSpeed(SWITCH_PRE_PRESSED, SWITCH_PRE_PRESSED,
+		SWITCH_PRESSED, 60000, MOTOR_MINIMUM_SPEED - 5));
+	LONGS_EQUAL(MOTOR_MEDIUM_SPEED, SpeedControl_TableCalcSpeed((Switches_States_t)7, SWITCH_RELEASED,
+		SWITCH_RELEASED, 0, MOTOR_MEDIUM_SPEED));
+}
+
+/**
+ *  \brief	Test case for reading the switches from a snapshot.
+ *  
+ *  \param Given : A \ref Switches_Snapshot_t built by the test case with
+ *  				every switches states and durations around the first
+ *  				"P" step.
+ *  \param When	 : Pointing \ref Switches_Snapshot to it and calling
+ *  				\ref SpeedControl_CalcNewSpeed.
+ *  \param Then  : The new speed is the same as \ref SpeedControl_CalcSpeed
+ *  				and \ref SpeedControl_CalcSnapshotSpeed.
+ */
+TEST(closed_form_speed_control_test, SnapshotIsReadByCalcNewSpeed)
+{
+	static const int durations[] = {0, 29999, 30000, 60000};
+	Switches_Snapshot_t snapshot;
+	unsigned int duration;
+	int inc;
+	int dec;
+	int p;
+
+	Motor_Init();
+	UT_PTR_SET(Switches_Snapshot, &snapshot);
+	for (inc = SWITCH_ERROR; inc <= SWITCH_PRE_RELEASED; inc++)
+	{
+		for (dec = SWITCH_ERROR; dec <= SWITCH_PRE_RELEASED; dec++)
+		{
+			for (p = SWITCH_ERROR; p <= SWITCH_PRE_RELEASED; p++)
+			{
+				for (duration = 0; duration < sizeof(durations) / sizeof(durations[0]); duration++)
+				{
+					snapshot.Inc_Switch = (Switches_States_t)inc;
+					snapshot.Dec_Switch = (Switches_States_t)dec;
+					snapshot.P_Switch = (Switches_States_t)p;
+					snapshot.P_Duration = durations[duration];
+					LONGS_EQUAL(SpeedControl_CalcSpeed(snapshot.Inc_Switch, snapshot.Dec_Switch,
+						snapshot.P_Switch, snapshot.P_Duration, MOTOR_MEDIUM_SPEED), SpeedControl_CalcNewSpeed());
+					LONGS_EQUAL(SpeedControl_CalcNewSpeed(), SpeedControl_CalcSnapshotSpeed(&snapshot,
+						MOTOR_MEDIUM_SPEED));
+				}
+			}
+		}
+	}
+}
+
+/* closed_form_speed_control_test closure */
+/**
+ *  @}
+ */
+
+/**
+ *  \defgroup replay_speed_control_test Replay speed control test
+ *  This is the testing of replaying an input file by runs of lines.
+ *  
+ *  \ingroup speed_control_test
+ *  
+ *  \details	It compares \ref SpeedControl_ContextReplay with replaying
+ *  			line by line. It tests the following test cases:
+ *  			-	RunsReplayIsTheSameAsSerial: The output file is the same
+ *  				and the ticks after every run reaches a limit are skipped.
+ *
+ *	@{
+ */
+
+/**
+ *  \brief	Test case for replaying runs of lines.
+ *  
+ *  \param Given : Runs of the same switches states from the medium speed,
+ *  				long runs go up to the maximum and down to the minimum
+ *  				by "+ve", "-ve" and "P" switches.
+ *  \param When	 : Replaying them by \ref SpeedControl_ContextReplay.
+ *  \param Then  : The output file is the same as replaying line by line
+ *  				and the skipped ticks are the ticks of every run after
+ *  				the speed stops changing.
+ */
+TEST(replay_speed_control_test, RunsReplayIsTheSameAsSerial)
+{
+	static const char * runs[] = {"pre_pressed released released 0", "released pre_pressed released 0",
+		"released released pressed 95000", "released released released 1234", "pre_pressed released released 0",
+		"released released released 0", "released released pressed 30000", "pressed pressed pressed 60000"};
+	static const unsigned int lengths[] = {300, 7, 150, 40, 1, 1, 500, 3};
+	/* 90 -> 140 in 50 ticks, 140 -> 133, 133 -> 10 in 41 ticks by -3, released, 10 -> 11,
+	   released, 11 -> 10 in 1 tick, already at the minimum */
+	static const unsigned int skipped[] = {250, 0, 109, 40, 0, 1, 499, 3};
+	static const REPLAY_Config_t config = {FILE_IF_INPUT_MODE_MAPPED, REPLAY_RUNS, 0u, 0u};
+	FILE * handler = fopen(SPEED_CONTROL_TEST_INPUT, "wb");
+	unsigned long long expected = 0;
+	unsigned int run;
+	unsigned int line;
+
+	fputs("inc\tdec\tp\tduration\n", handler);
+	for (run = 0; run < sizeof(runs) / sizeof(runs[0]); run++)
+	{
+		for (line = 0; line < lengths[run]; line++)
+		{
+			fprintf(handler, "%s\n", runs[run]);
+		}
+		expected += skipped[run];
+	}
+	fclose(handler);
+
+	LONGS_EQUAL(expected, REPLAY_CheckSameAsSerial(SPEED_CONTROL_TEST_INPUT, SPEED_CONTROL_TEST_SERIAL,
+		SPEED_CONTROL_TEST_RUNS, &config));
+}
+
+/* replay_speed_control_test closure */
+/**
+ *  @}
+ */
  
 /* speed_control_test closure */
 /**
@@ -982,6 +1472,35 @@ TEST_GROUP_RUNNER(ONE_SWIICH_COVERAGE_speed_control_test)
 }
 
 
+/* closed_form_speed_control_test runner */
+TEST_GROUP_RUNNER(closed_form_speed_control_test)
+{
+	printf("\n\t======================= Closed form Test Cases =======================\n\n");
+	printf("\t");
+	RUN_TEST_CASE(closed_form_speed_control_test, PReductionIsTheSameAsStepLoop);
+	printf("\t");
+	RUN_TEST_CASE(closed_form_speed_control_test, BatchIsTheSameAsOneDevice);
+	printf("\n");
+	RUN_TEST_CASE(closed_form_speed_control_test, RunIsTheSameAsTicks);
+	printf("\t");
+	RUN_TEST_CASE(closed_form_speed_control_test, TransferIsTheSameAsTicks);
+	printf("\t");
+	RUN_TEST_CASE(closed_form_speed_control_test, TableIsTheSameAsRules);
+	printf("\t");
+	RUN_TEST_CASE(closed_form_speed_control_test, SnapshotIsReadByCalcNewSpeed);
+	printf("\n\t======================= Closed form Test  Done =======================\n\n");
+}
+
+
+/* replay_speed_control_test runner */
+TEST_GROUP_RUNNER(replay_speed_control_test)
+{
+	printf("\n\t========================== Replay Test Cases ==========================\n\n");
+	printf("\t");
+	RUN_TEST_CASE(replay_speed_control_test, RunsReplayIsTheSameAsSerial);
+	printf("\n\t========================== Replay Test  Done ==========================\n\n");
+}
+
 /* speed_control_test runner */
 TEST_GROUP_RUNNER(speed_control_test)
 {
@@ -990,6 +1509,8 @@ TEST_GROUP_RUNNER(speed_control_test)
     RUN_TEST_GROUP(priority_speed_control_test);
     RUN_TEST_GROUP(EP_BVA_speed_control_test);
     RUN_TEST_GROUP(ONE_SWIICH_COVERAGE_speed_control_test);
+    RUN_TEST_GROUP(closed_form_speed_control_test);
+    RUN_TEST_GROUP(replay_speed_control_test);
     printf("\n==================== Testing Speed Control  Module Done ====================\n\n\n");
 }
 
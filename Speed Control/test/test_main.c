@@ -0,0 +1,52 @@
+/**
+ *  \file	test_main.c
+ *  \brief	This is the main code of the test binary.
+ *  \author Ahmed Wageh.
+ */
+/* Inclusion */
+#include <stdio.h>
+/* Include Unity */
+#include "unity/unity_fixture.h"
+
+#define MAKE_UNITY_VERBOSE	argc = 2; argv[1] = "-v"
+
+
+/* Test Groups Runner */
+ /**
+ *  \brief This is all needed test cases to test our modules.
+ */
+ void RunAllTests(void)
+{
+    RUN_TEST_GROUP(parseing_test);
+    RUN_TEST_GROUP(FakeSwitch);
+    RUN_TEST_GROUP(file_if_test);
+    RUN_TEST_GROUP(device_test);
+    RUN_TEST_GROUP(fleet_test);
+    RUN_TEST_GROUP(pipeline_test);
+    RUN_TEST_GROUP(chunk_test);
+    RUN_TEST_GROUP(trace_test);
+    RUN_TEST_GROUP(profile_test);
+    RUN_TEST_GROUP(generate_test);
+    RUN_TEST_GROUP(motor_test);
+    RUN_TEST_GROUP(speed_control_test);
+}
+
+/**
+ *  \brief Test program body
+ *
+ *  \details It runs all test groups in verbose mode and returns the
+ *  		 number of failures.
+ */
+int main(int argc, char * argv[])
+{
+    /* Needed variables */
+    char * verboseArgv[2];
+
+    /* Manipulate argc & argv to make unity verbose*/
+    verboseArgv[0] = argv[0];
+    argv = verboseArgv;
+    MAKE_UNITY_VERBOSE;
+
+    /* Call Unity Main */
+    return UnityMain(argc, (const char **)argv, RunAllTests);
+}
@@ -0,0 +1,269 @@
+/**
+ *  \file	trace_test.c
+ *  \brief	This file includes test cases for testing Trace module.
+ *  \author Ahmed Wageh
+ */
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+#include "../../source/Trace/Trace.h"
+#include "../../source/File If/FileIf.h"
+#include "../../source/Speed Control/SpeedControl.h"
+#include "../unity/unity_fixture.h"
+
+/** The input text file used by the test cases */
+#define TRACE_TEST_TEXT		"trace_test_switches.txt"
+/** The input trace file used by the test cases */
+#define TRACE_TEST_TRACE	"trace_test_switches.bin"
+/** The output file used by the test cases */
+#define TRACE_TEST_OUTPUT	"trace_test_motor.txt"
+/** The number of input lines */
+#define TRACE_TEST_LINES	300u
+/** The size of one read block, it splits records between blocks and it holds a text line */
+#define TRACE_TEST_READ_SIZE	64u
+
+/* Test group declaration */
+TEST_GROUP(trace_test);
+
+/** The tested durations */
+static const int Test_Durations[] = {0, 1, -1, 63, 64, -64, -65, 29999, 30000, 60001, INT_MAX, INT_MIN};
+
+/**
+ *  \brief Replays an input file with a reader.
+ *
+ *  \param [in] Path the path of the input file.
+ *  \param [in] Mode the \ref FileIf_InputMode_t of the input file.
+ *  \param [out] Text the output file content as a string.
+ *  \param [in] Size the size of \p Text.
+ */
+static void Replay(const char * Path, FileIf_InputMode_t Mode, char * Text, unsigned int Size)
+{
+	static char readBuffer[TRACE_TEST_READ_SIZE + 1];
+	static char writeBuffer[FILE_IF_OUTPUT_BUFFER_SIZE];
+	FileIf_Reader_t reader;
+	FileIf_Writer_t writer;
+	Switches_Context_t switches;
+	Motor_Context_t motor;
+	FILE * handler;
+	size_t length = 0;
+
+	LONGS_EQUAL(FILE_IF_ERROR_OK, File_ReaderOpenMode(&reader, Path, readBuffer, TRACE_TEST_READ_SIZE, Mode));
+	LONGS_EQUAL(FILE_IF_ERROR_OK, File_WriterOpen(&writer, TRACE_TEST_OUTPUT, writeBuffer, sizeof(writeBuffer)));
+	Switches_ContextInit(&switches, &reader);
+	Motor_ContextInit(&motor, &writer);
+	while (Switches_ContextUpdateState(&switches) == SWITCH_UPDATE_OK)
+	{
+		Motor_ContextUpdateSpeed(&motor, SpeedControl_ContextCalcNewSpeed(&switches, &motor));
+	}
+	LONGS_EQUAL(FILE_IF_ERROR_OK, File_WriterClose(&writer));
+	File_ReaderClose(&reader);
+
+	handler = fopen(TRACE_TEST_OUTPUT, "rb");
+	if (handler != NULL)
+	{
+		length = fread(Text, 1, Size - 1, handler);
+		fclose(handler);
+	}
+	Text[length] = 0;
+}
+
+/* trace_test group setup and tear_down function */
+TEST_SETUP(trace_test)
+{
+
+}
+
+TEST_TEAR_DOWN(trace_test)
+{
+	remove(TRACE_TEST_TEXT);
+	remove(TRACE_TEST_TRACE);
+	remove(TRACE_TEST_OUTPUT);
+}
+
+/**
+ *  \defgroup trace_test_cases Trace module test cases
+ *  This is for testing the functionality of Trace module
+ *
+ *  \details It tests the following test cases:
+ *  	-	RecordsAreTheSameAfterDecoding: Every states of the switches
+ *  		with durations around the varint boundaries.
+ *  	-	HeaderIsChecked: Text, short, other version and valid headers.
+ *  	-	BadRecordsAreDetected: Truncated and corrupted records.
+ *  	-	TraceReplayIsTheSameAsText: A trace is replayed the same as
+ *  		its text file in both input modes.
+ *  	-	OtherVersionCanNotBeRead: A trace of another version can't
+ *  		be opened.
+ *  @{
+ */
+
+/**
+ *  \brief Test case for encoding and decoding every record.
+ *
+ *  \details A record without errors and duration is one byte.
+ */
+TEST(trace_test, RecordsAreTheSameAfterDecoding)
+{
+	unsigned char data[TRACE_RECORD_MAX_SIZE + 1];
+	Parse_Record_t record;
+	Parse_Record_t decoded;
+	unsigned int duration;
+	unsigned int length;
+	unsigned int used;
+	int inc;
+	int dec;
+	int p;
+
+	for (duration = 0; duration < sizeof(Test_Durations) / sizeof(Test_Durations[0]); duration++)
+	{
+		for (inc = SWITCH_ERROR; inc <= SWITCH_PRE_RELEASED; inc++)
+		{
+			for (dec = SWITCH_ERROR; dec <= SWITCH_PRE_RELEASED; dec++)
+			{
+				for (p = SWITCH_ERROR; p <= SWITCH_PRE_RELEASED; p++)
+				{
+					record.Inc_Switch = (Switches_States_t)inc;
+					record.Dec_Switch = (Switches_States_t)dec;
+					record.P_Switch = (Switches_States_t)p;
+					record.P_Duration = Test_Durations[duration];
+					length = Trace_EncodeRecord(&record, data);
+					if (inc != SWITCH_ERROR && dec != SWITCH_ERROR && p != SWITCH_ERROR && duration == 0u)
+					{
+						LONGS_EQUAL(1, length);
+					}
+					LONGS_EQUAL(TRACE_ERROR_OK, Trace_DecodeRecord(data, length, &decoded, &used));
+					LONGS_EQUAL(length, used);
+					LONGS_EQUAL(inc, decoded.Inc_Switch);
+					LONGS_EQUAL(dec, decoded.Dec_Switch);
+					LONGS_EQUAL(p, decoded.P_Switch);
+					LONGS_EQUAL(Test_Durations[duration], decoded.P_Duration);
+				}
+			}
+		}
+	}
+}
+
+/**
+ *  \brief Test case for checking the trace header.
+ */
+TEST(trace_test, HeaderIsChecked)
+{
+	unsigned char header[TRACE_HEADER_SIZE];
+
+	LONGS_EQUAL(TRACE_HEADER_SIZE, Trace_WriteHeader(header));
+	LONGS_EQUAL(TRACE_ERROR_OK, Trace_CheckHeader(header, TRACE_HEADER_SIZE));
+	LONGS_EQUAL(TRACE_ERROR_TRUNCATED, Trace_CheckHeader(header, TRACE_MAGIC_SIZE));
+	LONGS_EQUAL(TRACE_ERROR_NOT_TRACE, Trace_CheckHeader(header, TRACE_MAGIC_SIZE - 1u));
+	LONGS_EQUAL(TRACE_ERROR_NOT_TRACE, Trace_CheckHeader((const unsigned char *)"inc\tdec", 7u));
+	header[TRACE_MAGIC_SIZE] = TRACE_VERSION + 1u;
+	LONGS_EQUAL(TRACE_ERROR_VERSION, Trace_CheckHeader(header, TRACE_HEADER_SIZE));
+}
+
+/**
+ *  \brief Test case for decoding truncated and corrupted records.
+ */
+TEST(trace_test, BadRecordsAreDetected)
+{
+	static const unsigned char errorByte[] = {0x40u};
+	static const unsigned char emptyErrorByte[] = {0x40u, 0x00u};
+	static const unsigned char unusedErrorBit[] = {0x40u, 0x08u};
+	static const unsigned char shortVarint[] = {0x80u, 0x81u};
+	static const unsigned char longVarint[] = {0x80u, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0x10u};
+	static const unsigned char maxVarint[] = {0x80u, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0x0Fu};
+	Parse_Record_t record;
+	unsigned int used;
+
+	LONGS_EQUAL(TRACE_ERROR_TRUNCATED, Trace_DecodeRecord(errorByte, 0u, &record, &used));
+	LONGS_EQUAL(TRACE_ERROR_TRUNCATED, Trace_DecodeRecord(errorByte, sizeof(errorByte), &record, &used));
+	LONGS_EQUAL(TRACE_ERROR_CORRUPTED, Trace_DecodeRecord(emptyErrorByte, sizeof(emptyErrorByte), &record, &used));
+	LONGS_EQUAL(TRACE_ERROR_CORRUPTED, Trace_DecodeRecord(unusedErrorBit, sizeof(unusedErrorBit), &record, &used));
+	LONGS_EQUAL(TRACE_ERROR_TRUNCATED, Trace_DecodeRecord(shortVarint, sizeof(shortVarint), &record, &used));
+	LONGS_EQUAL(TRACE_ERROR_CORRUPTED, Trace_DecodeRecord(longVarint, sizeof(longVarint), &record, &used));
+	LONGS_EQUAL(TRACE_ERROR_OK, Trace_DecodeRecord(maxVarint, sizeof(maxVarint), &record, &used));
+	LONGS_EQUAL(sizeof(maxVarint), used);
+	LONGS_EQUAL(INT_MIN, record.P_Duration);
+}
+
+/**
+ *  \brief Test case for replaying a trace and its text file.
+ *
+ *  \details The text lines have every state and the tested durations,
+ *  		 the trace is made of the parsed lines.
+ */
+TEST(trace_test, TraceReplayIsTheSameAsText)
+{
+	static const char * states[] = {"bad", "pre_pressed", "pressed", "released", "pre_released"};
+	static const FileIf_InputMode_t modes[] = {FILE_IF_INPUT_MODE_STREAM, FILE_IF_INPUT_MODE_MAPPED};
+	static char textOutput[TRACE_TEST_LINES * FILE_IF_OUTPUT_LINE_MAX_LENGTH + 64];
+	static char traceOutput[TRACE_TEST_LINES * FILE_IF_OUTPUT_LINE_MAX_LENGTH + 64];
+	unsigned char data[TRACE_RECORD_MAX_SIZE];
+	char line[64];
+	Parse_Record_t record;
+	FILE * text = fopen(TRACE_TEST_TEXT, "wb");
+	FILE * trace = fopen(TRACE_TEST_TRACE, "wb");
+	const char * end;
+	unsigned int lines;
+	unsigned int index;
+
+	fputs("inc\tdec\tp\tduration\n", text);
+	fwrite(data, 1, Trace_WriteHeader(data), trace);
+	for (index = 0; index < TRACE_TEST_LINES; index++)
+	{
+		sprintf(line, "%s\t%s\t%s\t%d", states[index % 5u], states[index / 5u % 5u], states[index / 25u % 5u],
+			Test_Durations[index / 3u % (sizeof(Test_Durations) / sizeof(Test_Durations[0]))]);
+		fprintf(text, "%s\n", line);
+		ParseRecord(line, (unsigned int)strlen(line), &record);
+		fwrite(data, 1, Trace_EncodeRecord(&record, data), trace);
+	}
+	fclose(text);
+	fclose(trace);
+
+	for (index = 0; index < sizeof(modes) / sizeof(modes[0]); index++)
+	{
+		Replay(TRACE_TEST_TEXT, modes[index], textOutput, sizeof(textOutput));
+		Replay(TRACE_TEST_TRACE, modes[index], traceOutput, sizeof(traceOutput));
+		for (lines = 0, end = traceOutput; (end = strchr(end, '\n')) != NULL; end++)
+		{
+			lines++;
+		}
+		LONGS_EQUAL(TRACE_TEST_LINES + 1u, lines);	/* The header and a speed for every line */
+		STRCMP_EQUAL(textOutput, traceOutput);
+	}
+}
+
+/**
+ *  \brief Test case for opening a trace of another version.
+ */
+TEST(trace_test, OtherVersionCanNotBeRead)
+{
+	char readBuffer[TRACE_TEST_READ_SIZE + 1];
+	unsigned char header[TRACE_HEADER_SIZE];
+	FileIf_Reader_t reader;
+	FILE * trace = fopen(TRACE_TEST_TRACE, "wb");
+
+	Trace_WriteHeader(header);
+	header[TRACE_MAGIC_SIZE] = TRACE_VERSION + 1u;
+	fwrite(header, 1, sizeof(header), trace);
+	fputc(0, trace);
+	fclose(trace);
+
+	LONGS_EQUAL(FILE_IF_ERROR_BAD_FORMAT, File_ReaderOpenMode(&reader, TRACE_TEST_TRACE, readBuffer,
+		TRACE_TEST_READ_SIZE, FILE_IF_INPUT_MODE_STREAM));
+	File_ReaderClose(&reader);
+}
+/**
+ *  @}
+ */
+
+/**
+ *  \brief Test code runner for all test cases of Trace module.
+ */
+TEST_GROUP_RUNNER(trace_test)
+{
+    printf("======================= Testing Trace Module =======================\n\n");
+    RUN_TEST_CASE(trace_test, RecordsAreTheSameAfterDecoding);
+    RUN_TEST_CASE(trace_test, HeaderIsChecked);
+    RUN_TEST_CASE(trace_test, BadRecordsAreDetected);
+    RUN_TEST_CASE(trace_test, TraceReplayIsTheSameAsText);
+    RUN_TEST_CASE(trace_test, OtherVersionCanNotBeRead);
+    printf("\n==================== Testing Trace  Module Done ====================\n\n\n");
+}
@@ -0,0 +1,75 @@
+/**
+ *  \file	fleet_main.c
+ *  \brief	This is the main code of the fleet replay tool.
+ *  \author Ahmed Wageh.
+ *  \details	Usage: speedcontrol_fleet <input directory> [workers]
+ *  			Every directory inside the input directory that has
+ *  			"switches.txt" is a device, its "motor.txt" is written
+ *  			next to it.
+ *
+ *  			Usage: speedcontrol_fleet --self-check
+ *  			It compares the tables of the new speed with the rules
+ *  			for every input.
+ */
+/* Inclusion */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../source/Fleet/Fleet.h"
+#include "../source/Speed Control/SpeedControl.h"
+
+/**
+ *  \brief Fleet replay main body
+ *
+ *  \details It replays all devices and prints the statistics. It
+ *  		 returns 0 only if all devices are replayed.
+ */
+int main(int argc, char * argv[])
+{
+	/* Needed variables */
+	Fleet_Result_t result;
+	Fleet_Error_t error;
+	unsigned int workers = 0;
+	struct timespec start;
+	struct timespec end;
+	double seconds;
+	unsigned long mismatches;
+
+	/* Program logic */
+	if (argc < 2 || argc > 3)
+	{
+		fprintf(stderr, "Usage: %s <input directory> [workers]\n       %s --self-check\n", argv[0], argv[0]);
+		return 2;
+	}
+	if (argc == 2 && strcmp(argv[1], "--self-check") == 0)
+	{
+		SpeedControl_TableInit();
+		mismatches = SpeedControl_TableCheck();
+		printf("Speed tables: %lu mismatches\n", mismatches);
+		return (mismatches == 0u) ? 0 : 1;
+	}
+	if (argc == 3)
+	{
+		workers = (unsigned int)strtoul(argv[2], NULL, 10);
+	}
+
+	timespec_get(&start, TIME_UTC);
+	error = Fleet_Run(argv[1], workers, &result);
+	timespec_get(&end, TIME_UTC);
+	seconds = (double)(end.tv_sec - start.tv_sec) + (double)(end.tv_nsec - start.tv_nsec) * 1e-9;
+
+	if (error == FLEET_ERROR_CAN_NOT_OPEN_DIR)
+	{
+		fprintf(stderr, "Can't open %s\n", argv[1]);
+	}
+	else if (error == FLEET_ERROR_NO_RESOURCES)
+	{
+		fprintf(stderr, "Can't allocate the workers\n");
+	}
+	printf("Devices: %lu, failed: %lu, lines: %llu, workers: %u, steals: %lu\n",
+		result.Devices, result.Failed, result.Lines, result.Workers, result.Steals);
+	printf("Time: %.3f s, %.0f lines/s\n", seconds, (seconds > 0) ? (double)result.Lines / seconds : 0.0);
+
+	return (error == FLEET_ERROR_OK) ? 0 : 1;
+}
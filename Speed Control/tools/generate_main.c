@@ -0,0 +1,175 @@
+/**
+ *  \file	generate_main.c
+ *  \brief	This is the main code of the input file generator tool.
+ *  \author Ahmed Wageh.
+ *  \details	Usage: speedcontrol_generate <output file> <lines> [options]
+ *  			Options:
+ *  			-	--seed <number>: The seed of the random numbers, 1 by default.
+ *  			-	--workers <number>: The number of worker threads, one for every
+ *  				core by default.
+ *  			-	--tick-ms <number>: The time between two lines in ms.
+ *  			-	--chunk-lines <number>: The number of lines of every chunk.
+ *  			-	--leave <+ve | -ve | p | all> <state> <probability>: The probability
+ *  				of leaving a state of a switch at the next line, the state is one
+ *  				of \ref Switches_text.
+ *
+ *  			The same options give the same file for any number of workers.
+ */
+/* Inclusion */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../source/Generate/Generate.h"
+#include "../source/Fleet/Fleet.h"
+#include "../source/Parse/Parse.h"
+
+/**
+ *  \brief Parses an unsigned number argument.
+ *
+ *  \param [in] Text The argument.
+ *  \param [out] Value The number.
+ *  \return 0 if \p Text is a whole number, otherwise 1.
+ */
+static int Generate_ParseNumber(const char * Text, unsigned long long * Value)
+{
+	char * end;
+
+	*Value = strtoull(Text, &end, 0);
+	return (*Text == '\0' || *end != '\0' || *Text == '-');
+}
+
+/**
+ *  \brief Parses the "--leave" option.
+ *
+ *  \param [in] Switch The switch name.
+ *  \param [in] State The state text.
+ *  \param [in] Probability The probability from 0 to 1.
+ *  \param [in,out] Config The model to be changed.
+ *  \return 0 if the option is valid, otherwise 1.
+ */
+static int Generate_ParseLeave(const char * Switch, const char * State, const char * Probability,
+	Generate_Config_t * Config)
+{
+	Switches_States_t state = ParseSwitchState(State, (unsigned int)strlen(State));
+	char * end;
+	double leave = strtod(Probability, &end);
+	unsigned int first = 0;
+	unsigned int last = GENERATE_SWITCHES - 1u;
+	unsigned int id;
+
+	if (strcmp(Switch, "+ve") == 0)
+	{
+		last = first = SWITCH_INCREMENT;
+	}
+	else if (strcmp(Switch, "-ve") == 0)
+	{
+		last = first = SWITCH_DECREMENT;
+	}
+	else if (strcmp(Switch, "p") == 0)
+	{
+		last = first = SWITCH_P;
+	}
+	else if (strcmp(Switch, "all") != 0)
+	{
+		return 1;
+	}
+	if (state == SWITCH_ERROR || *end != '\0' || !(leave >= 0.0 && leave <= 1.0))
+	{
+		return 1;
+	}
+
+	for (id = first; id <= last; id++)
+	{
+		Config->Leave[id][state] = leave;
+	}
+	return 0;
+}
+
+/**
+ *  \brief Input file generator main body
+ *
+ *  \details It generates the file and prints its size and the
+ *  		 generation speed. It returns 0 only if the file is written.
+ */
+int main(int argc, char * argv[])
+{
+	/* Needed variables */
+	Generate_Config_t config;
+	Generate_Error_t error;
+	struct timespec start;
+	struct timespec end;
+	unsigned long long lines = 0;
+	unsigned long long value;
+	unsigned long long size;
+	unsigned int workers = Fleet_GetCoreCount();
+	double seconds;
+	int invalid = (argc < 3);
+	int index;
+
+	/* Program arguments */
+	Generate_DefaultConfig(&config);
+	if (!invalid)
+	{
+		invalid = Generate_ParseNumber(argv[2], &lines);
+	}
+	for (index = 3; !invalid && index < argc; index++)
+	{
+		if (strcmp(argv[index], "--leave") == 0 && index + 3 < argc)
+		{
+			invalid = Generate_ParseLeave(argv[index + 1], argv[index + 2], argv[index + 3], &config);
+			index += 3;
+		}
+		else if (index + 1 >= argc || Generate_ParseNumber(argv[index + 1], &value))
+		{
+			invalid = 1;
+		}
+		else if (strcmp(argv[index], "--seed") == 0)
+		{
+			config.Seed = value;
+			index++;
+		}
+		else if (strcmp(argv[index], "--workers") == 0 && value > 0u && value <= 1024u)
+		{
+			workers = (unsigned int)value;
+			index++;
+		}
+		else if (strcmp(argv[index], "--tick-ms") == 0 && value <= 3600000u)
+		{
+			config.Tick_Ms = (unsigned int)value;
+			index++;
+		}
+		else if (strcmp(argv[index], "--chunk-lines") == 0 && value > 0u && value <= 16u * 1024u * 1024u)
+		{
+			config.Chunk_Lines = (unsigned int)value;
+			index++;
+		}
+		else
+		{
+			invalid = 1;
+		}
+	}
+	if (invalid)
+	{
+		fprintf(stderr, "Usage: %s <output file> <lines> [--seed <number>] [--workers <number>] "
+			"[--tick-ms <number>] [--chunk-lines <number>] [--leave <+ve | -ve | p | all> <state> <probability>]...\n",
+			argv[0]);
+		return 2;
+	}
+
+	/* Program logic */
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	error = Generate_File(argv[1], lines, &config, workers, &size);
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	seconds = (double)(end.tv_sec - start.tv_sec) + (double)(end.tv_nsec - start.tv_nsec) * 1e-9;
+	if (error != GENERATE_ERROR_OK)
+	{
+		fprintf(stderr, "Can't generate %s (error %d)\n", argv[1], (int)error);
+		return 1;
+	}
+
+	printf("Lines: %llu, size: %llu bytes, workers: %u, %.2f s (%.1f MB/s)\n", lines, size, workers,
+		seconds, (seconds > 0.0) ? (double)size / seconds / (1024.0 * 1024.0) : 0.0);
+
+	return 0;
+}
@@ -0,0 +1,121 @@
+/**
+ *  \file	motor_decode_main.c
+ *  \brief	This is the main code of the motor run-length decoder tool.
+ *  \author Ahmed Wageh.
+ *  \details	Usage: speedcontrol_motor_decode <input run-length file> <output text file>
+ *  			The runs of a file written in #FILE_IF_OUTPUT_FORMAT_RUN_LENGTH
+ *  			format are decoded block by block and written as the same
+ *  			output text file "motor.txt" the project writes.
+ */
+/* Inclusion */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../source/File If/FileIf.h"
+
+/* Macros */
+/** The size of one read block of the input run-length file */
+#define MOTOR_DECODE_READ_SIZE	(64u * 1024u)
+
+/**
+ *  \brief Motor decoder main body
+ *
+ *  \details It decodes the input run-length file and prints the sizes
+ *  		 of both files. It returns 0 only if all runs are decoded.
+ */
+int main(int argc, char * argv[])
+{
+	/* Needed variables */
+	FileIf_Writer_t writer;
+	FileIf_Error_t error = FILE_IF_ERROR_OK;
+	unsigned char * input;
+	char * output;
+	FILE * handler = NULL;
+	unsigned int start = 0;
+	unsigned int end = 0;
+	unsigned int used;
+	unsigned int count;
+	unsigned long long lines = 0;
+	unsigned long long runs = 0;
+	unsigned long long inputSize = 0;
+	int data = 0;
+	int endOfFile = 0;
+	int retCode = 0;
+
+	/* Program logic */
+	if (argc != 3)
+	{
+		fprintf(stderr, "Usage: %s <input run-length file> <output text file>\n", argv[0]);
+		return 2;
+	}
+
+	input = malloc(MOTOR_DECODE_READ_SIZE);
+	output = malloc(FILE_IF_OUTPUT_BUFFER_SIZE);
+	if (input == NULL || output == NULL)
+	{
+		fprintf(stderr, "Can't allocate the buffers\n");
+		free(input);
+		free(output);
+		return 1;
+	}
+
+	handler = fopen(argv[1], "rb");
+	if (handler == NULL ||
+		fread(input, 1, FILE_IF_RUN_LENGTH_HEADER_SIZE, handler) != FILE_IF_RUN_LENGTH_HEADER_SIZE ||
+		memcmp(input, FILE_IF_RUN_LENGTH_MAGIC, FILE_IF_RUN_LENGTH_MAGIC_SIZE) != 0 ||
+		input[FILE_IF_RUN_LENGTH_MAGIC_SIZE] != FILE_IF_RUN_LENGTH_VERSION)
+	{
+		fprintf(stderr, "Can't read %s as a run-length file\n", argv[1]);
+		retCode = 1;
+	}
+	else if (File_WriterOpen(&writer, argv[2], output, FILE_IF_OUTPUT_BUFFER_SIZE) != FILE_IF_ERROR_OK)
+	{
+		fprintf(stderr, "Can't open %s\n", argv[2]);
+		retCode = 1;
+	}
+	else
+	{
+		inputSize = FILE_IF_RUN_LENGTH_HEADER_SIZE;
+		while (error == FILE_IF_ERROR_OK && (!endOfFile || start != end))
+		{
+			error = File_DecodeRun(input + start, end - start, &data, &count, &used);
+			if (error == FILE_IF_ERROR_OK)
+			{
+				start += used;
+				runs++;
+				lines += count;
+				while (count > 0u && error == FILE_IF_ERROR_OK)
+				{
+					error = File_WriterWriteLine(&writer, data);
+					count--;
+				}
+			}
+			else if (error == FILE_IF_ERROR_END_OF_FILE && !endOfFile)	/* The run continues in the next block */
+			{
+				memmove(input, input + start, end - start);
+				end -= start;
+				start = 0;
+				used = (unsigned int)fread(input + end, 1, MOTOR_DECODE_READ_SIZE - end, handler);
+				endOfFile = (used == 0u);
+				end += used;
+				inputSize += used;
+				error = ferror(handler) ? FILE_IF_ERROR_CAN_NOT_READ : FILE_IF_ERROR_OK;
+			}
+		}
+		if (File_WriterClose(&writer) != FILE_IF_ERROR_OK || error != FILE_IF_ERROR_OK)
+		{
+			fprintf(stderr, "Can't decode %s to %s\n", argv[1], argv[2]);
+			retCode = 1;
+		}
+		printf("Runs: %llu, lines: %llu, run-length file: %llu bytes\n", runs, lines, inputSize);
+	}
+	if (handler != NULL)
+	{
+		fclose(handler);
+	}
+
+	free(input);
+	free(output);
+
+	return retCode;
+}
@@ -0,0 +1,107 @@
+/**
+ *  \file	trace_main.c
+ *  \brief	This is the main code of the trace converter tool.
+ *  \author Ahmed Wageh.
+ *  \details	Usage: speedcontrol_trace <input text file> <output trace file>
+ *  			Every line of the input text file is parsed and written
+ *  			as one record of the binary trace described in "Trace.h".
+ *  			The trace can be used as "switches.txt" of the project.
+ */
+/* Inclusion */
+#include <stdio.h>
+#include <stdlib.h>
+#include "../source/File If/FileIf.h"
+#include "../source/Parse/Parse.h"
+#include "../source/Trace/Trace.h"
+
+/* Macros */
+/** The size of one read block of the input text file */
+#define TRACE_MAIN_READ_SIZE	(1024u * 1024u)
+/** The size of the output buffer */
+#define TRACE_MAIN_WRITE_SIZE	(1024u * 1024u)
+
+/**
+ *  \brief Trace converter main body
+ *
+ *  \details It converts the input text file and prints the sizes of
+ *  		 both files. It returns 0 only if all lines are converted.
+ */
+int main(int argc, char * argv[])
+{
+	/* Needed variables */
+	FileIf_Reader_t reader;
+	FileIf_Error_t readError;
+	Parse_Record_t record;
+	unsigned char * output;
+	char * input;
+	FILE * handler = NULL;
+	const char * line;
+	unsigned int length;
+	unsigned int used;
+	unsigned long long lines = 0;
+	unsigned long long textSize = 0;
+	unsigned long long traceSize = 0;
+	int retCode = 0;
+
+	/* Program logic */
+	if (argc != 3)
+	{
+		fprintf(stderr, "Usage: %s <input text file> <output trace file>\n", argv[0]);
+		return 2;
+	}
+
+	input = malloc(TRACE_MAIN_READ_SIZE + 1u);
+	output = malloc(TRACE_MAIN_WRITE_SIZE);
+	if (input == NULL || output == NULL)
+	{
+		fprintf(stderr, "Can't allocate the buffers\n");
+		free(input);
+		free(output);
+		return 1;
+	}
+
+	readError = File_ReaderOpenMode(&reader, argv[1], input, TRACE_MAIN_READ_SIZE, FILE_IF_INPUT_MODE_MAPPED);
+	if (readError != FILE_IF_ERROR_OK || reader.Format != FILE_IF_INPUT_FORMAT_TEXT)
+	{
+		fprintf(stderr, "Can't read %s as a text file\n", argv[1]);
+		retCode = 1;
+	}
+	else if ((handler = fopen(argv[2], "wb")) == NULL)
+	{
+		fprintf(stderr, "Can't open %s\n", argv[2]);
+		retCode = 1;
+	}
+	else
+	{
+		used = Trace_WriteHeader(output);
+		while ((readError = File_ReaderNextLine(&reader, &line, &length)) == FILE_IF_ERROR_OK)
+		{
+			if (used > TRACE_MAIN_WRITE_SIZE - TRACE_RECORD_MAX_SIZE)	/* Full buffer */
+			{
+				retCode |= (fwrite(output, 1, used, handler) != used);
+				traceSize += used;
+				used = 0;
+			}
+			ParseRecord(line, length, &record);
+			used += Trace_EncodeRecord(&record, output + used);
+			textSize += length + 1u;
+			lines++;
+		}
+		retCode |= (fwrite(output, 1, used, handler) != used);
+		traceSize += used;
+		retCode |= (fclose(handler) != 0);
+		if (readError != FILE_IF_ERROR_END_OF_FILE || retCode != 0)
+		{
+			fprintf(stderr, "Can't convert %s to %s\n", argv[1], argv[2]);
+			retCode = 1;
+		}
+		printf("Lines: %llu, text lines: %llu bytes, trace: %llu bytes (x%.1f smaller)\n", lines, textSize,
+			traceSize, (traceSize > 0u) ? (double)textSize / (double)traceSize : 0.0);
+	}
+	File_ReaderClose(&reader);
+
+	free(input);
+	free(output);
+
+	return retCode;
+}